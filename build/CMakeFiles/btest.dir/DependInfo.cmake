@@ -0,0 +1,35 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/tests/assignment_test.cpp" "CMakeFiles/btest.dir/assignment_test.cpp.o" "gcc" "CMakeFiles/btest.dir/assignment_test.cpp.o.d"
+  "/root/repo/tests/bytecode_test.cpp" "CMakeFiles/btest.dir/bytecode_test.cpp.o" "gcc" "CMakeFiles/btest.dir/bytecode_test.cpp.o.d"
+  "/root/repo/tests/e2_test.cpp" "CMakeFiles/btest.dir/e2_test.cpp.o" "gcc" "CMakeFiles/btest.dir/e2_test.cpp.o.d"
+  "/root/repo/tests/expr_test.cpp" "CMakeFiles/btest.dir/expr_test.cpp.o" "gcc" "CMakeFiles/btest.dir/expr_test.cpp.o.d"
+  "/root/repo/tests/fibonacci_test.cpp" "CMakeFiles/btest.dir/fibonacci_test.cpp.o" "gcc" "CMakeFiles/btest.dir/fibonacci_test.cpp.o.d"
+  "/root/repo/tests/fixture.cpp" "CMakeFiles/btest.dir/fixture.cpp.o" "gcc" "CMakeFiles/btest.dir/fixture.cpp.o.d"
+  "/root/repo/tests/fizzbuzz_test.cpp" "CMakeFiles/btest.dir/fizzbuzz_test.cpp.o" "gcc" "CMakeFiles/btest.dir/fizzbuzz_test.cpp.o.d"
+  "/root/repo/tests/func_test.cpp" "CMakeFiles/btest.dir/func_test.cpp.o" "gcc" "CMakeFiles/btest.dir/func_test.cpp.o.d"
+  "/root/repo/tests/globals_test.cpp" "CMakeFiles/btest.dir/globals_test.cpp.o" "gcc" "CMakeFiles/btest.dir/globals_test.cpp.o.d"
+  "/root/repo/tests/hello_test.cpp" "CMakeFiles/btest.dir/hello_test.cpp.o" "gcc" "CMakeFiles/btest.dir/hello_test.cpp.o.d"
+  "/root/repo/tests/libb_test.cpp" "CMakeFiles/btest.dir/libb_test.cpp.o" "gcc" "CMakeFiles/btest.dir/libb_test.cpp.o.d"
+  "/root/repo/tests/optimize_test.cpp" "CMakeFiles/btest.dir/optimize_test.cpp.o" "gcc" "CMakeFiles/btest.dir/optimize_test.cpp.o.d"
+  "/root/repo/tests/precedence_test.cpp" "CMakeFiles/btest.dir/precedence_test.cpp.o" "gcc" "CMakeFiles/btest.dir/precedence_test.cpp.o.d"
+  "/root/repo/tests/string_test.cpp" "CMakeFiles/btest.dir/string_test.cpp.o" "gcc" "CMakeFiles/btest.dir/string_test.cpp.o.d"
+  "/root/repo/tests/word32_test.cpp" "CMakeFiles/btest.dir/word32_test.cpp.o" "gcc" "CMakeFiles/btest.dir/word32_test.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/build/_deps/googletest-build/googletest/CMakeFiles/gtest_main.dir/DependInfo.cmake"
+  "/root/repo/build/_deps/googletest-build/googletest/CMakeFiles/gtest.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
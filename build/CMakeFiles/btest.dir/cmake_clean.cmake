@@ -0,0 +1,40 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/btest.dir/assignment_test.cpp.o"
+  "CMakeFiles/btest.dir/assignment_test.cpp.o.d"
+  "CMakeFiles/btest.dir/bytecode_test.cpp.o"
+  "CMakeFiles/btest.dir/bytecode_test.cpp.o.d"
+  "CMakeFiles/btest.dir/e2_test.cpp.o"
+  "CMakeFiles/btest.dir/e2_test.cpp.o.d"
+  "CMakeFiles/btest.dir/expr_test.cpp.o"
+  "CMakeFiles/btest.dir/expr_test.cpp.o.d"
+  "CMakeFiles/btest.dir/fibonacci_test.cpp.o"
+  "CMakeFiles/btest.dir/fibonacci_test.cpp.o.d"
+  "CMakeFiles/btest.dir/fixture.cpp.o"
+  "CMakeFiles/btest.dir/fixture.cpp.o.d"
+  "CMakeFiles/btest.dir/fizzbuzz_test.cpp.o"
+  "CMakeFiles/btest.dir/fizzbuzz_test.cpp.o.d"
+  "CMakeFiles/btest.dir/func_test.cpp.o"
+  "CMakeFiles/btest.dir/func_test.cpp.o.d"
+  "CMakeFiles/btest.dir/globals_test.cpp.o"
+  "CMakeFiles/btest.dir/globals_test.cpp.o.d"
+  "CMakeFiles/btest.dir/hello_test.cpp.o"
+  "CMakeFiles/btest.dir/hello_test.cpp.o.d"
+  "CMakeFiles/btest.dir/libb_test.cpp.o"
+  "CMakeFiles/btest.dir/libb_test.cpp.o.d"
+  "CMakeFiles/btest.dir/optimize_test.cpp.o"
+  "CMakeFiles/btest.dir/optimize_test.cpp.o.d"
+  "CMakeFiles/btest.dir/precedence_test.cpp.o"
+  "CMakeFiles/btest.dir/precedence_test.cpp.o.d"
+  "CMakeFiles/btest.dir/string_test.cpp.o"
+  "CMakeFiles/btest.dir/string_test.cpp.o.d"
+  "CMakeFiles/btest.dir/word32_test.cpp.o"
+  "CMakeFiles/btest.dir/word32_test.cpp.o.d"
+  "btest"
+  "btest.pdb"
+  "btest[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/btest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
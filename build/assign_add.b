@@ -0,0 +1,8 @@
+
+        main() {
+            auto x;
+            x = 10;
+            x =+ 5;
+            printf("%d*n", x); /* Expected: x = x + 5 = 15 */
+        }
+    
\ No newline at end of file
@@ -0,0 +1,30 @@
+.globl main
+.section .text.sorted.00001,"ax",@progbits
+.align 16
+.type main, @function
+main:
+  sub $8, %rsp
+  sub $8, %rsp
+  sub $8, %rsp
+  sub $8, %rsp
+  mov $10, %rax
+  mov %rax, 8(%rsp)
+  mov $5, %rax
+  add %rax, 8(%rsp)
+  lea .string.0(%rip), %rax
+  push %rax
+  mov 16(%rsp), %rax
+  push %rax
+  pop %rsi
+  pop %rdi
+  call printf
+  add $16, %rsp
+  xor %rax, %rax
+  add $16, %rsp
+  ret
+.section .rodata
+.string.0:
+  .byte 37
+  .byte 100
+  .byte 10
+  .byte 0
@@ -0,0 +1,8 @@
+
+        main() {
+            auto x;
+            x = 15;
+            x =/ 3;
+            printf("%d*n", x); /* Expected: x = 15 / 3 = 5 */
+        }
+    
\ No newline at end of file
@@ -0,0 +1,41 @@
+.globl main
+.section .text.sorted.00001,"ax",@progbits
+.align 16
+.type main, @function
+main:
+  sub $8, %rsp
+  sub $8, %rsp
+  sub $8, %rsp
+  sub $8, %rsp
+  mov $15, %rax
+  mov %rax, 8(%rsp)
+  lea 8(%rsp), %rax
+  push %rax
+  mov (%rax), %rax
+  push %rax
+  pop %rax
+  mov %rax, %rcx
+  movabs $6148914691236517206, %rdx
+  imul %rdx
+  mov %rcx, %rax
+  shr $63, %rax
+  add %rdx, %rax
+  pop %rdi
+  mov %rax, (%rdi)
+  lea .string.0(%rip), %rax
+  push %rax
+  mov 16(%rsp), %rax
+  push %rax
+  pop %rsi
+  pop %rdi
+  call printf
+  add $16, %rsp
+  xor %rax, %rax
+  add $16, %rsp
+  ret
+.section .rodata
+.string.0:
+  .byte 37
+  .byte 100
+  .byte 10
+  .byte 0
@@ -0,0 +1,11 @@
+
+        main() {
+            auto x;
+            x = 5;
+            x === 5;
+            printf("%d*n", x); /* Expected: x = (5 == 5) = 1 (true) */
+            x = 5;
+            x === 6;
+            printf("%d*n", x); /* Expected: x = (5 == 6) = 0 (false) */
+        }
+    
\ No newline at end of file
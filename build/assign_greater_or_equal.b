@@ -0,0 +1,11 @@
+
+        main() {
+            auto x;
+            x = 3;
+            x =>= 5;
+            printf("%d*n", x); /* Expected: x = (3 >= 5) = 0 (false) */
+            x = 5;
+            x =>= 5;
+            printf("%d*n", x); /* Expected: x = (5 >= 5) = 1 (true) */
+        }
+    
\ No newline at end of file
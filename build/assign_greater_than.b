@@ -0,0 +1,11 @@
+
+        main() {
+            auto x;
+            x = 4;
+            x => 5;
+            printf("%d*n", x); /* Expected: x = (4 > 5) = 0 (false) */
+            x = 6;
+            x => 5;
+            printf("%d*n", x); /* Expected: x = (6 > 5) = 1 (true) */
+        }
+    
\ No newline at end of file
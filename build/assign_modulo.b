@@ -0,0 +1,8 @@
+
+        main() {
+            auto x;
+            x = 17;
+            x =% 5;
+            printf("%d*n", x); /* Expected: x = 17 % 5 = 2 */
+        }
+    
\ No newline at end of file
@@ -0,0 +1,8 @@
+
+        main() {
+            auto x;
+            x = 4;
+            x =* 3;
+            printf("%d*n", x); /* Expected: x = x * 3 = 12 */
+        }
+    
\ No newline at end of file
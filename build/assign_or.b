@@ -0,0 +1,8 @@
+
+        main() {
+            auto x;
+            x = 12;             /* 1100 in binary */
+            x =| 10;            /* 1010 in binary */
+            printf("%d*n", x);  /* Expected: x = 12 | 10 = 14 (1110) */
+        }
+    
\ No newline at end of file
@@ -0,0 +1,8 @@
+
+        main() {
+            auto x;
+            x = 2;
+            x =<< 2;
+            printf("%d*n", x); /* Expected: x = 2 << 2 = 8 */
+        }
+    
\ No newline at end of file
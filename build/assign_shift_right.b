@@ -0,0 +1,8 @@
+
+        main() {
+            auto x;
+            x = 16;
+            x =>> 2;
+            printf("%d*n", x); /* Expected: x = 16 >> 2 = 4 */
+        }
+    
\ No newline at end of file
@@ -0,0 +1,8 @@
+
+        main() {
+            auto x;
+            x = 10;
+            x =- 3;
+            printf("%d*n", x); /* Expected: x = x - 3 = 7 */
+        }
+    
\ No newline at end of file
@@ -0,0 +1,48 @@
+
+        x 42;
+
+        main() {
+            extrn x;
+            auto y;
+
+            y = 345;
+            printf("%d + %d -> %d*n", x, y, x + y);
+            printf("%d + %d -> %d*n", y, x, y + x);
+
+            printf("%d - %d -> %d*n", x, y, x - y);
+            printf("%d - %d -> %d*n", y, x, y - x);
+
+            printf("%d ** %d -> %d*n", x, y, x * y);
+            printf("%d ** %d -> %d*n", y, x, y * x);
+
+            printf("%d / %d -> %d*n", x, y, x / y);
+            printf("%d / %d -> %d*n", y, x, y / x);
+
+            printf("%d %% %d -> %d*n", x, y, x % y);
+            printf("%d %% %d -> %d*n", y, x, y % x);
+
+            printf("%d < %d -> %d*n", x, y, x < y);
+            printf("%d < %d -> %d*n", y, x, y < x);
+
+            printf("%d <= %d -> %d*n", x, y, x <= y);
+            printf("%d <= %d -> %d*n", y, x, y <= x);
+
+            printf("%d > %d -> %d*n", x, y, x > y);
+            printf("%d > %d -> %d*n", y, x, y > x);
+
+            printf("%d >= %d -> %d*n", x, y, x >= y);
+            printf("%d >= %d -> %d*n", y, x, y >= x);
+
+            printf("%d == %d -> %d*n", x, y, x == y);
+            printf("%d == %d -> %d*n", y, x, y == x);
+
+            printf("%d != %d -> %d*n", x, y, x != y);
+            printf("%d != %d -> %d*n", y, x, y != x);
+
+            printf("%d & %d -> %d*n", x, y, x & y);
+            printf("%d & %d -> %d*n", y, x, y & x);
+
+            printf("%d | %d -> %d*n", x, y, x | y);
+            printf("%d | %d -> %d*n", y, x, y | x);
+        }
+    
\ No newline at end of file
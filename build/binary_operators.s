@@ -0,0 +1,858 @@
+.globl x
+.data
+.type x, @object
+.align 8
+x:
+  .quad 42
+.globl main
+.section .text.sorted.00001,"ax",@progbits
+.align 16
+.type main, @function
+main:
+  sub $8, %rsp
+  sub $8, %rsp
+  sub $8, %rsp
+  sub $8, %rsp
+  mov $345, %rax
+  mov %rax, 8(%rsp)
+  lea .string.0(%rip), %rax
+  push %rax
+  mov x(%rip), %rax
+  push %rax
+  mov 24(%rsp), %rax
+  push %rax
+  mov x(%rip), %rax
+  add 32(%rsp), %rax
+  push %rax
+  pop %rcx
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  call printf
+  lea .string.1(%rip), %rax
+  push %rax
+  mov 16(%rsp), %rax
+  push %rax
+  mov x(%rip), %rax
+  push %rax
+  mov 32(%rsp), %rax
+  add x(%rip), %rax
+  push %rax
+  pop %rcx
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  call printf
+  lea .string.2(%rip), %rax
+  push %rax
+  mov x(%rip), %rax
+  push %rax
+  mov 24(%rsp), %rax
+  push %rax
+  mov x(%rip), %rax
+  sub 32(%rsp), %rax
+  push %rax
+  pop %rcx
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  call printf
+  lea .string.3(%rip), %rax
+  push %rax
+  mov 16(%rsp), %rax
+  push %rax
+  mov x(%rip), %rax
+  push %rax
+  mov 32(%rsp), %rax
+  sub x(%rip), %rax
+  push %rax
+  pop %rcx
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  call printf
+  lea .string.4(%rip), %rax
+  push %rax
+  mov x(%rip), %rax
+  push %rax
+  mov 24(%rsp), %rax
+  push %rax
+  mov x(%rip), %rax
+  imul 32(%rsp), %rax
+  push %rax
+  pop %rcx
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  call printf
+  lea .string.5(%rip), %rax
+  push %rax
+  mov 16(%rsp), %rax
+  push %rax
+  mov x(%rip), %rax
+  push %rax
+  mov 32(%rsp), %rax
+  imul x(%rip), %rax
+  push %rax
+  pop %rcx
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  call printf
+  lea .string.6(%rip), %rax
+  push %rax
+  mov x(%rip), %rax
+  push %rax
+  mov 24(%rsp), %rax
+  push %rax
+  mov x(%rip), %rax
+  push %rax
+  mov 40(%rsp), %rax
+  mov %rax, %rdi
+  pop %rax
+  cqo
+  idiv %rdi
+  push %rax
+  pop %rcx
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  call printf
+  lea .string.7(%rip), %rax
+  push %rax
+  mov 16(%rsp), %rax
+  push %rax
+  mov x(%rip), %rax
+  push %rax
+  mov 32(%rsp), %rax
+  push %rax
+  mov x(%rip), %rax
+  mov %rax, %rdi
+  pop %rax
+  cqo
+  idiv %rdi
+  push %rax
+  pop %rcx
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  call printf
+  lea .string.8(%rip), %rax
+  push %rax
+  mov x(%rip), %rax
+  push %rax
+  mov 24(%rsp), %rax
+  push %rax
+  mov x(%rip), %rax
+  push %rax
+  mov 40(%rsp), %rax
+  mov %rax, %rdi
+  pop %rax
+  cqo
+  idiv %rdi
+  mov %rdx, %rax
+  push %rax
+  pop %rcx
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  call printf
+  lea .string.9(%rip), %rax
+  push %rax
+  mov 16(%rsp), %rax
+  push %rax
+  mov x(%rip), %rax
+  push %rax
+  mov 32(%rsp), %rax
+  push %rax
+  mov x(%rip), %rax
+  mov %rax, %rdi
+  pop %rax
+  cqo
+  idiv %rdi
+  mov %rdx, %rax
+  push %rax
+  pop %rcx
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  call printf
+  lea .string.10(%rip), %rax
+  push %rax
+  mov x(%rip), %rax
+  push %rax
+  mov 24(%rsp), %rax
+  push %rax
+  mov x(%rip), %rax
+  cmp 32(%rsp), %rax
+  setl %al
+  movzb %al, %rax
+  push %rax
+  pop %rcx
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  call printf
+  lea .string.11(%rip), %rax
+  push %rax
+  mov 16(%rsp), %rax
+  push %rax
+  mov x(%rip), %rax
+  push %rax
+  mov 32(%rsp), %rax
+  cmp x(%rip), %rax
+  setl %al
+  movzb %al, %rax
+  push %rax
+  pop %rcx
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  call printf
+  lea .string.12(%rip), %rax
+  push %rax
+  mov x(%rip), %rax
+  push %rax
+  mov 24(%rsp), %rax
+  push %rax
+  mov x(%rip), %rax
+  cmp 32(%rsp), %rax
+  setle %al
+  movzb %al, %rax
+  push %rax
+  pop %rcx
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  call printf
+  lea .string.13(%rip), %rax
+  push %rax
+  mov 16(%rsp), %rax
+  push %rax
+  mov x(%rip), %rax
+  push %rax
+  mov 32(%rsp), %rax
+  cmp x(%rip), %rax
+  setle %al
+  movzb %al, %rax
+  push %rax
+  pop %rcx
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  call printf
+  lea .string.14(%rip), %rax
+  push %rax
+  mov x(%rip), %rax
+  push %rax
+  mov 24(%rsp), %rax
+  push %rax
+  mov x(%rip), %rax
+  cmp 32(%rsp), %rax
+  setg %al
+  movzb %al, %rax
+  push %rax
+  pop %rcx
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  call printf
+  lea .string.15(%rip), %rax
+  push %rax
+  mov 16(%rsp), %rax
+  push %rax
+  mov x(%rip), %rax
+  push %rax
+  mov 32(%rsp), %rax
+  cmp x(%rip), %rax
+  setg %al
+  movzb %al, %rax
+  push %rax
+  pop %rcx
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  call printf
+  lea .string.16(%rip), %rax
+  push %rax
+  mov x(%rip), %rax
+  push %rax
+  mov 24(%rsp), %rax
+  push %rax
+  mov x(%rip), %rax
+  cmp 32(%rsp), %rax
+  setge %al
+  movzb %al, %rax
+  push %rax
+  pop %rcx
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  call printf
+  lea .string.17(%rip), %rax
+  push %rax
+  mov 16(%rsp), %rax
+  push %rax
+  mov x(%rip), %rax
+  push %rax
+  mov 32(%rsp), %rax
+  cmp x(%rip), %rax
+  setge %al
+  movzb %al, %rax
+  push %rax
+  pop %rcx
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  call printf
+  lea .string.18(%rip), %rax
+  push %rax
+  mov x(%rip), %rax
+  push %rax
+  mov 24(%rsp), %rax
+  push %rax
+  mov x(%rip), %rax
+  cmp 32(%rsp), %rax
+  sete %al
+  movzb %al, %rax
+  push %rax
+  pop %rcx
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  call printf
+  lea .string.19(%rip), %rax
+  push %rax
+  mov 16(%rsp), %rax
+  push %rax
+  mov x(%rip), %rax
+  push %rax
+  mov 32(%rsp), %rax
+  cmp x(%rip), %rax
+  sete %al
+  movzb %al, %rax
+  push %rax
+  pop %rcx
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  call printf
+  lea .string.20(%rip), %rax
+  push %rax
+  mov x(%rip), %rax
+  push %rax
+  mov 24(%rsp), %rax
+  push %rax
+  mov x(%rip), %rax
+  cmp 32(%rsp), %rax
+  setne %al
+  movzb %al, %rax
+  push %rax
+  pop %rcx
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  call printf
+  lea .string.21(%rip), %rax
+  push %rax
+  mov 16(%rsp), %rax
+  push %rax
+  mov x(%rip), %rax
+  push %rax
+  mov 32(%rsp), %rax
+  cmp x(%rip), %rax
+  setne %al
+  movzb %al, %rax
+  push %rax
+  pop %rcx
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  call printf
+  lea .string.22(%rip), %rax
+  push %rax
+  mov x(%rip), %rax
+  push %rax
+  mov 24(%rsp), %rax
+  push %rax
+  mov x(%rip), %rax
+  and 32(%rsp), %rax
+  push %rax
+  pop %rcx
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  call printf
+  lea .string.23(%rip), %rax
+  push %rax
+  mov 16(%rsp), %rax
+  push %rax
+  mov x(%rip), %rax
+  push %rax
+  mov 32(%rsp), %rax
+  and x(%rip), %rax
+  push %rax
+  pop %rcx
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  call printf
+  lea .string.24(%rip), %rax
+  push %rax
+  mov x(%rip), %rax
+  push %rax
+  mov 24(%rsp), %rax
+  push %rax
+  mov x(%rip), %rax
+  or 32(%rsp), %rax
+  push %rax
+  pop %rcx
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  call printf
+  lea .string.25(%rip), %rax
+  push %rax
+  mov 16(%rsp), %rax
+  push %rax
+  mov x(%rip), %rax
+  push %rax
+  mov 32(%rsp), %rax
+  or x(%rip), %rax
+  push %rax
+  pop %rcx
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  call printf
+  add $16, %rsp
+  xor %rax, %rax
+  add $16, %rsp
+  ret
+.section .rodata
+.string.0:
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 43
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 45
+  .byte 62
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 10
+  .byte 0
+.string.1:
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 43
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 45
+  .byte 62
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 10
+  .byte 0
+.string.2:
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 45
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 45
+  .byte 62
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 10
+  .byte 0
+.string.3:
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 45
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 45
+  .byte 62
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 10
+  .byte 0
+.string.4:
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 42
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 45
+  .byte 62
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 10
+  .byte 0
+.string.5:
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 42
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 45
+  .byte 62
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 10
+  .byte 0
+.string.6:
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 47
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 45
+  .byte 62
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 10
+  .byte 0
+.string.7:
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 47
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 45
+  .byte 62
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 10
+  .byte 0
+.string.8:
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 37
+  .byte 37
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 45
+  .byte 62
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 10
+  .byte 0
+.string.9:
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 37
+  .byte 37
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 45
+  .byte 62
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 10
+  .byte 0
+.string.10:
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 60
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 45
+  .byte 62
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 10
+  .byte 0
+.string.11:
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 60
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 45
+  .byte 62
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 10
+  .byte 0
+.string.12:
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 60
+  .byte 61
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 45
+  .byte 62
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 10
+  .byte 0
+.string.13:
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 60
+  .byte 61
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 45
+  .byte 62
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 10
+  .byte 0
+.string.14:
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 62
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 45
+  .byte 62
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 10
+  .byte 0
+.string.15:
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 62
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 45
+  .byte 62
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 10
+  .byte 0
+.string.16:
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 62
+  .byte 61
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 45
+  .byte 62
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 10
+  .byte 0
+.string.17:
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 62
+  .byte 61
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 45
+  .byte 62
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 10
+  .byte 0
+.string.18:
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 61
+  .byte 61
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 45
+  .byte 62
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 10
+  .byte 0
+.string.19:
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 61
+  .byte 61
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 45
+  .byte 62
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 10
+  .byte 0
+.string.20:
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 33
+  .byte 61
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 45
+  .byte 62
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 10
+  .byte 0
+.string.21:
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 33
+  .byte 61
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 45
+  .byte 62
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 10
+  .byte 0
+.string.22:
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 38
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 45
+  .byte 62
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 10
+  .byte 0
+.string.23:
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 38
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 45
+  .byte 62
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 10
+  .byte 0
+.string.24:
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 124
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 45
+  .byte 62
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 10
+  .byte 0
+.string.25:
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 124
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 45
+  .byte 62
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 10
+  .byte 0
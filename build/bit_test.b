@@ -0,0 +1,29 @@
+
+        kind(c) {
+            switch (c) {
+            case ' ':
+            case '*t':
+            case '*n':
+                return (1);
+            case 'a': case 'e': case 'i': case 'o': case 'u':
+                return (2);
+            case 'x': case 'y':
+                return (3);
+            }
+            return (0);
+        }
+
+        main() {
+            auto s, c, i;
+
+            s = "hex tau*n";
+            i = 0;
+            while ((c = char(s, i++)) != '*e') {
+                putchar('0' + kind(c));
+                if (c == 'h' | c == 't' | c == 'u' | c == 'x')
+                    putchar('!');
+            }
+            putchar('0' + kind(-1) + kind(0140 + 'a'));
+            putchar('*n');
+        }
+    
\ No newline at end of file
@@ -0,0 +1,152 @@
+.globl kind
+.section .text.sorted.00002,"ax",@progbits
+.type kind, @function
+kind:
+  push %rdi
+  call kind.internal
+  add $8, %rsp
+  ret
+.section .text.sorted.00002,"ax",@progbits
+.align 16
+.type kind.internal, @function
+kind.internal:
+  mov 8(%rsp), %rax
+  jmp .L.cmp.6
+.align 16
+.L.case.6.32:
+  mov $1, %rax
+  jmp .L.return.kind.internal
+.align 16
+.L.case.6.97:
+  mov $2, %rax
+  jmp .L.return.kind.internal
+.align 16
+.L.case.6.120:
+.L.case.6.121:
+  mov $3, %rax
+  jmp .L.return.kind.internal
+.L.cmp.6:
+  lea -9(%rax), %rcx
+  mov $8388611, %rdx
+  xor %rdi, %rdi
+  cmp $63, %rcx
+  cmova %rdi, %rdx
+  bt %rcx, %rdx
+  jc .L.case.6.32
+  lea -97(%rax), %rcx
+  mov $1065233, %rdx
+  xor %rdi, %rdi
+  cmp $63, %rcx
+  cmova %rdi, %rdx
+  bt %rcx, %rdx
+  jc .L.case.6.97
+  cmp $120, %rax
+  je .L.case.6.120
+  cmp $121, %rax
+  je .L.case.6.121
+  xor %rax, %rax
+.L.return.kind.internal:
+  ret
+.globl main
+.section .text.sorted.00001,"ax",@progbits
+.align 16
+.type main, @function
+main:
+  sub $8, %rsp
+  sub $8, %rsp
+  sub $8, %rsp
+  sub $8, %rsp
+  sub $8, %rsp
+  sub $8, %rsp
+  lea .string.0(%rip), %rax
+  mov %rax, 24(%rsp)
+  xor %rax, %rax
+  mov %rax, 8(%rsp)
+.align 16
+.L.start.10:
+  mov 24(%rsp), %rax
+  push %rax
+  lea 16(%rsp), %rax
+  mov (%rax), %rcx
+  addq $1, (%rax)
+  mov %rcx, %rax
+  push %rax
+  pop %rsi
+  pop %rdi
+  call char
+  mov %rax, 16(%rsp)
+  test %rax, %rax
+  setne %al
+  movzb %al, %rax
+  test %rax, %rax
+  je .L.end.10
+  mov $48, %rax
+  push %rax
+  mov 24(%rsp), %rax
+  push %rax
+  call kind.internal
+  add $8, %rsp
+  pop %rdi
+  add %rdi, %rax
+  push %rax
+  pop %rdi
+  call putchar
+  mov 16(%rsp), %rax
+  lea -104(%rax), %rcx
+  mov $77825, %rdx
+  xor %rdi, %rdi
+  cmp $63, %rcx
+  cmova %rdi, %rdx
+  bt %rcx, %rdx
+  setc %al
+  movzb %al, %rax
+  test %rax, %rax
+  je .L.start.10
+  mov $33, %rax
+  push %rax
+  pop %rdi
+  call putchar
+  jmp .L.start.10
+.L.end.10:
+  mov $48, %rax
+  push %rax
+  mov $1, %rax
+  neg %rax
+  push %rax
+  call kind.internal
+  add $8, %rsp
+  pop %rdi
+  add %rdi, %rax
+  push %rax
+  mov $96, %rax
+  push %rax
+  mov $97, %rax
+  pop %rdi
+  add %rdi, %rax
+  push %rax
+  call kind.internal
+  add $8, %rsp
+  pop %rdi
+  add %rdi, %rax
+  push %rax
+  pop %rdi
+  call putchar
+  mov $10, %rax
+  push %rax
+  pop %rdi
+  call putchar
+  add $32, %rsp
+  xor %rax, %rax
+  add $16, %rsp
+  ret
+.section .rodata
+.string.0:
+  .byte 104
+  .byte 101
+  .byte 120
+  .byte 32
+  .byte 116
+  .byte 97
+  .byte 117
+  .byte 10
+  .byte 0
@@ -0,0 +1,23 @@
+
+        check(x) {
+            if (unlikely(x < 0)) {
+                printf("negative*n");
+                return (0);
+            }
+            if (likely(x < 10))
+                return (x);
+            else
+                return (x * 2);
+        }
+
+        main() {
+            auto i, s;
+
+            i = s = 0;
+            while (i < 20) {
+                if (unlikely(i == 7)) s =+ 100;
+                s =+ check(i++);
+            }
+            printf("%d %d*n", s, check(-1));
+        }
+    
\ No newline at end of file
@@ -0,0 +1,121 @@
+.globl check
+.section .text.sorted.00002,"ax",@progbits
+.type check, @function
+check:
+  push %rdi
+  call check.internal
+  add $8, %rsp
+  ret
+.section .text.sorted.00002,"ax",@progbits
+.align 16
+.type check.internal, @function
+check.internal:
+  sub $8, %rsp
+  mov 16(%rsp), %rax
+  test %rax, %rax
+  setl %al
+  movzb %al, %rax
+  test %rax, %rax
+  jne .L.cold.4
+  mov 16(%rsp), %rax
+  cmp $10, %rax
+  setl %al
+  movzb %al, %rax
+  test %rax, %rax
+  je .L.cold.5
+  mov 16(%rsp), %rax
+.L.return.check.internal:
+  add $8, %rsp
+  ret
+.L.cold.4:
+  lea .string.0(%rip), %rax
+  push %rax
+  pop %rdi
+  call printf
+  xor %rax, %rax
+  jmp .L.return.check.internal
+.L.cold.5:
+  mov 16(%rsp), %rax
+  shl $1, %rax
+  jmp .L.return.check.internal
+.globl main
+.section .text.sorted.00001,"ax",@progbits
+.align 16
+.type main, @function
+main:
+  sub $8, %rsp
+  sub $8, %rsp
+  sub $8, %rsp
+  sub $8, %rsp
+  xor %rax, %rax
+  mov %rax, 0(%rsp)
+  mov %rax, 8(%rsp)
+.align 16
+.L.start.6:
+  mov 8(%rsp), %rax
+  cmp $20, %rax
+  setl %al
+  movzb %al, %rax
+  test %rax, %rax
+  je .L.end.6
+  mov 8(%rsp), %rax
+  cmp $7, %rax
+  sete %al
+  movzb %al, %rax
+  test %rax, %rax
+  jne .L.cold.7
+.L.end.7:
+  lea 8(%rsp), %rax
+  mov (%rax), %rcx
+  addq $1, (%rax)
+  mov %rcx, %rax
+  push %rax
+  call check.internal
+  add $8, %rsp
+  add %rax, 0(%rsp)
+  mov 0(%rsp), %rax
+  jmp .L.start.6
+.L.end.6:
+  lea .string.1(%rip), %rax
+  push %rax
+  mov 8(%rsp), %rax
+  push %rax
+  mov $1, %rax
+  neg %rax
+  push %rax
+  call check.internal
+  add $8, %rsp
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  call printf
+  add $16, %rsp
+  xor %rax, %rax
+  add $16, %rsp
+  ret
+.L.cold.7:
+  mov $100, %rax
+  add %rax, 0(%rsp)
+  mov 0(%rsp), %rax
+  jmp .L.end.7
+.section .rodata
+.string.0:
+  .byte 110
+  .byte 101
+  .byte 103
+  .byte 97
+  .byte 116
+  .byte 105
+  .byte 118
+  .byte 101
+  .byte 10
+  .byte 0
+.string.1:
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 10
+  .byte 0
@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/build/btest[1]_tests.cmake")
+  include("/root/repo/build/btest[1]_tests.cmake")
+else()
+  add_test(btest_NOT_BUILT btest_NOT_BUILT)
+endif()
@@ -0,0 +1,219 @@
+add_test([=[bcause.libb_putchar]=]  /root/repo/build/btest [==[--gtest_filter=bcause.libb_putchar]==] --gtest_also_run_disabled_tests [==[--gtest_repeat=1]==])
+set_tests_properties([=[bcause.libb_putchar]=]  PROPERTIES WORKING_DIRECTORY /root/repo/build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] TIMEOUT 120)
+add_test([=[bcause.libb_printf]=]  /root/repo/build/btest [==[--gtest_filter=bcause.libb_printf]==] --gtest_also_run_disabled_tests [==[--gtest_repeat=1]==])
+set_tests_properties([=[bcause.libb_printf]=]  PROPERTIES WORKING_DIRECTORY /root/repo/build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] TIMEOUT 120)
+add_test([=[bcause.libb_exit]=]  /root/repo/build/btest [==[--gtest_filter=bcause.libb_exit]==] --gtest_also_run_disabled_tests [==[--gtest_repeat=1]==])
+set_tests_properties([=[bcause.libb_exit]=]  PROPERTIES WORKING_DIRECTORY /root/repo/build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] TIMEOUT 120)
+add_test([=[bcause.libb_char]=]  /root/repo/build/btest [==[--gtest_filter=bcause.libb_char]==] --gtest_also_run_disabled_tests [==[--gtest_repeat=1]==])
+set_tests_properties([=[bcause.libb_char]=]  PROPERTIES WORKING_DIRECTORY /root/repo/build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] TIMEOUT 120)
+add_test([=[bcause.libb_lchar]=]  /root/repo/build/btest [==[--gtest_filter=bcause.libb_lchar]==] --gtest_also_run_disabled_tests [==[--gtest_repeat=1]==])
+set_tests_properties([=[bcause.libb_lchar]=]  PROPERTIES WORKING_DIRECTORY /root/repo/build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] TIMEOUT 120)
+add_test([=[bcause.libb_nwrite]=]  /root/repo/build/btest [==[--gtest_filter=bcause.libb_nwrite]==] --gtest_also_run_disabled_tests [==[--gtest_repeat=1]==])
+set_tests_properties([=[bcause.libb_nwrite]=]  PROPERTIES WORKING_DIRECTORY /root/repo/build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] TIMEOUT 120)
+add_test([=[bcause.libb_gather]=]  /root/repo/build/btest [==[--gtest_filter=bcause.libb_gather]==] --gtest_also_run_disabled_tests [==[--gtest_repeat=1]==])
+set_tests_properties([=[bcause.libb_gather]=]  PROPERTIES WORKING_DIRECTORY /root/repo/build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] TIMEOUT 120)
+add_test([=[bcause.libb_gather_printf]=]  /root/repo/build/btest [==[--gtest_filter=bcause.libb_gather_printf]==] --gtest_also_run_disabled_tests [==[--gtest_repeat=1]==])
+set_tests_properties([=[bcause.libb_gather_printf]=]  PROPERTIES WORKING_DIRECTORY /root/repo/build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] TIMEOUT 120)
+add_test([=[bcause.libb_huge_pages]=]  /root/repo/build/btest [==[--gtest_filter=bcause.libb_huge_pages]==] --gtest_also_run_disabled_tests [==[--gtest_repeat=1]==])
+set_tests_properties([=[bcause.libb_huge_pages]=]  PROPERTIES WORKING_DIRECTORY /root/repo/build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] TIMEOUT 120)
+add_test([=[bcause.libb_vector_kernels]=]  /root/repo/build/btest [==[--gtest_filter=bcause.libb_vector_kernels]==] --gtest_also_run_disabled_tests [==[--gtest_repeat=1]==])
+set_tests_properties([=[bcause.libb_vector_kernels]=]  PROPERTIES WORKING_DIRECTORY /root/repo/build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] TIMEOUT 120)
+add_test([=[bcause.global_scalars]=]  /root/repo/build/btest [==[--gtest_filter=bcause.global_scalars]==] --gtest_also_run_disabled_tests [==[--gtest_repeat=1]==])
+set_tests_properties([=[bcause.global_scalars]=]  PROPERTIES WORKING_DIRECTORY /root/repo/build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] TIMEOUT 120)
+add_test([=[bcause.global_vectors]=]  /root/repo/build/btest [==[--gtest_filter=bcause.global_vectors]==] --gtest_also_run_disabled_tests [==[--gtest_repeat=1]==])
+set_tests_properties([=[bcause.global_vectors]=]  PROPERTIES WORKING_DIRECTORY /root/repo/build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] TIMEOUT 120)
+add_test([=[bcause.local_scalars]=]  /root/repo/build/btest [==[--gtest_filter=bcause.local_scalars]==] --gtest_also_run_disabled_tests [==[--gtest_repeat=1]==])
+set_tests_properties([=[bcause.local_scalars]=]  PROPERTIES WORKING_DIRECTORY /root/repo/build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] TIMEOUT 120)
+add_test([=[bcause.local_vectors]=]  /root/repo/build/btest [==[--gtest_filter=bcause.local_vectors]==] --gtest_also_run_disabled_tests [==[--gtest_repeat=1]==])
+set_tests_properties([=[bcause.local_vectors]=]  PROPERTIES WORKING_DIRECTORY /root/repo/build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] TIMEOUT 120)
+add_test([=[bcause.global_vectors_direct]=]  /root/repo/build/btest [==[--gtest_filter=bcause.global_vectors_direct]==] --gtest_also_run_disabled_tests [==[--gtest_repeat=1]==])
+set_tests_properties([=[bcause.global_vectors_direct]=]  PROPERTIES WORKING_DIRECTORY /root/repo/build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] TIMEOUT 120)
+add_test([=[bcause.function_definitions]=]  /root/repo/build/btest [==[--gtest_filter=bcause.function_definitions]==] --gtest_also_run_disabled_tests [==[--gtest_repeat=1]==])
+set_tests_properties([=[bcause.function_definitions]=]  PROPERTIES WORKING_DIRECTORY /root/repo/build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] TIMEOUT 120)
+add_test([=[bcause.function_arguments]=]  /root/repo/build/btest [==[--gtest_filter=bcause.function_arguments]==] --gtest_also_run_disabled_tests [==[--gtest_repeat=1]==])
+set_tests_properties([=[bcause.function_arguments]=]  PROPERTIES WORKING_DIRECTORY /root/repo/build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] TIMEOUT 120)
+add_test([=[bcause.function_ternary_operator]=]  /root/repo/build/btest [==[--gtest_filter=bcause.function_ternary_operator]==] --gtest_also_run_disabled_tests [==[--gtest_repeat=1]==])
+set_tests_properties([=[bcause.function_ternary_operator]=]  PROPERTIES WORKING_DIRECTORY /root/repo/build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] TIMEOUT 120)
+add_test([=[bcause.function_dead_code]=]  /root/repo/build/btest [==[--gtest_filter=bcause.function_dead_code]==] --gtest_also_run_disabled_tests [==[--gtest_repeat=1]==])
+set_tests_properties([=[bcause.function_dead_code]=]  PROPERTIES WORKING_DIRECTORY /root/repo/build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] TIMEOUT 120)
+add_test([=[bcause.unary_operators]=]  /root/repo/build/btest [==[--gtest_filter=bcause.unary_operators]==] --gtest_also_run_disabled_tests [==[--gtest_repeat=1]==])
+set_tests_properties([=[bcause.unary_operators]=]  PROPERTIES WORKING_DIRECTORY /root/repo/build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] TIMEOUT 120)
+add_test([=[bcause.negation_in_conditional_context]=]  /root/repo/build/btest [==[--gtest_filter=bcause.negation_in_conditional_context]==] --gtest_also_run_disabled_tests [==[--gtest_repeat=1]==])
+set_tests_properties([=[bcause.negation_in_conditional_context]=]  PROPERTIES WORKING_DIRECTORY /root/repo/build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] TIMEOUT 120)
+add_test([=[bcause.postfix_operators]=]  /root/repo/build/btest [==[--gtest_filter=bcause.postfix_operators]==] --gtest_also_run_disabled_tests [==[--gtest_repeat=1]==])
+set_tests_properties([=[bcause.postfix_operators]=]  PROPERTIES WORKING_DIRECTORY /root/repo/build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] TIMEOUT 120)
+add_test([=[bcause.local_array]=]  /root/repo/build/btest [==[--gtest_filter=bcause.local_array]==] --gtest_also_run_disabled_tests [==[--gtest_repeat=1]==])
+set_tests_properties([=[bcause.local_array]=]  PROPERTIES WORKING_DIRECTORY /root/repo/build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] TIMEOUT 120)
+add_test([=[bcause.global_array]=]  /root/repo/build/btest [==[--gtest_filter=bcause.global_array]==] --gtest_also_run_disabled_tests [==[--gtest_repeat=1]==])
+set_tests_properties([=[bcause.global_array]=]  PROPERTIES WORKING_DIRECTORY /root/repo/build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] TIMEOUT 120)
+add_test([=[bcause.local_mix]=]  /root/repo/build/btest [==[--gtest_filter=bcause.local_mix]==] --gtest_also_run_disabled_tests [==[--gtest_repeat=1]==])
+set_tests_properties([=[bcause.local_mix]=]  PROPERTIES WORKING_DIRECTORY /root/repo/build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] TIMEOUT 120)
+add_test([=[bcause.binary_operators]=]  /root/repo/build/btest [==[--gtest_filter=bcause.binary_operators]==] --gtest_also_run_disabled_tests [==[--gtest_repeat=1]==])
+set_tests_properties([=[bcause.binary_operators]=]  PROPERTIES WORKING_DIRECTORY /root/repo/build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] TIMEOUT 120)
+add_test([=[bcause.eq_by_bitmask]=]  /root/repo/build/btest [==[--gtest_filter=bcause.eq_by_bitmask]==] --gtest_also_run_disabled_tests [==[--gtest_repeat=1]==])
+set_tests_properties([=[bcause.eq_by_bitmask]=]  PROPERTIES WORKING_DIRECTORY /root/repo/build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] TIMEOUT 120)
+add_test([=[bcause.octal_literals]=]  /root/repo/build/btest [==[--gtest_filter=bcause.octal_literals]==] --gtest_also_run_disabled_tests [==[--gtest_repeat=1]==])
+set_tests_properties([=[bcause.octal_literals]=]  PROPERTIES WORKING_DIRECTORY /root/repo/build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] TIMEOUT 120)
+add_test([=[bcause.conditional_move]=]  /root/repo/build/btest [==[--gtest_filter=bcause.conditional_move]==] --gtest_also_run_disabled_tests [==[--gtest_repeat=1]==])
+set_tests_properties([=[bcause.conditional_move]=]  PROPERTIES WORKING_DIRECTORY /root/repo/build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] TIMEOUT 120)
+add_test([=[bcause.builtins]=]  /root/repo/build/btest [==[--gtest_filter=bcause.builtins]==] --gtest_also_run_disabled_tests [==[--gtest_repeat=1]==])
+set_tests_properties([=[bcause.builtins]=]  PROPERTIES WORKING_DIRECTORY /root/repo/build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] TIMEOUT 120)
+add_test([=[bcause.builtin_clz]=]  /root/repo/build/btest [==[--gtest_filter=bcause.builtin_clz]==] --gtest_also_run_disabled_tests [==[--gtest_repeat=1]==])
+set_tests_properties([=[bcause.builtin_clz]=]  PROPERTIES WORKING_DIRECTORY /root/repo/build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] TIMEOUT 120)
+add_test([=[bcause.builtin_named_function]=]  /root/repo/build/btest [==[--gtest_filter=bcause.builtin_named_function]==] --gtest_also_run_disabled_tests [==[--gtest_repeat=1]==])
+set_tests_properties([=[bcause.builtin_named_function]=]  PROPERTIES WORKING_DIRECTORY /root/repo/build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] TIMEOUT 120)
+add_test([=[bcause.memory_builtins]=]  /root/repo/build/btest [==[--gtest_filter=bcause.memory_builtins]==] --gtest_also_run_disabled_tests [==[--gtest_repeat=1]==])
+set_tests_properties([=[bcause.memory_builtins]=]  PROPERTIES WORKING_DIRECTORY /root/repo/build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] TIMEOUT 120)
+add_test([=[bcause.memory_builtin_named_function]=]  /root/repo/build/btest [==[--gtest_filter=bcause.memory_builtin_named_function]==] --gtest_also_run_disabled_tests [==[--gtest_repeat=1]==])
+set_tests_properties([=[bcause.memory_builtin_named_function]=]  PROPERTIES WORKING_DIRECTORY /root/repo/build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] TIMEOUT 120)
+add_test([=[bcause.string_literals]=]  /root/repo/build/btest [==[--gtest_filter=bcause.string_literals]==] --gtest_also_run_disabled_tests [==[--gtest_repeat=1]==])
+set_tests_properties([=[bcause.string_literals]=]  PROPERTIES WORKING_DIRECTORY /root/repo/build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] TIMEOUT 120)
+add_test([=[bcause.char_literals]=]  /root/repo/build/btest [==[--gtest_filter=bcause.char_literals]==] --gtest_also_run_disabled_tests [==[--gtest_repeat=1]==])
+set_tests_properties([=[bcause.char_literals]=]  PROPERTIES WORKING_DIRECTORY /root/repo/build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] TIMEOUT 120)
+add_test([=[bcause.example_hello_putchar]=]  /root/repo/build/btest [==[--gtest_filter=bcause.example_hello_putchar]==] --gtest_also_run_disabled_tests [==[--gtest_repeat=1]==])
+set_tests_properties([=[bcause.example_hello_putchar]=]  PROPERTIES WORKING_DIRECTORY /root/repo/build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] TIMEOUT 120)
+add_test([=[bcause.example_hello_printf]=]  /root/repo/build/btest [==[--gtest_filter=bcause.example_hello_printf]==] --gtest_also_run_disabled_tests [==[--gtest_repeat=1]==])
+set_tests_properties([=[bcause.example_hello_printf]=]  PROPERTIES WORKING_DIRECTORY /root/repo/build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] TIMEOUT 120)
+add_test([=[bcause.example_e_2]=]  /root/repo/build/btest [==[--gtest_filter=bcause.example_e_2]==] --gtest_also_run_disabled_tests [==[--gtest_repeat=1]==])
+set_tests_properties([=[bcause.example_e_2]=]  PROPERTIES WORKING_DIRECTORY /root/repo/build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] TIMEOUT 120)
+add_test([=[bcause.example_fibonacci]=]  /root/repo/build/btest [==[--gtest_filter=bcause.example_fibonacci]==] --gtest_also_run_disabled_tests [==[--gtest_repeat=1]==])
+set_tests_properties([=[bcause.example_fibonacci]=]  PROPERTIES WORKING_DIRECTORY /root/repo/build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] TIMEOUT 120)
+add_test([=[bcause.example_fizzbuzz]=]  /root/repo/build/btest [==[--gtest_filter=bcause.example_fizzbuzz]==] --gtest_also_run_disabled_tests [==[--gtest_repeat=1]==])
+set_tests_properties([=[bcause.example_fizzbuzz]=]  PROPERTIES WORKING_DIRECTORY /root/repo/build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] TIMEOUT 120)
+add_test([=[bcause.precedence_add_mul]=]  /root/repo/build/btest [==[--gtest_filter=bcause.precedence_add_mul]==] --gtest_also_run_disabled_tests [==[--gtest_repeat=1]==])
+set_tests_properties([=[bcause.precedence_add_mul]=]  PROPERTIES WORKING_DIRECTORY /root/repo/build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] TIMEOUT 120)
+add_test([=[bcause.precedence_mul_add_mul]=]  /root/repo/build/btest [==[--gtest_filter=bcause.precedence_mul_add_mul]==] --gtest_also_run_disabled_tests [==[--gtest_repeat=1]==])
+set_tests_properties([=[bcause.precedence_mul_add_mul]=]  PROPERTIES WORKING_DIRECTORY /root/repo/build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] TIMEOUT 120)
+add_test([=[bcause.precedence_sub_div]=]  /root/repo/build/btest [==[--gtest_filter=bcause.precedence_sub_div]==] --gtest_also_run_disabled_tests [==[--gtest_repeat=1]==])
+set_tests_properties([=[bcause.precedence_sub_div]=]  PROPERTIES WORKING_DIRECTORY /root/repo/build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] TIMEOUT 120)
+add_test([=[bcause.precedence_mod_add]=]  /root/repo/build/btest [==[--gtest_filter=bcause.precedence_mod_add]==] --gtest_also_run_disabled_tests [==[--gtest_repeat=1]==])
+set_tests_properties([=[bcause.precedence_mod_add]=]  PROPERTIES WORKING_DIRECTORY /root/repo/build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] TIMEOUT 120)
+add_test([=[bcause.precedence_add_lt]=]  /root/repo/build/btest [==[--gtest_filter=bcause.precedence_add_lt]==] --gtest_also_run_disabled_tests [==[--gtest_repeat=1]==])
+set_tests_properties([=[bcause.precedence_add_lt]=]  PROPERTIES WORKING_DIRECTORY /root/repo/build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] TIMEOUT 120)
+add_test([=[bcause.precedence_lt_eq]=]  /root/repo/build/btest [==[--gtest_filter=bcause.precedence_lt_eq]==] --gtest_also_run_disabled_tests [==[--gtest_repeat=1]==])
+set_tests_properties([=[bcause.precedence_lt_eq]=]  PROPERTIES WORKING_DIRECTORY /root/repo/build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] TIMEOUT 120)
+add_test([=[bcause.precedence_eq_and]=]  /root/repo/build/btest [==[--gtest_filter=bcause.precedence_eq_and]==] --gtest_also_run_disabled_tests [==[--gtest_repeat=1]==])
+set_tests_properties([=[bcause.precedence_eq_and]=]  PROPERTIES WORKING_DIRECTORY /root/repo/build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] TIMEOUT 120)
+add_test([=[bcause.precedence_and_or]=]  /root/repo/build/btest [==[--gtest_filter=bcause.precedence_and_or]==] --gtest_also_run_disabled_tests [==[--gtest_repeat=1]==])
+set_tests_properties([=[bcause.precedence_and_or]=]  PROPERTIES WORKING_DIRECTORY /root/repo/build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] TIMEOUT 120)
+add_test([=[bcause.precedence_mul_add_lt]=]  /root/repo/build/btest [==[--gtest_filter=bcause.precedence_mul_add_lt]==] --gtest_also_run_disabled_tests [==[--gtest_repeat=1]==])
+set_tests_properties([=[bcause.precedence_mul_add_lt]=]  PROPERTIES WORKING_DIRECTORY /root/repo/build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] TIMEOUT 120)
+add_test([=[bcause.precedence_mul_ge_eq]=]  /root/repo/build/btest [==[--gtest_filter=bcause.precedence_mul_ge_eq]==] --gtest_also_run_disabled_tests [==[--gtest_repeat=1]==])
+set_tests_properties([=[bcause.precedence_mul_ge_eq]=]  PROPERTIES WORKING_DIRECTORY /root/repo/build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] TIMEOUT 120)
+add_test([=[bcause.precedence_mul_and_add]=]  /root/repo/build/btest [==[--gtest_filter=bcause.precedence_mul_and_add]==] --gtest_also_run_disabled_tests [==[--gtest_repeat=1]==])
+set_tests_properties([=[bcause.precedence_mul_and_add]=]  PROPERTIES WORKING_DIRECTORY /root/repo/build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] TIMEOUT 120)
+add_test([=[bcause.precedence_div_add_gt_or]=]  /root/repo/build/btest [==[--gtest_filter=bcause.precedence_div_add_gt_or]==] --gtest_also_run_disabled_tests [==[--gtest_repeat=1]==])
+set_tests_properties([=[bcause.precedence_div_add_gt_or]=]  PROPERTIES WORKING_DIRECTORY /root/repo/build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] TIMEOUT 120)
+add_test([=[bcause.precedence_div_mod]=]  /root/repo/build/btest [==[--gtest_filter=bcause.precedence_div_mod]==] --gtest_also_run_disabled_tests [==[--gtest_repeat=1]==])
+set_tests_properties([=[bcause.precedence_div_mod]=]  PROPERTIES WORKING_DIRECTORY /root/repo/build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] TIMEOUT 120)
+add_test([=[bcause.precedence_mul_or]=]  /root/repo/build/btest [==[--gtest_filter=bcause.precedence_mul_or]==] --gtest_also_run_disabled_tests [==[--gtest_repeat=1]==])
+set_tests_properties([=[bcause.precedence_mul_or]=]  PROPERTIES WORKING_DIRECTORY /root/repo/build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] TIMEOUT 120)
+add_test([=[bcause.precedence_mul_lshift]=]  /root/repo/build/btest [==[--gtest_filter=bcause.precedence_mul_lshift]==] --gtest_also_run_disabled_tests [==[--gtest_repeat=1]==])
+set_tests_properties([=[bcause.precedence_mul_lshift]=]  PROPERTIES WORKING_DIRECTORY /root/repo/build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] TIMEOUT 120)
+add_test([=[bcause.precedence_lshift_lt]=]  /root/repo/build/btest [==[--gtest_filter=bcause.precedence_lshift_lt]==] --gtest_also_run_disabled_tests [==[--gtest_repeat=1]==])
+set_tests_properties([=[bcause.precedence_lshift_lt]=]  PROPERTIES WORKING_DIRECTORY /root/repo/build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] TIMEOUT 120)
+add_test([=[bcause.precedence_sub_rshift]=]  /root/repo/build/btest [==[--gtest_filter=bcause.precedence_sub_rshift]==] --gtest_also_run_disabled_tests [==[--gtest_repeat=1]==])
+set_tests_properties([=[bcause.precedence_sub_rshift]=]  PROPERTIES WORKING_DIRECTORY /root/repo/build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] TIMEOUT 120)
+add_test([=[bcause.precedence_lshift_and]=]  /root/repo/build/btest [==[--gtest_filter=bcause.precedence_lshift_and]==] --gtest_also_run_disabled_tests [==[--gtest_repeat=1]==])
+set_tests_properties([=[bcause.precedence_lshift_and]=]  PROPERTIES WORKING_DIRECTORY /root/repo/build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] TIMEOUT 120)
+add_test([=[bcause.precedence_or_rshift]=]  /root/repo/build/btest [==[--gtest_filter=bcause.precedence_or_rshift]==] --gtest_also_run_disabled_tests [==[--gtest_repeat=1]==])
+set_tests_properties([=[bcause.precedence_or_rshift]=]  PROPERTIES WORKING_DIRECTORY /root/repo/build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] TIMEOUT 120)
+add_test([=[bcause.precedence_rshift_eq]=]  /root/repo/build/btest [==[--gtest_filter=bcause.precedence_rshift_eq]==] --gtest_also_run_disabled_tests [==[--gtest_repeat=1]==])
+set_tests_properties([=[bcause.precedence_rshift_eq]=]  PROPERTIES WORKING_DIRECTORY /root/repo/build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] TIMEOUT 120)
+add_test([=[bcause.precedence_mul_lshift_add]=]  /root/repo/build/btest [==[--gtest_filter=bcause.precedence_mul_lshift_add]==] --gtest_also_run_disabled_tests [==[--gtest_repeat=1]==])
+set_tests_properties([=[bcause.precedence_mul_lshift_add]=]  PROPERTIES WORKING_DIRECTORY /root/repo/build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] TIMEOUT 120)
+add_test([=[bcause.precedence_mod_lshift]=]  /root/repo/build/btest [==[--gtest_filter=bcause.precedence_mod_lshift]==] --gtest_also_run_disabled_tests [==[--gtest_repeat=1]==])
+set_tests_properties([=[bcause.precedence_mod_lshift]=]  PROPERTIES WORKING_DIRECTORY /root/repo/build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] TIMEOUT 120)
+add_test([=[bcause.precedence_lshift_gt_and]=]  /root/repo/build/btest [==[--gtest_filter=bcause.precedence_lshift_gt_and]==] --gtest_also_run_disabled_tests [==[--gtest_repeat=1]==])
+set_tests_properties([=[bcause.precedence_lshift_gt_and]=]  PROPERTIES WORKING_DIRECTORY /root/repo/build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] TIMEOUT 120)
+add_test([=[bcause.precedence_add_lshift]=]  /root/repo/build/btest [==[--gtest_filter=bcause.precedence_add_lshift]==] --gtest_also_run_disabled_tests [==[--gtest_repeat=1]==])
+set_tests_properties([=[bcause.precedence_add_lshift]=]  PROPERTIES WORKING_DIRECTORY /root/repo/build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] TIMEOUT 120)
+add_test([=[bcause.precedence_div_rshift]=]  /root/repo/build/btest [==[--gtest_filter=bcause.precedence_div_rshift]==] --gtest_also_run_disabled_tests [==[--gtest_repeat=1]==])
+set_tests_properties([=[bcause.precedence_div_rshift]=]  PROPERTIES WORKING_DIRECTORY /root/repo/build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] TIMEOUT 120)
+add_test([=[bcause.precedence_and_lshift_or]=]  /root/repo/build/btest [==[--gtest_filter=bcause.precedence_and_lshift_or]==] --gtest_also_run_disabled_tests [==[--gtest_repeat=1]==])
+set_tests_properties([=[bcause.precedence_and_lshift_or]=]  PROPERTIES WORKING_DIRECTORY /root/repo/build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] TIMEOUT 120)
+add_test([=[bcause.precedence_lshift_ne]=]  /root/repo/build/btest [==[--gtest_filter=bcause.precedence_lshift_ne]==] --gtest_also_run_disabled_tests [==[--gtest_repeat=1]==])
+set_tests_properties([=[bcause.precedence_lshift_ne]=]  PROPERTIES WORKING_DIRECTORY /root/repo/build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] TIMEOUT 120)
+add_test([=[bcause.precedence_rshift_ge]=]  /root/repo/build/btest [==[--gtest_filter=bcause.precedence_rshift_ge]==] --gtest_also_run_disabled_tests [==[--gtest_repeat=1]==])
+set_tests_properties([=[bcause.precedence_rshift_ge]=]  PROPERTIES WORKING_DIRECTORY /root/repo/build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] TIMEOUT 120)
+add_test([=[bcause.assign_add]=]  /root/repo/build/btest [==[--gtest_filter=bcause.assign_add]==] --gtest_also_run_disabled_tests [==[--gtest_repeat=1]==])
+set_tests_properties([=[bcause.assign_add]=]  PROPERTIES WORKING_DIRECTORY /root/repo/build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] TIMEOUT 120)
+add_test([=[bcause.assign_subtract]=]  /root/repo/build/btest [==[--gtest_filter=bcause.assign_subtract]==] --gtest_also_run_disabled_tests [==[--gtest_repeat=1]==])
+set_tests_properties([=[bcause.assign_subtract]=]  PROPERTIES WORKING_DIRECTORY /root/repo/build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] TIMEOUT 120)
+add_test([=[bcause.assign_multiply]=]  /root/repo/build/btest [==[--gtest_filter=bcause.assign_multiply]==] --gtest_also_run_disabled_tests [==[--gtest_repeat=1]==])
+set_tests_properties([=[bcause.assign_multiply]=]  PROPERTIES WORKING_DIRECTORY /root/repo/build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] TIMEOUT 120)
+add_test([=[bcause.assign_divide]=]  /root/repo/build/btest [==[--gtest_filter=bcause.assign_divide]==] --gtest_also_run_disabled_tests [==[--gtest_repeat=1]==])
+set_tests_properties([=[bcause.assign_divide]=]  PROPERTIES WORKING_DIRECTORY /root/repo/build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] TIMEOUT 120)
+add_test([=[bcause.assign_modulo]=]  /root/repo/build/btest [==[--gtest_filter=bcause.assign_modulo]==] --gtest_also_run_disabled_tests [==[--gtest_repeat=1]==])
+set_tests_properties([=[bcause.assign_modulo]=]  PROPERTIES WORKING_DIRECTORY /root/repo/build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] TIMEOUT 120)
+add_test([=[bcause.assign_shift_left]=]  /root/repo/build/btest [==[--gtest_filter=bcause.assign_shift_left]==] --gtest_also_run_disabled_tests [==[--gtest_repeat=1]==])
+set_tests_properties([=[bcause.assign_shift_left]=]  PROPERTIES WORKING_DIRECTORY /root/repo/build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] TIMEOUT 120)
+add_test([=[bcause.assign_less_or_equal]=]  /root/repo/build/btest [==[--gtest_filter=bcause.assign_less_or_equal]==] --gtest_also_run_disabled_tests [==[--gtest_repeat=1]==])
+set_tests_properties([=[bcause.assign_less_or_equal]=]  PROPERTIES WORKING_DIRECTORY /root/repo/build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] TIMEOUT 120)
+add_test([=[bcause.assign_less_than]=]  /root/repo/build/btest [==[--gtest_filter=bcause.assign_less_than]==] --gtest_also_run_disabled_tests [==[--gtest_repeat=1]==])
+set_tests_properties([=[bcause.assign_less_than]=]  PROPERTIES WORKING_DIRECTORY /root/repo/build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] TIMEOUT 120)
+add_test([=[bcause.assign_shift_right]=]  /root/repo/build/btest [==[--gtest_filter=bcause.assign_shift_right]==] --gtest_also_run_disabled_tests [==[--gtest_repeat=1]==])
+set_tests_properties([=[bcause.assign_shift_right]=]  PROPERTIES WORKING_DIRECTORY /root/repo/build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] TIMEOUT 120)
+add_test([=[bcause.assign_greater_or_equal]=]  /root/repo/build/btest [==[--gtest_filter=bcause.assign_greater_or_equal]==] --gtest_also_run_disabled_tests [==[--gtest_repeat=1]==])
+set_tests_properties([=[bcause.assign_greater_or_equal]=]  PROPERTIES WORKING_DIRECTORY /root/repo/build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] TIMEOUT 120)
+add_test([=[bcause.assign_greater_than]=]  /root/repo/build/btest [==[--gtest_filter=bcause.assign_greater_than]==] --gtest_also_run_disabled_tests [==[--gtest_repeat=1]==])
+set_tests_properties([=[bcause.assign_greater_than]=]  PROPERTIES WORKING_DIRECTORY /root/repo/build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] TIMEOUT 120)
+add_test([=[bcause.assign_not_equal]=]  /root/repo/build/btest [==[--gtest_filter=bcause.assign_not_equal]==] --gtest_also_run_disabled_tests [==[--gtest_repeat=1]==])
+set_tests_properties([=[bcause.assign_not_equal]=]  PROPERTIES WORKING_DIRECTORY /root/repo/build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] TIMEOUT 120)
+add_test([=[bcause.assign_equal]=]  /root/repo/build/btest [==[--gtest_filter=bcause.assign_equal]==] --gtest_also_run_disabled_tests [==[--gtest_repeat=1]==])
+set_tests_properties([=[bcause.assign_equal]=]  PROPERTIES WORKING_DIRECTORY /root/repo/build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] TIMEOUT 120)
+add_test([=[bcause.assign_and]=]  /root/repo/build/btest [==[--gtest_filter=bcause.assign_and]==] --gtest_also_run_disabled_tests [==[--gtest_repeat=1]==])
+set_tests_properties([=[bcause.assign_and]=]  PROPERTIES WORKING_DIRECTORY /root/repo/build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] TIMEOUT 120)
+add_test([=[bcause.assign_or]=]  /root/repo/build/btest [==[--gtest_filter=bcause.assign_or]==] --gtest_also_run_disabled_tests [==[--gtest_repeat=1]==])
+set_tests_properties([=[bcause.assign_or]=]  PROPERTIES WORKING_DIRECTORY /root/repo/build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] TIMEOUT 120)
+add_test([=[bcause.word32_vectors]=]  /root/repo/build/btest [==[--gtest_filter=bcause.word32_vectors]==] --gtest_also_run_disabled_tests [==[--gtest_repeat=1]==])
+set_tests_properties([=[bcause.word32_vectors]=]  PROPERTIES WORKING_DIRECTORY /root/repo/build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] TIMEOUT 120)
+add_test([=[bcause.word32_example_fibonacci]=]  /root/repo/build/btest [==[--gtest_filter=bcause.word32_example_fibonacci]==] --gtest_also_run_disabled_tests [==[--gtest_repeat=1]==])
+set_tests_properties([=[bcause.word32_example_fibonacci]=]  PROPERTIES WORKING_DIRECTORY /root/repo/build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] TIMEOUT 120)
+add_test([=[bcause.optimization_level_0]=]  /root/repo/build/btest [==[--gtest_filter=bcause.optimization_level_0]==] --gtest_also_run_disabled_tests [==[--gtest_repeat=1]==])
+set_tests_properties([=[bcause.optimization_level_0]=]  PROPERTIES WORKING_DIRECTORY /root/repo/build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] TIMEOUT 120)
+add_test([=[bcause.optimization_level_1]=]  /root/repo/build/btest [==[--gtest_filter=bcause.optimization_level_1]==] --gtest_also_run_disabled_tests [==[--gtest_repeat=1]==])
+set_tests_properties([=[bcause.optimization_level_1]=]  PROPERTIES WORKING_DIRECTORY /root/repo/build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] TIMEOUT 120)
+add_test([=[bcause.optimization_level_2]=]  /root/repo/build/btest [==[--gtest_filter=bcause.optimization_level_2]==] --gtest_also_run_disabled_tests [==[--gtest_repeat=1]==])
+set_tests_properties([=[bcause.optimization_level_2]=]  PROPERTIES WORKING_DIRECTORY /root/repo/build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] TIMEOUT 120)
+add_test([=[bcause.redundant_loads]=]  /root/repo/build/btest [==[--gtest_filter=bcause.redundant_loads]==] --gtest_also_run_disabled_tests [==[--gtest_repeat=1]==])
+set_tests_properties([=[bcause.redundant_loads]=]  PROPERTIES WORKING_DIRECTORY /root/repo/build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] TIMEOUT 120)
+add_test([=[bcause.omit_frame_pointer]=]  /root/repo/build/btest [==[--gtest_filter=bcause.omit_frame_pointer]==] --gtest_also_run_disabled_tests [==[--gtest_repeat=1]==])
+set_tests_properties([=[bcause.omit_frame_pointer]=]  PROPERTIES WORKING_DIRECTORY /root/repo/build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] TIMEOUT 120)
+add_test([=[bcause.unroll_loops]=]  /root/repo/build/btest [==[--gtest_filter=bcause.unroll_loops]==] --gtest_also_run_disabled_tests [==[--gtest_repeat=1]==])
+set_tests_properties([=[bcause.unroll_loops]=]  PROPERTIES WORKING_DIRECTORY /root/repo/build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] TIMEOUT 120)
+add_test([=[bcause.unroll_inner_increment]=]  /root/repo/build/btest [==[--gtest_filter=bcause.unroll_inner_increment]==] --gtest_also_run_disabled_tests [==[--gtest_repeat=1]==])
+set_tests_properties([=[bcause.unroll_inner_increment]=]  PROPERTIES WORKING_DIRECTORY /root/repo/build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] TIMEOUT 120)
+add_test([=[bcause.divide_by_constant]=]  /root/repo/build/btest [==[--gtest_filter=bcause.divide_by_constant]==] --gtest_also_run_disabled_tests [==[--gtest_repeat=1]==])
+set_tests_properties([=[bcause.divide_by_constant]=]  PROPERTIES WORKING_DIRECTORY /root/repo/build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] TIMEOUT 120)
+add_test([=[bcause.specialize]=]  /root/repo/build/btest [==[--gtest_filter=bcause.specialize]==] --gtest_also_run_disabled_tests [==[--gtest_repeat=1]==])
+set_tests_properties([=[bcause.specialize]=]  PROPERTIES WORKING_DIRECTORY /root/repo/build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] TIMEOUT 120)
+add_test([=[bcause.internal_calls]=]  /root/repo/build/btest [==[--gtest_filter=bcause.internal_calls]==] --gtest_also_run_disabled_tests [==[--gtest_repeat=1]==])
+set_tests_properties([=[bcause.internal_calls]=]  PROPERTIES WORKING_DIRECTORY /root/repo/build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] TIMEOUT 120)
+add_test([=[bcause.optimization_record]=]  /root/repo/build/btest [==[--gtest_filter=bcause.optimization_record]==] --gtest_also_run_disabled_tests [==[--gtest_repeat=1]==])
+set_tests_properties([=[bcause.optimization_record]=]  PROPERTIES WORKING_DIRECTORY /root/repo/build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] TIMEOUT 120)
+add_test([=[bcause.bit_test]=]  /root/repo/build/btest [==[--gtest_filter=bcause.bit_test]==] --gtest_also_run_disabled_tests [==[--gtest_repeat=1]==])
+set_tests_properties([=[bcause.bit_test]=]  PROPERTIES WORKING_DIRECTORY /root/repo/build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] TIMEOUT 120)
+add_test([=[bcause.jump_threading]=]  /root/repo/build/btest [==[--gtest_filter=bcause.jump_threading]==] --gtest_also_run_disabled_tests [==[--gtest_repeat=1]==])
+set_tests_properties([=[bcause.jump_threading]=]  PROPERTIES WORKING_DIRECTORY /root/repo/build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] TIMEOUT 120)
+add_test([=[bcause.instruction_selection]=]  /root/repo/build/btest [==[--gtest_filter=bcause.instruction_selection]==] --gtest_also_run_disabled_tests [==[--gtest_repeat=1]==])
+set_tests_properties([=[bcause.instruction_selection]=]  PROPERTIES WORKING_DIRECTORY /root/repo/build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] TIMEOUT 120)
+add_test([=[bcause.incremental_cache]=]  /root/repo/build/btest [==[--gtest_filter=bcause.incremental_cache]==] --gtest_also_run_disabled_tests [==[--gtest_repeat=1]==])
+set_tests_properties([=[bcause.incremental_cache]=]  PROPERTIES WORKING_DIRECTORY /root/repo/build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] TIMEOUT 120)
+add_test([=[bcause.parallel_optimization]=]  /root/repo/build/btest [==[--gtest_filter=bcause.parallel_optimization]==] --gtest_also_run_disabled_tests [==[--gtest_repeat=1]==])
+set_tests_properties([=[bcause.parallel_optimization]=]  PROPERTIES WORKING_DIRECTORY /root/repo/build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] TIMEOUT 120)
+add_test([=[bcause.function_layout]=]  /root/repo/build/btest [==[--gtest_filter=bcause.function_layout]==] --gtest_also_run_disabled_tests [==[--gtest_repeat=1]==])
+set_tests_properties([=[bcause.function_layout]=]  PROPERTIES WORKING_DIRECTORY /root/repo/build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] TIMEOUT 120)
+add_test([=[bcause.branch_hints]=]  /root/repo/build/btest [==[--gtest_filter=bcause.branch_hints]==] --gtest_also_run_disabled_tests [==[--gtest_repeat=1]==])
+set_tests_properties([=[bcause.branch_hints]=]  PROPERTIES WORKING_DIRECTORY /root/repo/build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] TIMEOUT 120)
+add_test([=[bcause.stack_usage]=]  /root/repo/build/btest [==[--gtest_filter=bcause.stack_usage]==] --gtest_also_run_disabled_tests [==[--gtest_repeat=1]==])
+set_tests_properties([=[bcause.stack_usage]=]  PROPERTIES WORKING_DIRECTORY /root/repo/build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] TIMEOUT 120)
+add_test([=[bcause.interpreter]=]  /root/repo/build/btest [==[--gtest_filter=bcause.interpreter]==] --gtest_also_run_disabled_tests [==[--gtest_repeat=1]==])
+set_tests_properties([=[bcause.interpreter]=]  PROPERTIES WORKING_DIRECTORY /root/repo/build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] TIMEOUT 120)
+add_test([=[bcause.emit_bytecode]=]  /root/repo/build/btest [==[--gtest_filter=bcause.emit_bytecode]==] --gtest_also_run_disabled_tests [==[--gtest_repeat=1]==])
+set_tests_properties([=[bcause.emit_bytecode]=]  PROPERTIES WORKING_DIRECTORY /root/repo/build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] TIMEOUT 120)
+add_test([=[bcause.interpreter_exit_status]=]  /root/repo/build/btest [==[--gtest_filter=bcause.interpreter_exit_status]==] --gtest_also_run_disabled_tests [==[--gtest_repeat=1]==])
+set_tests_properties([=[bcause.interpreter_exit_status]=]  PROPERTIES WORKING_DIRECTORY /root/repo/build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] TIMEOUT 120)
+add_test([=[bcause.tiered_execution]=]  /root/repo/build/btest [==[--gtest_filter=bcause.tiered_execution]==] --gtest_also_run_disabled_tests [==[--gtest_repeat=1]==])
+set_tests_properties([=[bcause.tiered_execution]=]  PROPERTIES WORKING_DIRECTORY /root/repo/build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==] TIMEOUT 120)
+set(  btest_TESTS bcause.libb_putchar bcause.libb_printf bcause.libb_exit bcause.libb_char bcause.libb_lchar bcause.libb_nwrite bcause.libb_gather bcause.libb_gather_printf bcause.libb_huge_pages bcause.libb_vector_kernels bcause.global_scalars bcause.global_vectors bcause.local_scalars bcause.local_vectors bcause.global_vectors_direct bcause.function_definitions bcause.function_arguments bcause.function_ternary_operator bcause.function_dead_code bcause.unary_operators bcause.negation_in_conditional_context bcause.postfix_operators bcause.local_array bcause.global_array bcause.local_mix bcause.binary_operators bcause.eq_by_bitmask bcause.octal_literals bcause.conditional_move bcause.builtins bcause.builtin_clz bcause.builtin_named_function bcause.memory_builtins bcause.memory_builtin_named_function bcause.string_literals bcause.char_literals bcause.example_hello_putchar bcause.example_hello_printf bcause.example_e_2 bcause.example_fibonacci bcause.example_fizzbuzz bcause.precedence_add_mul bcause.precedence_mul_add_mul bcause.precedence_sub_div bcause.precedence_mod_add bcause.precedence_add_lt bcause.precedence_lt_eq bcause.precedence_eq_and bcause.precedence_and_or bcause.precedence_mul_add_lt bcause.precedence_mul_ge_eq bcause.precedence_mul_and_add bcause.precedence_div_add_gt_or bcause.precedence_div_mod bcause.precedence_mul_or bcause.precedence_mul_lshift bcause.precedence_lshift_lt bcause.precedence_sub_rshift bcause.precedence_lshift_and bcause.precedence_or_rshift bcause.precedence_rshift_eq bcause.precedence_mul_lshift_add bcause.precedence_mod_lshift bcause.precedence_lshift_gt_and bcause.precedence_add_lshift bcause.precedence_div_rshift bcause.precedence_and_lshift_or bcause.precedence_lshift_ne bcause.precedence_rshift_ge bcause.assign_add bcause.assign_subtract bcause.assign_multiply bcause.assign_divide bcause.assign_modulo bcause.assign_shift_left bcause.assign_less_or_equal bcause.assign_less_than bcause.assign_shift_right bcause.assign_greater_or_equal bcause.assign_greater_than bcause.assign_not_equal bcause.assign_equal bcause.assign_and bcause.assign_or bcause.word32_vectors bcause.word32_example_fibonacci bcause.optimization_level_0 bcause.optimization_level_1 bcause.optimization_level_2 bcause.redundant_loads bcause.omit_frame_pointer bcause.unroll_loops bcause.unroll_inner_increment bcause.divide_by_constant bcause.specialize bcause.internal_calls bcause.optimization_record bcause.bit_test bcause.jump_threading bcause.instruction_selection bcause.incremental_cache bcause.parallel_optimization bcause.function_layout bcause.branch_hints bcause.stack_usage bcause.interpreter bcause.emit_bytecode bcause.interpreter_exit_status bcause.tiered_execution)
@@ -0,0 +1,3 @@
+
+        main() printf("%d %d %d %d*n", clz(0), clz(1), clz(-1), clz(255));
+    
\ No newline at end of file
@@ -0,0 +1,63 @@
+.globl main
+.section .text.sorted.00001,"ax",@progbits
+.align 16
+.type main, @function
+main:
+  sub $8, %rsp
+  sub $4, %rsp
+  lea .string.0(%rip), %rax
+  push %rax
+  xor %rax, %rax
+  mov $-1, %rcx
+  bsr %eax, %eax
+  cmovz %rcx, %rax
+  neg %rax
+  add $31, %rax
+  push %rax
+  mov $1, %rax
+  mov $-1, %rcx
+  bsr %eax, %eax
+  cmovz %rcx, %rax
+  neg %rax
+  add $31, %rax
+  push %rax
+  mov $1, %rax
+  neg %rax
+  mov $-1, %rcx
+  bsr %eax, %eax
+  cmovz %rcx, %rax
+  neg %rax
+  add $31, %rax
+  push %rax
+  mov $255, %rax
+  mov $-1, %rcx
+  bsr %eax, %eax
+  cmovz %rcx, %rax
+  neg %rax
+  add $31, %rax
+  push %rax
+  pop %r8
+  pop %rcx
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  call printf
+  movslq %eax, %rax
+  xor %rax, %rax
+  add $12, %rsp
+  ret
+.section .rodata
+.string.0:
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 10
+  .byte 0
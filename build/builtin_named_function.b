@@ -0,0 +1,5 @@
+
+        main() printf("%d %d*n", bswap(1), popcnt(255));
+
+        bswap(x) return (x + 1);
+    
\ No newline at end of file
@@ -0,0 +1,66 @@
+.globl main
+.section .text.sorted.00001,"ax",@progbits
+.align 16
+.type main, @function
+main:
+  sub $8, %rsp
+  sub $8, %rsp
+  lea .string.0(%rip), %rax
+  push %rax
+  mov $1, %rax
+  push %rax
+  call bswap.internal
+  add $8, %rsp
+  push %rax
+  mov $255, %rax
+  mov %rax, %rcx
+  shr $1, %rcx
+  movabs $6148914691236517205, %rdx
+  and %rdx, %rcx
+  sub %rcx, %rax
+  movabs $3689348814741910323, %rdx
+  mov %rax, %rcx
+  shr $2, %rax
+  and %rdx, %rcx
+  and %rdx, %rax
+  add %rcx, %rax
+  mov %rax, %rcx
+  shr $4, %rcx
+  add %rcx, %rax
+  movabs $1085102592571150095, %rdx
+  and %rdx, %rax
+  movabs $72340172838076673, %rdx
+  imul %rdx, %rax
+  shr $56, %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  call printf
+  xor %rax, %rax
+  add $16, %rsp
+  ret
+.globl bswap
+.section .text.sorted.00002,"ax",@progbits
+.type bswap, @function
+bswap:
+  push %rdi
+  call bswap.internal
+  add $8, %rsp
+  ret
+.section .text.sorted.00002,"ax",@progbits
+.align 16
+.type bswap.internal, @function
+bswap.internal:
+  mov 8(%rsp), %rax
+  add $1, %rax
+  ret
+.section .rodata
+.string.0:
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 10
+  .byte 0
@@ -0,0 +1,13 @@
+
+        clz(x) return (-1);
+
+        main() {
+            extrn clz;
+
+            printf("%d %d %d*n", popcnt(0), popcnt(255), popcnt(-1));
+            printf("%d %d %d*n", ctz(0), ctz(1), ctz(-8));
+            printf("%d %d %d*n", bswap(1) == 1 << 56, rotl(-2, 1), rotl(3, 63));
+            printf("%d %d %d*n", mulhi(-1, -1), mulhi(1 << 40, 1 << 40), mulhi(3, 5));
+            printf("%d*n", clz(1));
+        }
+    
\ No newline at end of file
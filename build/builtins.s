@@ -0,0 +1,190 @@
+.globl clz
+.section .text.sorted.00002,"ax",@progbits
+.type clz, @function
+clz:
+  push %rdi
+  call clz.internal
+  add $8, %rsp
+  ret
+.section .text.sorted.00002,"ax",@progbits
+.align 16
+.type clz.internal, @function
+clz.internal:
+  mov $1, %rax
+  neg %rax
+  ret
+.globl main
+.section .text.sorted.00001,"ax",@progbits
+.align 16
+.type main, @function
+main:
+  sub $8, %rsp
+  sub $8, %rsp
+  lea .string.0(%rip), %rax
+  push %rax
+  xor %rax, %rax
+  popcnt %rax, %rax
+  push %rax
+  mov $255, %rax
+  popcnt %rax, %rax
+  push %rax
+  mov $1, %rax
+  neg %rax
+  popcnt %rax, %rax
+  push %rax
+  pop %rcx
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  call printf
+  lea .string.1(%rip), %rax
+  push %rax
+  xor %rax, %rax
+  tzcnt %rax, %rax
+  push %rax
+  mov $1, %rax
+  tzcnt %rax, %rax
+  push %rax
+  mov $8, %rax
+  neg %rax
+  tzcnt %rax, %rax
+  push %rax
+  pop %rcx
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  call printf
+  lea .string.2(%rip), %rax
+  push %rax
+  mov $1, %rax
+  bswap %rax
+  push %rax
+  mov $1, %rax
+  shl $56, %rax
+  pop %rdi
+  cmp %rax, %rdi
+  sete %al
+  movzb %al, %rax
+  push %rax
+  mov $2, %rax
+  neg %rax
+  push %rax
+  mov $1, %rax
+  mov %rax, %rcx
+  pop %rax
+  rol %cl, %rax
+  push %rax
+  mov $3, %rax
+  push %rax
+  mov $63, %rax
+  mov %rax, %rcx
+  pop %rax
+  rol %cl, %rax
+  push %rax
+  pop %rcx
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  call printf
+  lea .string.3(%rip), %rax
+  push %rax
+  mov $1, %rax
+  neg %rax
+  push %rax
+  mov $1, %rax
+  neg %rax
+  pop %rdi
+  mul %rdi
+  mov %rdx, %rax
+  push %rax
+  mov $1, %rax
+  push %rax
+  mov $40, %rax
+  mov %rax, %rcx
+  pop %rax
+  shl %cl, %rax
+  push %rax
+  mov $1, %rax
+  push %rax
+  mov $40, %rax
+  pop %rax
+  shl %cl, %rax
+  pop %rdi
+  mul %rdi
+  mov %rdx, %rax
+  push %rax
+  mov $3, %rax
+  push %rax
+  mov $5, %rax
+  pop %rdi
+  mul %rdi
+  mov %rdx, %rax
+  push %rax
+  pop %rcx
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  call printf
+  lea .string.4(%rip), %rax
+  push %rax
+  mov $1, %rax
+  push %rax
+  call clz.internal
+  add $8, %rsp
+  push %rax
+  pop %rsi
+  pop %rdi
+  call printf
+  xor %rax, %rax
+  add $16, %rsp
+  ret
+.section .rodata
+.string.0:
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 10
+  .byte 0
+.string.1:
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 10
+  .byte 0
+.string.2:
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 10
+  .byte 0
+.string.3:
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 10
+  .byte 0
+.string.4:
+  .byte 37
+  .byte 100
+  .byte 10
+  .byte 0
@@ -0,0 +1,16 @@
+
+        ca '*t*0x';
+        cb 'foo*ebar';
+        cc 'bar';
+
+        main() {
+            extrn sa, sb;
+
+            printf("%d*n", '*0');
+            printf("%d*n", '*e');
+            printf("%d*n", '*t');
+            printf("%d*n", '*n');
+            printf("%d*n", '*r');
+            printf("%c*n", '*(*)***'*"');
+        }
+    
\ No newline at end of file
@@ -0,0 +1,83 @@
+.globl main
+.section .text.sorted.00001,"ax",@progbits
+.align 16
+.type main, @function
+main:
+  sub $8, %rsp
+  sub $8, %rsp
+  lea .string.0(%rip), %rax
+  push %rax
+  xor %rax, %rax
+  push %rax
+  pop %rsi
+  pop %rdi
+  call printf
+  lea .string.1(%rip), %rax
+  push %rax
+  xor %rax, %rax
+  push %rax
+  pop %rsi
+  pop %rdi
+  call printf
+  lea .string.2(%rip), %rax
+  push %rax
+  mov $9, %rax
+  push %rax
+  pop %rsi
+  pop %rdi
+  call printf
+  lea .string.3(%rip), %rax
+  push %rax
+  mov $10, %rax
+  push %rax
+  pop %rsi
+  pop %rdi
+  call printf
+  lea .string.4(%rip), %rax
+  push %rax
+  mov $13, %rax
+  push %rax
+  pop %rsi
+  pop %rdi
+  call printf
+  lea .string.5(%rip), %rax
+  push %rax
+  mov $146685962536, %rax
+  push %rax
+  pop %rsi
+  pop %rdi
+  call printf
+  xor %rax, %rax
+  add $16, %rsp
+  ret
+.section .rodata
+.string.0:
+  .byte 37
+  .byte 100
+  .byte 10
+  .byte 0
+.string.1:
+  .byte 37
+  .byte 100
+  .byte 10
+  .byte 0
+.string.2:
+  .byte 37
+  .byte 100
+  .byte 10
+  .byte 0
+.string.3:
+  .byte 37
+  .byte 100
+  .byte 10
+  .byte 0
+.string.4:
+  .byte 37
+  .byte 100
+  .byte 10
+  .byte 0
+.string.5:
+  .byte 37
+  .byte 99
+  .byte 10
+  .byte 0
@@ -0,0 +1,14 @@
+
+        abs(x) return (x < 0 ? -x : x);
+        max(a, b) return (a > b ? a : b);
+        deref(p) return (p ? *p : -1);
+
+        main() {
+            auto x;
+
+            x = 42;
+            printf("%d %d*n", abs(-5), abs(7));
+            printf("%d %d*n", max(3, 9), max(9, 3));
+            printf("%d %d*n", deref(&x), deref(0));
+        }
+    
\ No newline at end of file
@@ -0,0 +1,165 @@
+.globl abs
+.section .text.sorted.00001,"ax",@progbits
+.type abs, @function
+abs:
+  push %rdi
+  call abs.internal
+  add $8, %rsp
+  ret
+.section .text.sorted.00001,"ax",@progbits
+.align 16
+.type abs.internal, @function
+abs.internal:
+  mov 8(%rsp), %rax
+  test %rax, %rax
+  setl %al
+  movzb %al, %rax
+  mov %rax, -16(%rsp)
+  mov 8(%rsp), %rax
+  neg %rax
+  mov %rax, %rdi
+  mov 8(%rsp), %rax
+  mov -16(%rsp), %rcx
+  cmp $0, %rcx
+  cmovne %rdi, %rax
+  ret
+.globl max
+.section .text.sorted.00003,"ax",@progbits
+.type max, @function
+max:
+  push %rdi
+  push %rsi
+  call max.internal
+  add $16, %rsp
+  ret
+.section .text.sorted.00003,"ax",@progbits
+.align 16
+.type max.internal, @function
+max.internal:
+  mov 16(%rsp), %rax
+  cmp 8(%rsp), %rax
+  setg %al
+  movzb %al, %rax
+  mov %rax, -16(%rsp)
+  mov 16(%rsp), %rax
+  mov %rax, %rdi
+  mov 8(%rsp), %rax
+  mov -16(%rsp), %rcx
+  cmp $0, %rcx
+  cmovne %rdi, %rax
+  ret
+.globl deref
+.section .text.sorted.00004,"ax",@progbits
+.type deref, @function
+deref:
+  push %rdi
+  call deref.internal
+  add $8, %rsp
+  ret
+.section .text.sorted.00004,"ax",@progbits
+.align 16
+.type deref.internal, @function
+deref.internal:
+  mov 8(%rsp), %rax
+  test %rax, %rax
+  je .L.cond.else.5
+  mov (%rax), %rax
+  jmp .L.return.deref.internal
+.L.cond.else.5:
+  mov $1, %rax
+  neg %rax
+.L.return.deref.internal:
+  ret
+.globl main
+.section .text.sorted.00002,"ax",@progbits
+.align 16
+.type main, @function
+main:
+  sub $8, %rsp
+  sub $8, %rsp
+  sub $8, %rsp
+  sub $8, %rsp
+  mov $42, %rax
+  mov %rax, 8(%rsp)
+  lea .string.0(%rip), %rax
+  push %rax
+  mov $5, %rax
+  neg %rax
+  push %rax
+  call abs.internal
+  add $8, %rsp
+  push %rax
+  mov $7, %rax
+  push %rax
+  call abs.internal
+  add $8, %rsp
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  call printf
+  lea .string.1(%rip), %rax
+  push %rax
+  mov $3, %rax
+  push %rax
+  mov $9, %rax
+  push %rax
+  call max.internal
+  add $16, %rsp
+  push %rax
+  mov $9, %rax
+  push %rax
+  mov $3, %rax
+  push %rax
+  call max.internal
+  add $16, %rsp
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  call printf
+  lea .string.2(%rip), %rax
+  push %rax
+  lea 16(%rsp), %rax
+  push %rax
+  call deref.internal
+  add $8, %rsp
+  push %rax
+  xor %rax, %rax
+  push %rax
+  call deref.internal
+  add $8, %rsp
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  call printf
+  add $16, %rsp
+  xor %rax, %rax
+  add $16, %rsp
+  ret
+.section .rodata
+.string.0:
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 10
+  .byte 0
+.string.1:
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 10
+  .byte 0
+.string.2:
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 10
+  .byte 0
@@ -0,0 +1,11 @@
+
+        main() {
+            auto x;
+
+            x = -12345;
+            printf("%d %d %d %d ", x / 10, x % 10, x / 8, x % 8);
+            printf("%d %d*n", x / 7, x % 7);
+            x = 98765;
+            printf("%d %d %d %d*n", x / 10, x % 10, x / 16, x % 16);
+        }
+    
\ No newline at end of file
@@ -0,0 +1,192 @@
+.globl main
+.section .text.sorted.00001,"ax",@progbits
+.align 16
+.type main, @function
+main:
+  sub $8, %rsp
+  sub $8, %rsp
+  sub $8, %rsp
+  sub $8, %rsp
+  mov $12345, %rax
+  neg %rax
+  mov %rax, 8(%rsp)
+  lea .string.0(%rip), %rax
+  push %rax
+  mov 16(%rsp), %rax
+  push %rax
+  pop %rax
+  mov %rax, %rcx
+  movabs $7378697629483820647, %rdx
+  imul %rdx
+  sar $2, %rdx
+  mov %rcx, %rax
+  shr $63, %rax
+  add %rdx, %rax
+  push %rax
+  mov 24(%rsp), %rax
+  push %rax
+  pop %rax
+  mov %rax, %rcx
+  movabs $7378697629483820647, %rdx
+  imul %rdx
+  sar $2, %rdx
+  mov %rcx, %rax
+  shr $63, %rax
+  add %rdx, %rax
+  imul $10, %rax
+  sub %rax, %rcx
+  mov %rcx, %rax
+  push %rax
+  mov 32(%rsp), %rax
+  push %rax
+  pop %rax
+  mov %rax, %rdx
+  sar $63, %rdx
+  shr $61, %rdx
+  add %rax, %rdx
+  sar $3, %rdx
+  mov %rdx, %rax
+  push %rax
+  mov 40(%rsp), %rax
+  push %rax
+  pop %rax
+  mov %rax, %rdx
+  sar $63, %rdx
+  shr $61, %rdx
+  add %rax, %rdx
+  and $-8, %rdx
+  sub %rdx, %rax
+  push %rax
+  pop %r8
+  pop %rcx
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  call printf
+  lea .string.1(%rip), %rax
+  push %rax
+  mov 16(%rsp), %rax
+  push %rax
+  pop %rax
+  mov %rax, %rcx
+  movabs $5270498306774157605, %rdx
+  imul %rdx
+  sar $1, %rdx
+  mov %rcx, %rax
+  shr $63, %rax
+  add %rdx, %rax
+  push %rax
+  mov 24(%rsp), %rax
+  push %rax
+  pop %rax
+  mov %rax, %rcx
+  movabs $5270498306774157605, %rdx
+  imul %rdx
+  sar $1, %rdx
+  mov %rcx, %rax
+  shr $63, %rax
+  add %rdx, %rax
+  imul $7, %rax
+  sub %rax, %rcx
+  mov %rcx, %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  call printf
+  mov $98765, %rax
+  mov %rax, 8(%rsp)
+  lea .string.2(%rip), %rax
+  push %rax
+  mov 16(%rsp), %rax
+  push %rax
+  pop %rax
+  mov %rax, %rcx
+  movabs $7378697629483820647, %rdx
+  imul %rdx
+  sar $2, %rdx
+  mov %rcx, %rax
+  shr $63, %rax
+  add %rdx, %rax
+  push %rax
+  mov 24(%rsp), %rax
+  push %rax
+  pop %rax
+  mov %rax, %rcx
+  movabs $7378697629483820647, %rdx
+  imul %rdx
+  sar $2, %rdx
+  mov %rcx, %rax
+  shr $63, %rax
+  add %rdx, %rax
+  imul $10, %rax
+  sub %rax, %rcx
+  mov %rcx, %rax
+  push %rax
+  mov 32(%rsp), %rax
+  push %rax
+  pop %rax
+  mov %rax, %rdx
+  sar $63, %rdx
+  shr $60, %rdx
+  add %rax, %rdx
+  sar $4, %rdx
+  mov %rdx, %rax
+  push %rax
+  mov 40(%rsp), %rax
+  push %rax
+  pop %rax
+  mov %rax, %rdx
+  sar $63, %rdx
+  shr $60, %rdx
+  add %rax, %rdx
+  and $-16, %rdx
+  sub %rdx, %rax
+  push %rax
+  pop %r8
+  pop %rcx
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  call printf
+  add $16, %rsp
+  xor %rax, %rax
+  add $16, %rsp
+  ret
+.section .rodata
+.string.0:
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 0
+.string.1:
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 10
+  .byte 0
+.string.2:
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 10
+  .byte 0
@@ -0,0 +1,13 @@
+
+
+        main() {
+            auto cval;
+
+            cval = 51;
+            if ((cval & 017777) == cval) {
+                printf("Small positive: %d*n", cval);
+            } else {
+                printf("Wrong: %d*n", cval);
+            }
+        }
+    
\ No newline at end of file
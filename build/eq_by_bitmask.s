@@ -0,0 +1,72 @@
+.globl main
+.section .text.sorted.00001,"ax",@progbits
+.align 16
+.type main, @function
+main:
+  sub $8, %rsp
+  sub $8, %rsp
+  sub $8, %rsp
+  sub $8, %rsp
+  mov $51, %rax
+  mov %rax, 8(%rsp)
+  push %rax
+  mov $8191, %rax
+  pop %rdi
+  and %rdi, %rax
+  push %rax
+  mov %rdi, %rax
+  pop %rdi
+  cmp %rax, %rdi
+  sete %al
+  movzb %al, %rax
+  test %rax, %rax
+  je .L.else.1
+  lea .string.0(%rip), %rax
+  jmp .L.tail.main.0
+.L.else.1:
+  lea .string.1(%rip), %rax
+.L.tail.main.0:
+  push %rax
+  mov 16(%rsp), %rax
+  push %rax
+  pop %rsi
+  pop %rdi
+  call printf
+  add $16, %rsp
+  xor %rax, %rax
+  add $16, %rsp
+  ret
+.section .rodata
+.string.0:
+  .byte 83
+  .byte 109
+  .byte 97
+  .byte 108
+  .byte 108
+  .byte 32
+  .byte 112
+  .byte 111
+  .byte 115
+  .byte 105
+  .byte 116
+  .byte 105
+  .byte 118
+  .byte 101
+  .byte 58
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 10
+  .byte 0
+.string.1:
+  .byte 87
+  .byte 114
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 58
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 10
+  .byte 0
@@ -0,0 +1,174 @@
+.globl main
+.section .text.sorted.00001,"ax",@progbits
+.align 16
+.type main, @function
+main:
+  sub $8, %rsp
+  sub $8, %rsp
+  sub $8, %rsp
+  sub $8, %rsp
+  sub $8, %rsp
+  sub $8, %rsp
+  xor %rax, %rax
+  mov %rax, 8(%rsp)
+  mov %rax, 24(%rsp)
+.align 16
+.L.start.4:
+  mov 24(%rsp), %rax
+  cmp n(%rip), %rax
+  setl %al
+  movzb %al, %rax
+  test %rax, %rax
+  je .L.end.4
+  lea 24(%rsp), %rax
+  mov (%rax), %rcx
+  addq $1, (%rax)
+  mov %rcx, %rax
+  lea v+8(%rip), %rdi
+  lea (%rdi,%rax,8), %rax
+  push %rax
+  mov $1, %rax
+  pop %rdi
+  mov %rax, (%rdi)
+  jmp .L.start.4
+.align 16
+.L.end.4:
+.L.start.5:
+  mov 8(%rsp), %rax
+  push %rax
+  mov $2, %rax
+  imul n(%rip), %rax
+  pop %rdi
+  cmp %rax, %rdi
+  setl %al
+  movzb %al, %rax
+  test %rax, %rax
+  je .L.end.5
+  mov n(%rip), %rax
+  add $1, %rax
+  mov %rax, 0(%rsp)
+  xor %rax, %rax
+  mov %rax, 24(%rsp)
+  mov %rax, 16(%rsp)
+.align 16
+.L.start.6:
+  mov 24(%rsp), %rax
+  cmp n(%rip), %rax
+  setl %al
+  movzb %al, %rax
+  test %rax, %rax
+  je .L.end.6
+  mov 24(%rsp), %rax
+  lea v+8(%rip), %rdi
+  mov (%rdi,%rax,8), %rax
+  imul $10, %rax
+  add %rax, 16(%rsp)
+  lea 24(%rsp), %rax
+  mov (%rax), %rcx
+  addq $1, (%rax)
+  mov %rcx, %rax
+  lea v+8(%rip), %rdi
+  lea (%rdi,%rax,8), %rax
+  push %rax
+  mov 24(%rsp), %rax
+  push %rax
+  mov 16(%rsp), %rax
+  mov %rax, %rdi
+  pop %rax
+  cqo
+  idiv %rdi
+  mov %rdx, %rax
+  pop %rdi
+  mov %rax, (%rdi)
+  lea 16(%rsp), %rax
+  push %rax
+  mov (%rax), %rax
+  push %rax
+  lea 16(%rsp), %rax
+  mov (%rax), %rcx
+  subq $1, (%rax)
+  mov %rcx, %rax
+  mov %rax, %rdi
+  pop %rax
+  cqo
+  idiv %rdi
+  pop %rdi
+  mov %rax, (%rdi)
+  jmp .L.start.6
+.L.end.6:
+  mov 16(%rsp), %rax
+  add $48, %rax
+  push %rax
+  pop %rdi
+  call putchar
+  lea 8(%rsp), %rax
+  mov (%rax), %rdi
+  add $1, %rdi
+  mov %rdi, (%rax)
+  mov %rdi, %rax
+  push %rax
+  pop %rax
+  mov %rax, %rcx
+  movabs $7378697629483820647, %rdx
+  imul %rdx
+  sar $1, %rdx
+  mov %rcx, %rax
+  shr $63, %rax
+  add %rdx, %rax
+  imul $5, %rax
+  sub %rax, %rcx
+  mov %rcx, %rax
+  test %rax, %rax
+  sete %al
+  movzx %al, %rax
+  test %rax, %rax
+  je .L.start.5
+  mov 8(%rsp), %rax
+  push %rax
+  pop %rax
+  mov %rax, %rcx
+  movabs $-6640827866535438581, %rdx
+  imul %rdx
+  add %rcx, %rdx
+  sar $5, %rdx
+  mov %rcx, %rax
+  shr $63, %rax
+  add %rdx, %rax
+  imul $50, %rax
+  sub %rax, %rcx
+  mov %rcx, %rax
+  push %rax
+  mov $32, %rax
+  push %rax
+  mov $10, %rax
+  pop %rdi
+  pop %rcx
+  cmp $0, %rcx
+  cmovne %rdi, %rax
+  push %rax
+  pop %rdi
+  call putchar
+  jmp .L.start.5
+.L.end.5:
+  mov $2570, %rax
+  push %rax
+  pop %rdi
+  call putchar
+  add $32, %rsp
+  xor %rax, %rax
+  add $16, %rsp
+  ret
+.globl v
+.data
+.type v, @object
+.align 8
+v:
+  .quad .+8
+  .zero 16000
+.globl n
+.data
+.type n, @object
+.align 8
+n:
+  .quad 2000
+.section .rodata
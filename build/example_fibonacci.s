@@ -0,0 +1,70 @@
+.globl n
+.data
+.type n, @object
+.align 8
+n:
+  .quad 10
+.globl main
+.section .text.sorted.00001,"ax",@progbits
+.align 16
+.type main, @function
+main:
+  sub $8, %rsp
+  sub $8, %rsp
+  lea .string.0(%rip), %rax
+  push %rax
+  mov n(%rip), %rax
+  push %rax
+  call fib.internal
+  add $8, %rsp
+  push %rax
+  pop %rsi
+  pop %rdi
+  call printf
+  xor %rax, %rax
+  add $16, %rsp
+  ret
+.globl fib
+.section .text.sorted.00002,"ax",@progbits
+.type fib, @function
+fib:
+  push %rdi
+  call fib.internal
+  add $8, %rsp
+  ret
+.section .text.sorted.00002,"ax",@progbits
+.align 16
+.type fib.internal, @function
+fib.internal:
+  mov $1, %rax
+  mov %rax, -24(%rsp)
+  xor %rax, %rax
+  mov %rax, -40(%rsp)
+.align 16
+.L.start.1:
+  lea -40(%rsp), %rax
+  mov (%rax), %rcx
+  addq $1, (%rax)
+  mov %rcx, %rax
+  cmp 8(%rsp), %rax
+  setl %al
+  movzb %al, %rax
+  test %rax, %rax
+  je .L.end.1
+  mov -16(%rsp), %rax
+  add -24(%rsp), %rax
+  mov %rax, -32(%rsp)
+  mov -24(%rsp), %rax
+  mov %rax, -16(%rsp)
+  mov -32(%rsp), %rax
+  mov %rax, -24(%rsp)
+  jmp .L.start.1
+.L.end.1:
+  mov -16(%rsp), %rax
+  ret
+.section .rodata
+.string.0:
+  .byte 37
+  .byte 100
+  .byte 10
+  .byte 0
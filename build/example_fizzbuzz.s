@@ -0,0 +1,123 @@
+.globl n
+.data
+.type n, @object
+.align 8
+n:
+  .quad 100
+.globl main
+.section .text.sorted.00001,"ax",@progbits
+.align 16
+.type main, @function
+main:
+  sub $8, %rsp
+  sub $8, %rsp
+  sub $8, %rsp
+  sub $8, %rsp
+.align 16
+.L.start.4:
+  lea 8(%rsp), %rax
+  mov (%rax), %rcx
+  addq $1, (%rax)
+  mov %rcx, %rax
+  cmp n(%rip), %rax
+  setl %al
+  movzb %al, %rax
+  test %rax, %rax
+  je .L.end.4
+  xor %rax, %rax
+  push %rax
+  mov 16(%rsp), %rax
+  push %rax
+  pop %rax
+  mov %rax, %rcx
+  movabs $-8608480567731124087, %rdx
+  imul %rdx
+  add %rcx, %rdx
+  sar $3, %rdx
+  mov %rcx, %rax
+  shr $63, %rax
+  add %rdx, %rax
+  imul $15, %rax
+  sub %rax, %rcx
+  mov %rcx, %rax
+  pop %rdi
+  cmp %rax, %rdi
+  sete %al
+  movzb %al, %rax
+  test %rax, %rax
+  je .L.else.5
+  mov $8825495348169042246, %rax
+.align 16
+.L.tail.main.0:
+.L.tail.main.1:
+  push %rax
+  pop %rdi
+  call putchar
+  jmp .L.end.5
+.L.else.5:
+  xor %rax, %rax
+  push %rax
+  mov 16(%rsp), %rax
+  push %rax
+  pop %rax
+  mov %rax, %rcx
+  movabs $6148914691236517206, %rdx
+  imul %rdx
+  mov %rcx, %rax
+  shr $63, %rax
+  add %rdx, %rax
+  imul $3, %rax
+  sub %rax, %rcx
+  mov %rcx, %rax
+  pop %rdi
+  cmp %rax, %rdi
+  sete %al
+  movzb %al, %rax
+  test %rax, %rax
+  je .L.else.6
+  mov $2054842694, %rax
+  jmp .L.tail.main.0
+.L.else.6:
+  xor %rax, %rax
+  push %rax
+  mov 16(%rsp), %rax
+  push %rax
+  pop %rax
+  mov %rax, %rcx
+  movabs $7378697629483820647, %rdx
+  imul %rdx
+  sar $1, %rdx
+  mov %rcx, %rax
+  shr $63, %rax
+  add %rdx, %rax
+  imul $5, %rax
+  sub %rax, %rcx
+  mov %rcx, %rax
+  pop %rdi
+  cmp %rax, %rdi
+  sete %al
+  movzb %al, %rax
+  test %rax, %rax
+  je .L.else.7
+  mov $2054845762, %rax
+  jmp .L.tail.main.1
+.L.else.7:
+  mov 8(%rsp), %rax
+  push %rax
+  mov $10, %rax
+  push %rax
+  pop %rsi
+  pop %rdi
+  call printn
+.L.end.5:
+  mov $10, %rax
+  push %rax
+  pop %rdi
+  call putchar
+  jmp .L.start.4
+.L.end.4:
+  add $16, %rsp
+  xor %rax, %rax
+  add $16, %rsp
+  ret
+.section .rodata
@@ -0,0 +1,7 @@
+/* The following program will print 'Hello World' to stdout. */
+
+main() {
+    extrn printf;
+
+    printf("Hello, World!*n");
+}
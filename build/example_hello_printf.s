@@ -0,0 +1,31 @@
+.globl main
+.section .text.sorted.00001,"ax",@progbits
+.align 16
+.type main, @function
+main:
+  sub $8, %rsp
+  sub $8, %rsp
+  lea .string.0(%rip), %rax
+  push %rax
+  pop %rdi
+  call printf
+  xor %rax, %rax
+  add $16, %rsp
+  ret
+.section .rodata
+.string.0:
+  .byte 72
+  .byte 101
+  .byte 108
+  .byte 108
+  .byte 111
+  .byte 44
+  .byte 32
+  .byte 87
+  .byte 111
+  .byte 114
+  .byte 108
+  .byte 100
+  .byte 33
+  .byte 10
+  .byte 0
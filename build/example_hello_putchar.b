@@ -0,0 +1,6 @@
+
+        main() {
+            putchar('Hello, W');
+            putchar('orld!*n');
+        }
+    
\ No newline at end of file
@@ -0,0 +1,19 @@
+.globl main
+.section .text.sorted.00001,"ax",@progbits
+.align 16
+.type main, @function
+main:
+  sub $8, %rsp
+  sub $8, %rsp
+  mov $6278066737626506568, %rax
+  push %rax
+  pop %rdi
+  call putchar
+  mov $11138535027311, %rax
+  push %rax
+  pop %rdi
+  call putchar
+  xor %rax, %rax
+  add $16, %rsp
+  ret
+.section .rodata
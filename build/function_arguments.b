@@ -0,0 +1,10 @@
+
+        func(a, b, c)
+        {
+            printf("a = %d, b = '%c', c = *"%s*"*n", a, b, c);
+        }
+
+        main() {
+            func(123, 'foo', "bar");
+        }
+    
\ No newline at end of file
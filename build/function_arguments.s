@@ -0,0 +1,84 @@
+.globl func
+.section .text.sorted.00002,"ax",@progbits
+.type func, @function
+func:
+  push %rdi
+  push %rsi
+  push %rdx
+  call func.internal
+  add $24, %rsp
+  ret
+.section .text.sorted.00002,"ax",@progbits
+.align 16
+.type func.internal, @function
+func.internal:
+  sub $8, %rsp
+  lea .string.0(%rip), %rax
+  push %rax
+  mov 40(%rsp), %rax
+  push %rax
+  mov 40(%rsp), %rax
+  push %rax
+  mov 40(%rsp), %rax
+  push %rax
+  pop %rcx
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  call printf
+  xor %rax, %rax
+  add $8, %rsp
+  ret
+.globl main
+.section .text.sorted.00001,"ax",@progbits
+.align 16
+.type main, @function
+main:
+  sub $8, %rsp
+  sub $8, %rsp
+  mov $123, %rax
+  push %rax
+  mov $7303014, %rax
+  push %rax
+  lea .string.1(%rip), %rax
+  push %rax
+  call func.internal
+  add $24, %rsp
+  xor %rax, %rax
+  add $16, %rsp
+  ret
+.section .rodata
+.string.0:
+  .byte 97
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 44
+  .byte 32
+  .byte 98
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 39
+  .byte 37
+  .byte 99
+  .byte 39
+  .byte 44
+  .byte 32
+  .byte 99
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 34
+  .byte 37
+  .byte 115
+  .byte 34
+  .byte 10
+  .byte 0
+.string.1:
+  .byte 98
+  .byte 97
+  .byte 114
+  .byte 0
@@ -0,0 +1,20 @@
+
+        unused() {
+            printf("never called*n");
+        }
+
+        pick(a, b) {
+            auto ignored;
+
+            ignored = a * b;
+            if (a)
+                return (a);
+            else
+                return (b);
+            printf("unreachable*n");
+        }
+
+        main() {
+            printf("%d %d*n", pick(0, 5), pick(7, 5));
+        }
+    
\ No newline at end of file
@@ -0,0 +1,91 @@
+.globl pick
+.section .text.sorted.00002,"ax",@progbits
+.type pick, @function
+pick:
+  push %rdi
+  push %rsi
+  call pick.internal
+  add $16, %rsp
+  ret
+.section .text.sorted.00002,"ax",@progbits
+.align 16
+.type pick.internal, @function
+pick.internal:
+  mov 16(%rsp), %rax
+  mov %rax, %rdi
+  mov 8(%rsp), %rax
+  imul %rdi, %rax
+  mov %rdi, %rax
+  test %rax, %rax
+  jne .L.return.pick.internal
+  mov 8(%rsp), %rax
+.L.return.pick.internal:
+  ret
+.globl main
+.section .text.sorted.00001,"ax",@progbits
+.align 16
+.type main, @function
+main:
+  sub $8, %rsp
+  sub $8, %rsp
+  lea .string.2(%rip), %rax
+  push %rax
+  xor %rax, %rax
+  push %rax
+  mov $5, %rax
+  push %rax
+  call pick.internal
+  add $16, %rsp
+  push %rax
+  mov $7, %rax
+  push %rax
+  mov $5, %rax
+  push %rax
+  call pick.internal
+  add $16, %rsp
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  call printf
+  xor %rax, %rax
+  add $16, %rsp
+  ret
+.section .rodata
+.string.0:
+  .byte 110
+  .byte 101
+  .byte 118
+  .byte 101
+  .byte 114
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 108
+  .byte 108
+  .byte 101
+  .byte 100
+  .byte 10
+  .byte 0
+.string.1:
+  .byte 117
+  .byte 110
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 98
+  .byte 108
+  .byte 101
+  .byte 10
+  .byte 0
+.string.2:
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 10
+  .byte 0
@@ -0,0 +1,33 @@
+
+        a() {}
+        b();
+        c() label:;
+        d() label: goto label;
+        e() return;
+        f(x) return(x);
+        g(x) x;
+        h(x) if(x) 123;
+        i(x) if(x) 123; else 456;
+        j(x) while(x);
+        k(x) switch(x);
+        l(x) switch(x) case 1:;
+        m() extrn x;
+        n() auto x;
+
+        main() {
+            printf("before a()*n");
+            a();    printf("after a(), before b()*n");
+            b();    printf("after b(), before c()*n");
+            c();    printf("after c(), before e()*n");
+            e();    printf("after e(), before f()*n");
+            f(42);  printf("after f(), before g()*n");
+            g(42);  printf("after g(), before h()*n");
+            h(42);  printf("after h(), before i()*n");
+            i(42);  printf("after i(), before j()*n");
+            j(0);   printf("after j(), before k()*n");
+            k(42);  printf("after k(), before l()*n");
+            l(42);  printf("after l(), before m()*n");
+            m(42);  printf("after m(), before n()*n");
+            n(42);  printf("after n()*n");
+        }
+    
\ No newline at end of file
@@ -0,0 +1,580 @@
+.globl a
+.section .text.sorted.00008,"ax",@progbits
+.align 16
+.type a, @function
+a:
+  xor %rax, %rax
+  ret
+.globl b
+.section .text.sorted.00006,"ax",@progbits
+.align 16
+.type b, @function
+b:
+  xor %rax, %rax
+  ret
+.globl c
+.section .text.sorted.00005,"ax",@progbits
+.align 16
+.type c, @function
+c:
+  xor %rax, %rax
+  ret
+.globl e
+.section .text.sorted.00009,"ax",@progbits
+.align 16
+.type e, @function
+e:
+  xor %rax, %rax
+  ret
+.globl f
+.section .text.sorted.00010,"ax",@progbits
+.type f, @function
+f:
+  push %rdi
+  call f.internal
+  add $8, %rsp
+  ret
+.section .text.sorted.00010,"ax",@progbits
+.align 16
+.type f.internal, @function
+f.internal:
+  mov 8(%rsp), %rax
+  ret
+.globl g
+.section .text.sorted.00004,"ax",@progbits
+.type g, @function
+g:
+  push %rdi
+  call g.internal
+  add $8, %rsp
+  ret
+.section .text.sorted.00004,"ax",@progbits
+.align 16
+.type g.internal, @function
+g.internal:
+  xor %rax, %rax
+  ret
+.globl h
+.section .text.sorted.00003,"ax",@progbits
+.type h, @function
+h:
+  push %rdi
+  call h.internal
+  add $8, %rsp
+  ret
+.section .text.sorted.00003,"ax",@progbits
+.align 16
+.type h.internal, @function
+h.internal:
+  mov 8(%rsp), %rax
+  test %rax, %rax
+  je .L.else.6
+  mov $123, %rax
+.L.else.6:
+  xor %rax, %rax
+  ret
+.globl i
+.section .text.sorted.00011,"ax",@progbits
+.type i, @function
+i:
+  push %rdi
+  call i.internal
+  add $8, %rsp
+  ret
+.section .text.sorted.00011,"ax",@progbits
+.align 16
+.type i.internal, @function
+i.internal:
+  mov 8(%rsp), %rax
+  test %rax, %rax
+  je .L.else.7
+  mov $123, %rax
+  jmp .L.end.7
+.L.else.7:
+  mov $456, %rax
+.L.end.7:
+  xor %rax, %rax
+  ret
+.globl j
+.section .text.sorted.00012,"ax",@progbits
+.type j, @function
+j:
+  push %rdi
+  call j.internal
+  add $8, %rsp
+  ret
+.section .text.sorted.00012,"ax",@progbits
+.align 16
+.type j.internal, @function
+.align 16
+j.internal:
+.L.start.8:
+  mov 8(%rsp), %rax
+  test %rax, %rax
+  jne .L.start.8
+  xor %rax, %rax
+  ret
+.globl k
+.section .text.sorted.00002,"ax",@progbits
+.type k, @function
+k:
+  push %rdi
+  call k.internal
+  add $8, %rsp
+  ret
+.section .text.sorted.00002,"ax",@progbits
+.align 16
+.type k.internal, @function
+k.internal:
+  xor %rax, %rax
+  ret
+.globl l
+.section .text.sorted.00001,"ax",@progbits
+.type l, @function
+l:
+  push %rdi
+  call l.internal
+  add $8, %rsp
+  ret
+.section .text.sorted.00001,"ax",@progbits
+.align 16
+.type l.internal, @function
+l.internal:
+  mov 8(%rsp), %rax
+  cmp $1, %rax
+  xor %rax, %rax
+  ret
+.globl m
+.section .text.sorted.00013,"ax",@progbits
+.align 16
+.type m, @function
+m:
+  xor %rax, %rax
+  ret
+.globl n
+.section .text.sorted.00014,"ax",@progbits
+.align 16
+.type n, @function
+n:
+  xor %rax, %rax
+  ret
+.globl main
+.section .text.sorted.00007,"ax",@progbits
+.align 16
+.type main, @function
+main:
+  sub $8, %rsp
+  sub $8, %rsp
+  lea .string.0(%rip), %rax
+  push %rax
+  pop %rdi
+  call printf
+  call a
+  lea .string.1(%rip), %rax
+  push %rax
+  pop %rdi
+  call printf
+  call b
+  lea .string.2(%rip), %rax
+  push %rax
+  pop %rdi
+  call printf
+  call c
+  lea .string.3(%rip), %rax
+  push %rax
+  pop %rdi
+  call printf
+  call e
+  lea .string.4(%rip), %rax
+  push %rax
+  pop %rdi
+  call printf
+  mov $42, %rax
+  push %rax
+  call f.internal
+  add $8, %rsp
+  lea .string.5(%rip), %rax
+  push %rax
+  pop %rdi
+  call printf
+  mov $42, %rax
+  push %rax
+  call g.internal
+  add $8, %rsp
+  lea .string.6(%rip), %rax
+  push %rax
+  pop %rdi
+  call printf
+  mov $42, %rax
+  push %rax
+  call h.internal
+  add $8, %rsp
+  lea .string.7(%rip), %rax
+  push %rax
+  pop %rdi
+  call printf
+  mov $42, %rax
+  push %rax
+  call i.internal
+  add $8, %rsp
+  lea .string.8(%rip), %rax
+  push %rax
+  pop %rdi
+  call printf
+  xor %rax, %rax
+  push %rax
+  call j.internal
+  add $8, %rsp
+  lea .string.9(%rip), %rax
+  push %rax
+  pop %rdi
+  call printf
+  mov $42, %rax
+  push %rax
+  call k.internal
+  add $8, %rsp
+  lea .string.10(%rip), %rax
+  push %rax
+  pop %rdi
+  call printf
+  mov $42, %rax
+  push %rax
+  call l.internal
+  add $8, %rsp
+  lea .string.11(%rip), %rax
+  push %rax
+  pop %rdi
+  call printf
+  mov $42, %rax
+  push %rax
+  pop %rdi
+  call m
+  lea .string.12(%rip), %rax
+  push %rax
+  pop %rdi
+  call printf
+  mov $42, %rax
+  push %rax
+  pop %rdi
+  call n
+  lea .string.13(%rip), %rax
+  push %rax
+  pop %rdi
+  call printf
+  xor %rax, %rax
+  add $16, %rsp
+  ret
+.section .rodata
+.string.0:
+  .byte 98
+  .byte 101
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 101
+  .byte 32
+  .byte 97
+  .byte 40
+  .byte 41
+  .byte 10
+  .byte 0
+.string.1:
+  .byte 97
+  .byte 102
+  .byte 116
+  .byte 101
+  .byte 114
+  .byte 32
+  .byte 97
+  .byte 40
+  .byte 41
+  .byte 44
+  .byte 32
+  .byte 98
+  .byte 101
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 101
+  .byte 32
+  .byte 98
+  .byte 40
+  .byte 41
+  .byte 10
+  .byte 0
+.string.2:
+  .byte 97
+  .byte 102
+  .byte 116
+  .byte 101
+  .byte 114
+  .byte 32
+  .byte 98
+  .byte 40
+  .byte 41
+  .byte 44
+  .byte 32
+  .byte 98
+  .byte 101
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 101
+  .byte 32
+  .byte 99
+  .byte 40
+  .byte 41
+  .byte 10
+  .byte 0
+.string.3:
+  .byte 97
+  .byte 102
+  .byte 116
+  .byte 101
+  .byte 114
+  .byte 32
+  .byte 99
+  .byte 40
+  .byte 41
+  .byte 44
+  .byte 32
+  .byte 98
+  .byte 101
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 101
+  .byte 32
+  .byte 101
+  .byte 40
+  .byte 41
+  .byte 10
+  .byte 0
+.string.4:
+  .byte 97
+  .byte 102
+  .byte 116
+  .byte 101
+  .byte 114
+  .byte 32
+  .byte 101
+  .byte 40
+  .byte 41
+  .byte 44
+  .byte 32
+  .byte 98
+  .byte 101
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 101
+  .byte 32
+  .byte 102
+  .byte 40
+  .byte 41
+  .byte 10
+  .byte 0
+.string.5:
+  .byte 97
+  .byte 102
+  .byte 116
+  .byte 101
+  .byte 114
+  .byte 32
+  .byte 102
+  .byte 40
+  .byte 41
+  .byte 44
+  .byte 32
+  .byte 98
+  .byte 101
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 101
+  .byte 32
+  .byte 103
+  .byte 40
+  .byte 41
+  .byte 10
+  .byte 0
+.string.6:
+  .byte 97
+  .byte 102
+  .byte 116
+  .byte 101
+  .byte 114
+  .byte 32
+  .byte 103
+  .byte 40
+  .byte 41
+  .byte 44
+  .byte 32
+  .byte 98
+  .byte 101
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 101
+  .byte 32
+  .byte 104
+  .byte 40
+  .byte 41
+  .byte 10
+  .byte 0
+.string.7:
+  .byte 97
+  .byte 102
+  .byte 116
+  .byte 101
+  .byte 114
+  .byte 32
+  .byte 104
+  .byte 40
+  .byte 41
+  .byte 44
+  .byte 32
+  .byte 98
+  .byte 101
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 101
+  .byte 32
+  .byte 105
+  .byte 40
+  .byte 41
+  .byte 10
+  .byte 0
+.string.8:
+  .byte 97
+  .byte 102
+  .byte 116
+  .byte 101
+  .byte 114
+  .byte 32
+  .byte 105
+  .byte 40
+  .byte 41
+  .byte 44
+  .byte 32
+  .byte 98
+  .byte 101
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 101
+  .byte 32
+  .byte 106
+  .byte 40
+  .byte 41
+  .byte 10
+  .byte 0
+.string.9:
+  .byte 97
+  .byte 102
+  .byte 116
+  .byte 101
+  .byte 114
+  .byte 32
+  .byte 106
+  .byte 40
+  .byte 41
+  .byte 44
+  .byte 32
+  .byte 98
+  .byte 101
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 101
+  .byte 32
+  .byte 107
+  .byte 40
+  .byte 41
+  .byte 10
+  .byte 0
+.string.10:
+  .byte 97
+  .byte 102
+  .byte 116
+  .byte 101
+  .byte 114
+  .byte 32
+  .byte 107
+  .byte 40
+  .byte 41
+  .byte 44
+  .byte 32
+  .byte 98
+  .byte 101
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 101
+  .byte 32
+  .byte 108
+  .byte 40
+  .byte 41
+  .byte 10
+  .byte 0
+.string.11:
+  .byte 97
+  .byte 102
+  .byte 116
+  .byte 101
+  .byte 114
+  .byte 32
+  .byte 108
+  .byte 40
+  .byte 41
+  .byte 44
+  .byte 32
+  .byte 98
+  .byte 101
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 101
+  .byte 32
+  .byte 109
+  .byte 40
+  .byte 41
+  .byte 10
+  .byte 0
+.string.12:
+  .byte 97
+  .byte 102
+  .byte 116
+  .byte 101
+  .byte 114
+  .byte 32
+  .byte 109
+  .byte 40
+  .byte 41
+  .byte 44
+  .byte 32
+  .byte 98
+  .byte 101
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 101
+  .byte 32
+  .byte 110
+  .byte 40
+  .byte 41
+  .byte 10
+  .byte 0
+.string.13:
+  .byte 97
+  .byte 102
+  .byte 116
+  .byte 101
+  .byte 114
+  .byte 32
+  .byte 110
+  .byte 40
+  .byte 41
+  .byte 10
+  .byte 0
@@ -0,0 +1,29 @@
+
+        n;
+
+        cold1() {
+            printf("start*n");
+        }
+
+        cold2() {
+            extrn n;
+            printf("%d*n", n);
+        }
+
+        hot() {
+            extrn n;
+            n =+ 3;
+        }
+
+        main() {
+            auto i;
+
+            cold1();
+            i = 0;
+            while (i < 100) {
+                hot();
+                i++;
+            }
+            cold2();
+        }
+    
\ No newline at end of file
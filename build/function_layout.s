@@ -0,0 +1,96 @@
+.globl n
+.data
+.type n, @object
+.align 8
+n:
+  .zero 8
+.globl cold1
+.section .text.sorted.00003,"ax",@progbits
+.align 16
+.type cold1, @function
+cold1:
+  sub $8, %rsp
+  sub $8, %rsp
+  lea .string.0(%rip), %rax
+  push %rax
+  pop %rdi
+  call printf
+  xor %rax, %rax
+  add $16, %rsp
+  ret
+.globl cold2
+.section .text.sorted.00004,"ax",@progbits
+.align 16
+.type cold2, @function
+cold2:
+  sub $8, %rsp
+  sub $8, %rsp
+  lea .string.1(%rip), %rax
+  push %rax
+  mov n(%rip), %rax
+  push %rax
+  pop %rsi
+  pop %rdi
+  call printf
+  xor %rax, %rax
+  add $16, %rsp
+  ret
+.globl hot
+.section .text.sorted.00001,"ax",@progbits
+.align 16
+.type hot, @function
+hot:
+  lea n(%rip), %rax
+  mov %rax, -24(%rsp)
+  mov (%rax), %rax
+  add $3, %rax
+  mov -24(%rsp), %rdi
+  mov %rax, (%rdi)
+  xor %rax, %rax
+  ret
+.globl main
+.section .text.sorted.00002,"ax",@progbits
+.align 16
+.type main, @function
+main:
+  sub $8, %rsp
+  sub $8, %rsp
+  sub $8, %rsp
+  sub $8, %rsp
+  call cold1
+  xor %rax, %rax
+  mov %rax, 8(%rsp)
+.align 16
+.L.start.1:
+  mov 8(%rsp), %rax
+  cmp $100, %rax
+  setl %al
+  movzb %al, %rax
+  test %rax, %rax
+  je .L.end.1
+  call hot
+  lea 8(%rsp), %rax
+  mov (%rax), %rcx
+  addq $1, (%rax)
+  mov %rcx, %rax
+  jmp .L.start.1
+.L.end.1:
+  call cold2
+  add $16, %rsp
+  xor %rax, %rax
+  add $16, %rsp
+  ret
+.section .rodata
+.string.0:
+  .byte 115
+  .byte 116
+  .byte 97
+  .byte 114
+  .byte 116
+  .byte 10
+  .byte 0
+.string.1:
+  .byte 37
+  .byte 100
+  .byte 10
+  .byte 0
@@ -0,0 +1,11 @@
+
+        choose(a, b, c)
+        {
+            return (a ? b : c);
+        }
+
+        main() {
+            printf("%d*n", choose(1, 123, 456));
+            printf("%d*n", choose(0, 123, 456));
+        }
+    
\ No newline at end of file
@@ -0,0 +1,72 @@
+.globl choose
+.section .text.sorted.00002,"ax",@progbits
+.type choose, @function
+choose:
+  push %rdi
+  push %rsi
+  push %rdx
+  call choose.internal
+  add $24, %rsp
+  ret
+.section .text.sorted.00002,"ax",@progbits
+.align 16
+.type choose.internal, @function
+choose.internal:
+  mov 24(%rsp), %rax
+  mov %rax, -16(%rsp)
+  mov 16(%rsp), %rax
+  mov %rax, %rdi
+  mov 8(%rsp), %rax
+  mov -16(%rsp), %rcx
+  cmp $0, %rcx
+  cmovne %rdi, %rax
+  ret
+.globl main
+.section .text.sorted.00001,"ax",@progbits
+.align 16
+.type main, @function
+main:
+  sub $8, %rsp
+  sub $8, %rsp
+  lea .string.0(%rip), %rax
+  push %rax
+  mov $1, %rax
+  push %rax
+  mov $123, %rax
+  push %rax
+  mov $456, %rax
+  push %rax
+  call choose.internal
+  add $24, %rsp
+  push %rax
+  pop %rsi
+  pop %rdi
+  call printf
+  lea .string.1(%rip), %rax
+  push %rax
+  xor %rax, %rax
+  push %rax
+  mov $123, %rax
+  push %rax
+  mov $456, %rax
+  push %rax
+  call choose.internal
+  add $24, %rsp
+  push %rax
+  pop %rsi
+  pop %rdi
+  call printf
+  xor %rax, %rax
+  add $16, %rsp
+  ret
+.section .rodata
+.string.0:
+  .byte 37
+  .byte 100
+  .byte 10
+  .byte 0
+.string.1:
+  .byte 37
+  .byte 100
+  .byte 10
+  .byte 0
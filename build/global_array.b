@@ -0,0 +1,10 @@
+
+        g[3] -345, 'foo', "bar";
+
+        main() {
+            extrn g;
+
+            printf("global = %d, '%c', *"%s*"*n", g[0], g[1], g[2]);
+            printf("address = %d, %d, %d*n", (&g[0]) - g, (&g[1]) - g, (&g[2]) - g);
+        }
+    
\ No newline at end of file
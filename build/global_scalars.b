@@ -0,0 +1,14 @@
+
+        a;
+        b 123;
+        c -345, 'foo', "bar";
+
+        main() {
+            extrn a, b, c;
+
+            printf("a = %d*n", a);
+            printf("b = %d*n", b);
+            a = &c;
+            printf("c = %d, '%c', *"%s*"*n", c, a[1], a[2]);
+        }
+    
\ No newline at end of file
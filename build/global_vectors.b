@@ -0,0 +1,13 @@
+
+        a[];
+        b[] 123;
+        c[4] -345, 'foo', "bar";
+
+        main() {
+            extrn a, b, c;
+
+            printf("a = %d*n", a[1]);
+            printf("b = %d*n", b[0]);
+            printf("c = %d, '%c', *"%s*", %d*n", c[0], c[1], c[2], c[3]);
+        }
+    
\ No newline at end of file
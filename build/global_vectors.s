@@ -0,0 +1,121 @@
+.globl a
+.data
+.type a, @object
+.align 8
+a:
+  .quad .+8
+.globl b
+.data
+.type b, @object
+.align 8
+b:
+  .quad .+8
+  .quad 123
+.globl c
+.data
+.type c, @object
+.align 8
+c:
+  .quad .+8
+  .quad -345
+  .quad 7303014
+  .quad .string.0
+  .zero 8
+.globl main
+.section .text.sorted.00001,"ax",@progbits
+.align 16
+.type main, @function
+main:
+  sub $8, %rsp
+  sub $8, %rsp
+  lea .string.1(%rip), %rax
+  push %rax
+  mov $1, %rax
+  lea a+8(%rip), %rdi
+  mov (%rdi,%rax,8), %rax
+  push %rax
+  pop %rsi
+  pop %rdi
+  call printf
+  lea .string.2(%rip), %rax
+  push %rax
+  xor %rax, %rax
+  lea b+8(%rip), %rdi
+  mov (%rdi,%rax,8), %rax
+  push %rax
+  pop %rsi
+  pop %rdi
+  call printf
+  lea .string.3(%rip), %rax
+  push %rax
+  xor %rax, %rax
+  lea c+8(%rip), %rdi
+  mov (%rdi,%rax,8), %rax
+  push %rax
+  mov $1, %rax
+  mov (%rdi,%rax,8), %rax
+  push %rax
+  mov $2, %rax
+  mov (%rdi,%rax,8), %rax
+  push %rax
+  mov $3, %rax
+  mov (%rdi,%rax,8), %rax
+  push %rax
+  pop %r8
+  pop %rcx
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  call printf
+  xor %rax, %rax
+  add $16, %rsp
+  ret
+.section .rodata
+.string.0:
+  .byte 98
+  .byte 97
+  .byte 114
+  .byte 0
+.string.1:
+  .byte 97
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 10
+  .byte 0
+.string.2:
+  .byte 98
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 10
+  .byte 0
+.string.3:
+  .byte 99
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 44
+  .byte 32
+  .byte 39
+  .byte 37
+  .byte 99
+  .byte 39
+  .byte 44
+  .byte 32
+  .byte 34
+  .byte 37
+  .byte 115
+  .byte 34
+  .byte 44
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 10
+  .byte 0
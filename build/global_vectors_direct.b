@@ -0,0 +1,29 @@
+
+        main() {
+            extrn fixed, moved, other;
+            auto i;
+
+            i = 0;
+            while (i < 3) {
+                fixed[i] = i * 10;
+                moved[i] = i * 100;
+                i++;
+            }
+            moved = &other[1];
+            printf("%d %d %d*n", fixed[0], fixed[1], fixed[2]);
+            printf("%d %d*n", moved[0], moved[1]);
+            printf("%d*n", sum(fixed, 3));
+        }
+
+        sum(v, n) {
+            auto s;
+            s = 0;
+            while (n)
+                s =+ v[--n];
+            return(s);
+        }
+
+        fixed[3];
+        moved[3];
+        other[] 1, 2, 3;
+    
\ No newline at end of file
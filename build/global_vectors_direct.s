@@ -0,0 +1,181 @@
+.globl main
+.section .text.sorted.00001,"ax",@progbits
+.align 16
+.type main, @function
+main:
+  sub $8, %rsp
+  sub $8, %rsp
+  sub $8, %rsp
+  sub $8, %rsp
+  xor %rax, %rax
+  mov %rax, 8(%rsp)
+.align 16
+.L.start.2:
+  mov 8(%rsp), %rax
+  cmp $3, %rax
+  setl %al
+  movzb %al, %rax
+  test %rax, %rax
+  je .L.end.2
+  mov 8(%rsp), %rax
+  lea fixed+8(%rip), %rdi
+  lea (%rdi,%rax,8), %rax
+  push %rax
+  mov 16(%rsp), %rax
+  imul $10, %rax
+  pop %rdi
+  mov %rax, (%rdi)
+  mov moved(%rip), %rdi
+  mov 8(%rsp), %rax
+  lea (%rdi,%rax,8), %rax
+  push %rax
+  mov 16(%rsp), %rax
+  imul $100, %rax
+  pop %rdi
+  mov %rax, (%rdi)
+  lea 8(%rsp), %rax
+  mov (%rax), %rcx
+  addq $1, (%rax)
+  mov %rcx, %rax
+  jmp .L.start.2
+.L.end.2:
+  lea moved(%rip), %rax
+  push %rax
+  mov $1, %rax
+  lea other+8(%rip), %rdi
+  lea (%rdi,%rax,8), %rax
+  pop %rdi
+  mov %rax, (%rdi)
+  lea .string.0(%rip), %rax
+  push %rax
+  xor %rax, %rax
+  lea fixed+8(%rip), %rdi
+  mov (%rdi,%rax,8), %rax
+  push %rax
+  mov $1, %rax
+  mov (%rdi,%rax,8), %rax
+  push %rax
+  mov $2, %rax
+  mov (%rdi,%rax,8), %rax
+  push %rax
+  pop %rcx
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  call printf
+  lea .string.1(%rip), %rax
+  push %rax
+  push moved(%rip)
+  xor %rax, %rax
+  pop %rdi
+  mov (%rdi,%rax,8), %rax
+  push %rax
+  push %rdi
+  mov $1, %rax
+  pop %rdi
+  mov (%rdi,%rax,8), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  call printf
+  lea .string.2(%rip), %rax
+  push %rax
+  lea fixed+8(%rip), %rax
+  push %rax
+  mov $3, %rax
+  push %rax
+  call sum.internal
+  add $16, %rsp
+  push %rax
+  pop %rsi
+  pop %rdi
+  call printf
+  add $16, %rsp
+  xor %rax, %rax
+  add $16, %rsp
+  ret
+.globl sum
+.section .text.sorted.00002,"ax",@progbits
+.type sum, @function
+sum:
+  push %rdi
+  push %rsi
+  call sum.internal
+  add $16, %rsp
+  ret
+.section .text.sorted.00002,"ax",@progbits
+.align 16
+.type sum.internal, @function
+sum.internal:
+  xor %rax, %rax
+  mov %rax, -16(%rsp)
+.align 16
+.L.start.3:
+  mov 8(%rsp), %rax
+  test %rax, %rax
+  je .L.end.3
+  lea -16(%rsp), %rax
+  mov 16(%rsp), %r11
+  mov %r11, -32(%rsp)
+  lea 8(%rsp), %rax
+  mov (%rax), %rdi
+  sub $1, %rdi
+  mov %rdi, (%rax)
+  mov %rdi, %rax
+  mov -32(%rsp), %rdi
+  mov (%rdi,%rax,8), %rax
+  add %rax, -16(%rsp)
+  mov -16(%rsp), %rax
+  jmp .L.start.3
+.L.end.3:
+  mov -16(%rsp), %rax
+  ret
+.globl fixed
+.data
+.type fixed, @object
+.align 8
+fixed:
+  .quad .+8
+  .zero 24
+.globl moved
+.data
+.type moved, @object
+.align 8
+moved:
+  .quad .+8
+  .zero 24
+.globl other
+.data
+.type other, @object
+.align 8
+other:
+  .quad .+8
+  .quad 1
+  .quad 2
+  .quad 3
+.section .rodata
+.string.0:
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 10
+  .byte 0
+.string.1:
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 10
+  .byte 0
+.string.2:
+  .byte 37
+  .byte 100
+  .byte 10
+  .byte 0
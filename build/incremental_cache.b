@@ -0,0 +1,20 @@
+
+        printd(n, b) {
+            auto a;
+
+            if (a = n / b)
+                printd(a, b);
+            putchar(n % b + '0');
+        }
+
+        square(x) {
+            return (x * x + 1);
+        }
+
+        main() {
+            printd(square(12), 10);
+            putchar(' ');
+            printd(square(5), 10);
+            printf(" %s*n", "done");
+        }
+    
\ No newline at end of file
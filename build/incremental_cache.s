@@ -0,0 +1,163 @@
+.globl printd
+.section .text.sorted.00003,"ax",@progbits
+.type printd, @function
+printd:
+  push %rdi
+  push %rsi
+  call printd.internal
+  add $16, %rsp
+  ret
+.section .text.sorted.00003,"ax",@progbits
+.align 16
+.type printd.internal, @function
+printd.internal:
+  sub $8, %rsp
+  sub $8, %rsp
+  sub $8, %rsp
+  mov 40(%rsp), %rax
+  push %rax
+  mov 40(%rsp), %rax
+  mov %rax, %rdi
+  pop %rax
+  cqo
+  idiv %rdi
+  test %rax, %rax
+  je .L.else.1
+  push %rax
+  mov %rdi, %rax
+  push %rax
+  call printd.internal
+  add $16, %rsp
+.L.else.1:
+  mov 40(%rsp), %rax
+  push %rax
+  mov 40(%rsp), %rax
+  mov %rax, %rdi
+  pop %rax
+  cqo
+  idiv %rdi
+  mov %rdx, %rax
+  add $48, %rax
+  push %rax
+  pop %rdi
+  call putchar
+  add $16, %rsp
+  xor %rax, %rax
+  add $8, %rsp
+  ret
+.section .text.sorted.00003,"ax",@progbits
+.align 16
+.type printd.spec.0, @function
+printd.spec.0:
+  sub $8, %rsp
+  sub $8, %rsp
+  sub $8, %rsp
+  mov 40(%rsp), %rax
+  push %rax
+  pop %rax
+  mov %rax, %rcx
+  movabs $7378697629483820647, %rdx
+  imul %rdx
+  sar $2, %rdx
+  mov %rcx, %rax
+  shr $63, %rax
+  add %rdx, %rax
+  test %rax, %rax
+  je .L.else.2
+  push %rax
+  mov $10, %rax
+  push %rax
+  call printd.spec.0
+  add $16, %rsp
+.L.else.2:
+  mov 40(%rsp), %rax
+  push %rax
+  pop %rax
+  mov %rax, %rcx
+  movabs $7378697629483820647, %rdx
+  imul %rdx
+  sar $2, %rdx
+  mov %rcx, %rax
+  shr $63, %rax
+  add %rdx, %rax
+  imul $10, %rax
+  sub %rax, %rcx
+  mov %rcx, %rax
+  add $48, %rax
+  push %rax
+  pop %rdi
+  call putchar
+  add $16, %rsp
+  xor %rax, %rax
+  add $8, %rsp
+  ret
+.globl square
+.section .text.sorted.00001,"ax",@progbits
+.type square, @function
+square:
+  push %rdi
+  call square.internal
+  add $8, %rsp
+  ret
+.section .text.sorted.00001,"ax",@progbits
+.align 16
+.type square.internal, @function
+square.internal:
+  mov 8(%rsp), %rax
+  mov %rax, -16(%rsp)
+  mov -16(%rsp), %rdi
+  imul %rdi, %rax
+  add $1, %rax
+  ret
+.globl main
+.section .text.sorted.00002,"ax",@progbits
+.align 16
+.type main, @function
+main:
+  sub $8, %rsp
+  sub $8, %rsp
+  mov $12, %rax
+  push %rax
+  call square.internal
+  add $8, %rsp
+  push %rax
+  mov $10, %rax
+  push %rax
+  call printd.spec.0
+  add $16, %rsp
+  mov $32, %rax
+  push %rax
+  pop %rdi
+  call putchar
+  mov $5, %rax
+  push %rax
+  call square.internal
+  add $8, %rsp
+  push %rax
+  mov $10, %rax
+  push %rax
+  call printd.spec.0
+  add $16, %rsp
+  lea .string.0(%rip), %rax
+  push %rax
+  lea .string.1(%rip), %rax
+  push %rax
+  pop %rsi
+  pop %rdi
+  call printf
+  xor %rax, %rax
+  add $16, %rsp
+  ret
+.section .rodata
+.string.0:
+  .byte 32
+  .byte 37
+  .byte 115
+  .byte 10
+  .byte 0
+.string.1:
+  .byte 100
+  .byte 111
+  .byte 110
+  .byte 101
+  .byte 0
@@ -0,0 +1,18 @@
+
+        main() {
+            auto a, b, x, i, v[4];
+
+            a = 100;
+            b = 3;
+            x = a + b * 4 + 8;
+            i = 0;
+            while (i < 4) {
+                v[i] = i * 10 + 5;
+                i++;
+            }
+            i = 2;
+            x =+ v[i];
+            if (x != 0)
+                printf("%d %d %d*n", x, a - b, x >> 2);
+        }
+    
\ No newline at end of file
@@ -0,0 +1,94 @@
+.globl main
+.section .text.sorted.00001,"ax",@progbits
+.align 16
+.type main, @function
+main:
+  sub $8, %rsp
+  sub $8, %rsp
+  sub $8, %rsp
+  sub $8, %rsp
+  sub $8, %rsp
+  sub $8, %rsp
+  sub $40, %rsp
+  lea 8(%rsp), %rax
+  mov %rax, 0(%rsp)
+  sub $8, %rsp
+  mov $100, %rax
+  mov %rax, 72(%rsp)
+  mov $3, %rax
+  mov %rax, 64(%rsp)
+  mov 72(%rsp), %rax
+  mov %rax, %rdi
+  mov 64(%rsp), %rax
+  lea 8(%rdi,%rax,4), %rax
+  mov %rax, 56(%rsp)
+  xor %rax, %rax
+  mov %rax, 48(%rsp)
+.align 16
+.L.start.2:
+  mov 48(%rsp), %rax
+  cmp $4, %rax
+  setl %al
+  movzb %al, %rax
+  test %rax, %rax
+  je .L.end.2
+  mov 8(%rsp), %rdi
+  mov 48(%rsp), %rax
+  lea (%rdi,%rax,8), %rax
+  push %rax
+  mov 56(%rsp), %rax
+  imul $10, %rax
+  add $5, %rax
+  pop %rdi
+  mov %rax, (%rdi)
+  lea 48(%rsp), %rax
+  mov (%rax), %rcx
+  addq $1, (%rax)
+  mov %rcx, %rax
+  jmp .L.start.2
+.L.end.2:
+  mov $2, %rax
+  mov %rax, 48(%rsp)
+  lea 56(%rsp), %rax
+  mov 8(%rsp), %rdi
+  mov 48(%rsp), %rax
+  mov (%rdi,%rax,8), %rax
+  add %rax, 56(%rsp)
+  mov 56(%rsp), %rax
+  test %rax, %rax
+  setne %al
+  movzb %al, %rax
+  test %rax, %rax
+  je .L.else.3
+  lea .string.0(%rip), %rax
+  push %rax
+  mov 64(%rsp), %rax
+  push %rax
+  mov 88(%rsp), %rax
+  sub 80(%rsp), %rax
+  push %rax
+  mov 80(%rsp), %rax
+  sar $2, %rax
+  push %rax
+  pop %rcx
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  call printf
+.L.else.3:
+  add $80, %rsp
+  xor %rax, %rax
+  add $16, %rsp
+  ret
+.section .rodata
+.string.0:
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 10
+  .byte 0
@@ -0,0 +1,18 @@
+
+        fib(n) {
+            if (n < 2)
+                return (n);
+            return (fib(n - 1) + fib(n - 2));
+        }
+
+        digits(n, i) {
+            i = 1;
+            while (n =/ 10)
+                i++;
+            return (i);
+        }
+
+        main() {
+            printf("%d %d %d*n", fib(20), digits(12345), digits(7, 0));
+        }
+    
\ No newline at end of file
@@ -0,0 +1,133 @@
+.globl fib
+.section .text.sorted.00003,"ax",@progbits
+.type fib, @function
+fib:
+  push %rdi
+  call fib.internal
+  add $8, %rsp
+  ret
+.section .text.sorted.00003,"ax",@progbits
+.align 16
+.type fib.internal, @function
+fib.internal:
+  sub $8, %rsp
+  mov 16(%rsp), %rax
+  cmp $2, %rax
+  setl %al
+  movzb %al, %rax
+  test %rax, %rax
+  je .L.else.2
+  mov 16(%rsp), %rax
+  jmp .L.return.fib.internal
+.L.else.2:
+  mov 16(%rsp), %rax
+  push %rax
+  mov $1, %rax
+  mov %rax, %rdi
+  pop %rax
+  sub %rdi, %rax
+  push %rax
+  call fib.internal
+  add $8, %rsp
+  push %rax
+  mov 24(%rsp), %rax
+  push %rax
+  mov $2, %rax
+  mov %rax, %rdi
+  pop %rax
+  sub %rdi, %rax
+  push %rax
+  call fib.internal
+  add $8, %rsp
+  pop %rdi
+  add %rdi, %rax
+.L.return.fib.internal:
+  add $8, %rsp
+  ret
+.globl digits
+.section .text.sorted.00001,"ax",@progbits
+.type digits, @function
+digits:
+  push %rdi
+  push %rsi
+  call digits.internal
+  add $16, %rsp
+  ret
+.section .text.sorted.00001,"ax",@progbits
+.align 16
+.type digits.internal, @function
+digits.internal:
+  mov $1, %rax
+  mov %rax, 8(%rsp)
+.align 16
+.L.start.3:
+  lea 16(%rsp), %rax
+  mov %rax, -16(%rsp)
+  mov (%rax), %rax
+  mov %rax, -24(%rsp)
+  mov -24(%rsp), %rax
+  mov %rax, %rcx
+  movabs $7378697629483820647, %rdx
+  imul %rdx
+  sar $2, %rdx
+  mov %rcx, %rax
+  shr $63, %rax
+  add %rdx, %rax
+  mov -16(%rsp), %rdi
+  mov %rax, (%rdi)
+  test %rax, %rax
+  je .L.end.3
+  lea 8(%rsp), %rax
+  mov (%rax), %rcx
+  addq $1, (%rax)
+  mov %rcx, %rax
+  jmp .L.start.3
+.L.end.3:
+  mov 8(%rsp), %rax
+  ret
+.globl main
+.section .text.sorted.00002,"ax",@progbits
+.align 16
+.type main, @function
+main:
+  sub $8, %rsp
+  sub $8, %rsp
+  lea .string.0(%rip), %rax
+  push %rax
+  mov $20, %rax
+  push %rax
+  call fib.internal
+  add $8, %rsp
+  push %rax
+  mov $12345, %rax
+  push %rax
+  pop %rdi
+  call digits
+  push %rax
+  mov $7, %rax
+  push %rax
+  xor %rax, %rax
+  push %rax
+  call digits.internal
+  add $16, %rsp
+  push %rax
+  pop %rcx
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  call printf
+  xor %rax, %rax
+  add $16, %rsp
+  ret
+.section .rodata
+.string.0:
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 10
+  .byte 0
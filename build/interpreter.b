@@ -0,0 +1,43 @@
+
+    v[5] 1, 2, 3;
+    greeting "hello";
+
+    sum(n) {
+        extrn v;
+        auto s;
+
+        s = 0;
+        while (n > 0)
+            s =+ v[--n];
+        return (s);
+    }
+
+    fact(n) {
+        return (n <= 1 ? 1 : n * fact(n - 1));
+    }
+
+    shout(c) {
+        switch (c) {
+        case 'l':
+            return ('L');
+        }
+        return (c);
+    }
+
+    main() {
+        extrn v, greeting;
+        auto i, c, b[2];
+
+        v[3] = 10;
+        v[4] = -20 / 3;
+        printf("%d %d %d*n", sum(5), fact(10), 100 % 7);
+        i = 0;
+        while ((c = char(greeting, i)) != 0) {
+            putchar(shout(c));
+            i++;
+        }
+        lchar(b, 0, 'j');
+        lchar(b, 1, 'o');
+        lchar(b, 2, 0);
+        printf(" %s %o*n", b, 8 << 3);
+    }
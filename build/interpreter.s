@@ -0,0 +1,286 @@
+.globl v
+.data
+.type v, @object
+.align 8
+v:
+  .quad .+8
+  .quad 1
+  .quad 2
+  .quad 3
+  .zero 16
+.globl greeting
+.data
+.type greeting, @object
+.align 8
+greeting:
+  .quad .string.0
+.globl sum
+.section .text.sorted.00003,"ax",@progbits
+.type sum, @function
+sum:
+  push %rdi
+  call sum.internal
+  add $8, %rsp
+  ret
+.section .text.sorted.00003,"ax",@progbits
+.align 16
+.type sum.internal, @function
+sum.internal:
+  xor %rax, %rax
+  mov %rax, -16(%rsp)
+.align 16
+.L.start.4:
+  mov 8(%rsp), %rax
+  test %rax, %rax
+  setg %al
+  movzb %al, %rax
+  test %rax, %rax
+  je .L.end.4
+  lea 8(%rsp), %rax
+  mov (%rax), %rdi
+  sub $1, %rdi
+  mov %rdi, (%rax)
+  mov %rdi, %rax
+  lea v+8(%rip), %rdi
+  mov (%rdi,%rax,8), %rax
+  add %rax, -16(%rsp)
+  mov -16(%rsp), %rax
+  jmp .L.start.4
+.L.end.4:
+  mov -16(%rsp), %rax
+  ret
+.globl fact
+.section .text.sorted.00004,"ax",@progbits
+.type fact, @function
+fact:
+  push %rdi
+  call fact.internal
+  add $8, %rsp
+  ret
+.section .text.sorted.00004,"ax",@progbits
+.align 16
+.type fact.internal, @function
+fact.internal:
+  sub $8, %rsp
+  mov 16(%rsp), %rax
+  cmp $1, %rax
+  setle %al
+  movzb %al, %rax
+  test %rax, %rax
+  je .L.cond.else.1
+  mov $1, %rax
+  jmp .L.return.fact.internal
+.L.cond.else.1:
+  mov 16(%rsp), %rax
+  push %rax
+  push %rax
+  mov $1, %rax
+  mov %rax, %rdi
+  pop %rax
+  sub %rdi, %rax
+  push %rax
+  call fact.internal
+  add $8, %rsp
+  pop %rdi
+  imul %rdi, %rax
+.L.return.fact.internal:
+  add $8, %rsp
+  ret
+.globl shout
+.section .text.sorted.00001,"ax",@progbits
+.type shout, @function
+shout:
+  push %rdi
+  call shout.internal
+  add $8, %rsp
+  ret
+.section .text.sorted.00001,"ax",@progbits
+.align 16
+.type shout.internal, @function
+shout.internal:
+  mov 8(%rsp), %rax
+  jmp .L.cmp.5
+.align 16
+.L.case.5.108:
+  mov $76, %rax
+  jmp .L.return.shout.internal
+.L.cmp.5:
+  cmp $108, %rax
+  je .L.case.5.108
+  mov 8(%rsp), %rax
+.L.return.shout.internal:
+  ret
+.globl main
+.section .text.sorted.00002,"ax",@progbits
+.align 16
+.type main, @function
+main:
+  sub $8, %rsp
+  sub $8, %rsp
+  sub $8, %rsp
+  sub $8, %rsp
+  sub $24, %rsp
+  lea 8(%rsp), %rax
+  mov %rax, 0(%rsp)
+  sub $8, %rsp
+  mov $3, %rax
+  lea v+8(%rip), %rdi
+  lea (%rdi,%rax,8), %rax
+  push %rax
+  mov $10, %rax
+  pop %rdi
+  mov %rax, (%rdi)
+  mov $4, %rax
+  lea v+8(%rip), %rdi
+  lea (%rdi,%rax,8), %rax
+  push %rax
+  mov $20, %rax
+  neg %rax
+  push %rax
+  pop %rax
+  mov %rax, %rcx
+  movabs $6148914691236517206, %rdx
+  imul %rdx
+  mov %rcx, %rax
+  shr $63, %rax
+  add %rdx, %rax
+  pop %rdi
+  mov %rax, (%rdi)
+  lea .string.1(%rip), %rax
+  push %rax
+  mov $5, %rax
+  push %rax
+  call sum.internal
+  add $8, %rsp
+  push %rax
+  mov $10, %rax
+  push %rax
+  call fact.internal
+  add $8, %rsp
+  push %rax
+  mov $100, %rax
+  push %rax
+  pop %rax
+  mov %rax, %rcx
+  movabs $5270498306774157605, %rdx
+  imul %rdx
+  sar $1, %rdx
+  mov %rcx, %rax
+  shr $63, %rax
+  add %rdx, %rax
+  imul $7, %rax
+  sub %rax, %rcx
+  mov %rcx, %rax
+  push %rax
+  pop %rcx
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  call printf
+  xor %rax, %rax
+  mov %rax, 40(%rsp)
+.align 16
+.L.start.7:
+  mov greeting(%rip), %rax
+  push %rax
+  mov 48(%rsp), %rax
+  push %rax
+  pop %rsi
+  pop %rdi
+  call char
+  mov %rax, 32(%rsp)
+  test %rax, %rax
+  setne %al
+  movzb %al, %rax
+  test %rax, %rax
+  je .L.end.7
+  mov 32(%rsp), %rax
+  push %rax
+  call shout.internal
+  add $8, %rsp
+  push %rax
+  pop %rdi
+  call putchar
+  lea 40(%rsp), %rax
+  mov (%rax), %rcx
+  addq $1, (%rax)
+  mov %rcx, %rax
+  jmp .L.start.7
+.L.end.7:
+  mov 8(%rsp), %rax
+  push %rax
+  xor %rax, %rax
+  push %rax
+  mov $106, %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  call lchar
+  mov 8(%rsp), %rax
+  push %rax
+  mov $1, %rax
+  push %rax
+  mov $111, %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  call lchar
+  mov 8(%rsp), %rax
+  push %rax
+  mov $2, %rax
+  push %rax
+  xor %rax, %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  call lchar
+  lea .string.2(%rip), %rax
+  push %rax
+  mov 16(%rsp), %rax
+  push %rax
+  mov $8, %rax
+  push %rax
+  mov $3, %rax
+  mov %rax, %rcx
+  pop %rax
+  shl %cl, %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  call printf
+  add $48, %rsp
+  xor %rax, %rax
+  add $16, %rsp
+  ret
+.section .rodata
+.string.0:
+  .byte 104
+  .byte 101
+  .byte 108
+  .byte 108
+  .byte 111
+  .byte 0
+.string.1:
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 10
+  .byte 0
+.string.2:
+  .byte 32
+  .byte 37
+  .byte 115
+  .byte 32
+  .byte 37
+  .byte 111
+  .byte 10
+  .byte 0
@@ -0,0 +1 @@
+main() { return (42); }
@@ -0,0 +1,29 @@
+
+        main() {
+            auto i, n;
+
+            i = n = 0;
+            while (i < 10) {
+                if (i < 3) {
+                    if (i == 1)
+                        n =+ 1;
+                    else
+                        n =+ 2;
+                }
+                else {
+                    if (i > 7)
+                        n =+ 10;
+                }
+                if (i & 1) {
+                    putchar('o');
+                    putchar('*n');
+                }
+                else {
+                    putchar('e');
+                    putchar('*n');
+                }
+                i++;
+            }
+            printf("%d*n", n);
+        }
+    
\ No newline at end of file
@@ -0,0 +1,88 @@
+.globl main
+.section .text.sorted.00001,"ax",@progbits
+.align 16
+.type main, @function
+main:
+  sub $8, %rsp
+  sub $8, %rsp
+  sub $8, %rsp
+  sub $8, %rsp
+  xor %rax, %rax
+  mov %rax, 0(%rsp)
+  mov %rax, 8(%rsp)
+.align 16
+.L.start.5:
+  mov 8(%rsp), %rax
+  cmp $10, %rax
+  setl %al
+  movzb %al, %rax
+  test %rax, %rax
+  je .L.end.5
+  mov 8(%rsp), %rax
+  cmp $3, %rax
+  setl %al
+  movzb %al, %rax
+  test %rax, %rax
+  je .L.else.6
+  mov 8(%rsp), %rax
+  cmp $1, %rax
+  sete %al
+  movzb %al, %rax
+  test %rax, %rax
+  je .L.else.7
+  mov $1, %rax
+  jmp .L.tail.main.1
+.L.else.7:
+  mov $2, %rax
+  jmp .L.tail.main.1
+.L.else.6:
+  mov 8(%rsp), %rax
+  cmp $7, %rax
+  setg %al
+  movzb %al, %rax
+  test %rax, %rax
+  je .L.else.8
+  mov $10, %rax
+.L.tail.main.1:
+  add %rax, 0(%rsp)
+  mov 0(%rsp), %rax
+.L.else.8:
+  mov 8(%rsp), %rax
+  and $1, %rax
+  test %rax, %rax
+  je .L.else.9
+  mov $111, %rax
+  jmp .L.tail.main.2
+.L.else.9:
+  mov $101, %rax
+.L.tail.main.2:
+  push %rax
+  pop %rdi
+  call putchar
+  mov $10, %rax
+  push %rax
+  pop %rdi
+  call putchar
+  lea 8(%rsp), %rax
+  mov (%rax), %rcx
+  addq $1, (%rax)
+  mov %rcx, %rax
+  jmp .L.start.5
+.L.end.5:
+  lea .string.0(%rip), %rax
+  push %rax
+  mov 8(%rsp), %rax
+  push %rax
+  pop %rsi
+  pop %rdi
+  call printf
+  add $16, %rsp
+  xor %rax, %rax
+  add $16, %rsp
+  ret
+.section .rodata
+.string.0:
+  .byte 37
+  .byte 100
+  .byte 10
+  .byte 0
@@ -0,0 +1,10 @@
+
+        main() {
+            putchar(char("fubar", 2));
+            putchar(char("fubar", 4));
+            putchar(char("fubar", 1));
+            putchar(char("fubar", 0));
+            putchar(char("fubar", 3));
+            putchar('*n');
+        }
+    
\ No newline at end of file
@@ -0,0 +1,100 @@
+.globl main
+.section .text.sorted.00001,"ax",@progbits
+.align 16
+.type main, @function
+main:
+  sub $8, %rsp
+  sub $8, %rsp
+  lea .string.0(%rip), %rax
+  push %rax
+  mov $2, %rax
+  push %rax
+  pop %rsi
+  pop %rdi
+  call char
+  push %rax
+  pop %rdi
+  call putchar
+  lea .string.1(%rip), %rax
+  push %rax
+  mov $4, %rax
+  push %rax
+  pop %rsi
+  pop %rdi
+  call char
+  push %rax
+  pop %rdi
+  call putchar
+  lea .string.2(%rip), %rax
+  push %rax
+  mov $1, %rax
+  push %rax
+  pop %rsi
+  pop %rdi
+  call char
+  push %rax
+  pop %rdi
+  call putchar
+  lea .string.3(%rip), %rax
+  push %rax
+  xor %rax, %rax
+  push %rax
+  pop %rsi
+  pop %rdi
+  call char
+  push %rax
+  pop %rdi
+  call putchar
+  lea .string.4(%rip), %rax
+  push %rax
+  mov $3, %rax
+  push %rax
+  pop %rsi
+  pop %rdi
+  call char
+  push %rax
+  pop %rdi
+  call putchar
+  mov $10, %rax
+  push %rax
+  pop %rdi
+  call putchar
+  xor %rax, %rax
+  add $16, %rsp
+  ret
+.section .rodata
+.string.0:
+  .byte 102
+  .byte 117
+  .byte 98
+  .byte 97
+  .byte 114
+  .byte 0
+.string.1:
+  .byte 102
+  .byte 117
+  .byte 98
+  .byte 97
+  .byte 114
+  .byte 0
+.string.2:
+  .byte 102
+  .byte 117
+  .byte 98
+  .byte 97
+  .byte 114
+  .byte 0
+.string.3:
+  .byte 102
+  .byte 117
+  .byte 98
+  .byte 97
+  .byte 114
+  .byte 0
+.string.4:
+  .byte 102
+  .byte 117
+  .byte 98
+  .byte 97
+  .byte 114
+  .byte 0
@@ -0,0 +1,7 @@
+
+        main() {
+            printf("before exit()*n");
+            exit();
+            printf("after exit()*n");
+        }
+    
\ No newline at end of file
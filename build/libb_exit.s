@@ -0,0 +1,51 @@
+.globl main
+.section .text.sorted.00001,"ax",@progbits
+.align 16
+.type main, @function
+main:
+  sub $8, %rsp
+  sub $8, %rsp
+  lea .string.0(%rip), %rax
+  push %rax
+  pop %rdi
+  call printf
+  call exit
+  lea .string.1(%rip), %rax
+  push %rax
+  pop %rdi
+  call printf
+  xor %rax, %rax
+  add $16, %rsp
+  ret
+.section .rodata
+.string.0:
+  .byte 98
+  .byte 101
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 101
+  .byte 32
+  .byte 101
+  .byte 120
+  .byte 105
+  .byte 116
+  .byte 40
+  .byte 41
+  .byte 10
+  .byte 0
+.string.1:
+  .byte 97
+  .byte 102
+  .byte 116
+  .byte 101
+  .byte 114
+  .byte 32
+  .byte 101
+  .byte 120
+  .byte 105
+  .byte 116
+  .byte 40
+  .byte 41
+  .byte 10
+  .byte 0
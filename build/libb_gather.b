@@ -0,0 +1,23 @@
+
+        main() {
+            extrn msg;
+            auto i;
+
+            vbegin(1);
+            vputs("record ");
+            vprintn(-42, 10);
+            vputchar(': ');
+            vwrite(msg, 5);
+            vputchar('*n');
+            printf("written %d*n", vflush());
+
+            i = 0;
+            vbegin(1);
+            while (i < 100)
+                vprintn(i++ % 10, 10);
+            vputchar('*n');
+            vflush();
+        }
+
+        msg "hello world";
+    
\ No newline at end of file
@@ -0,0 +1,135 @@
+.globl main
+.section .text.sorted.00001,"ax",@progbits
+.align 16
+.type main, @function
+main:
+  sub $8, %rsp
+  sub $8, %rsp
+  sub $8, %rsp
+  sub $8, %rsp
+  mov $1, %rax
+  push %rax
+  pop %rdi
+  call vbegin
+  lea .string.0(%rip), %rax
+  push %rax
+  pop %rdi
+  call vputs
+  mov $42, %rax
+  neg %rax
+  push %rax
+  mov $10, %rax
+  push %rax
+  pop %rsi
+  pop %rdi
+  call vprintn
+  mov $8250, %rax
+  push %rax
+  pop %rdi
+  call vputchar
+  mov msg(%rip), %rax
+  push %rax
+  mov $5, %rax
+  push %rax
+  pop %rsi
+  pop %rdi
+  call vwrite
+  mov $10, %rax
+  push %rax
+  pop %rdi
+  call vputchar
+  lea .string.1(%rip), %rax
+  push %rax
+  call vflush
+  push %rax
+  pop %rsi
+  pop %rdi
+  call printf
+  xor %rax, %rax
+  mov %rax, 8(%rsp)
+  mov $1, %rax
+  push %rax
+  pop %rdi
+  call vbegin
+.align 16
+.L.start.1:
+  mov 8(%rsp), %rax
+  cmp $100, %rax
+  setl %al
+  movzb %al, %rax
+  test %rax, %rax
+  je .L.end.1
+  lea 8(%rsp), %rax
+  mov (%rax), %rcx
+  addq $1, (%rax)
+  mov %rcx, %rax
+  push %rax
+  pop %rax
+  movabs $7378697629483820647, %rdx
+  imul %rdx
+  sar $2, %rdx
+  mov %rcx, %rax
+  shr $63, %rax
+  add %rdx, %rax
+  imul $10, %rax
+  sub %rax, %rcx
+  mov %rcx, %rax
+  push %rax
+  mov $10, %rax
+  push %rax
+  pop %rsi
+  pop %rdi
+  call vprintn
+  jmp .L.start.1
+.L.end.1:
+  mov $10, %rax
+  push %rax
+  pop %rdi
+  call vputchar
+  call vflush
+  add $16, %rsp
+  xor %rax, %rax
+  add $16, %rsp
+  ret
+.globl msg
+.data
+.type msg, @object
+.align 8
+msg:
+  .quad .string.2
+.section .rodata
+.string.0:
+  .byte 114
+  .byte 101
+  .byte 99
+  .byte 111
+  .byte 114
+  .byte 100
+  .byte 32
+  .byte 0
+.string.1:
+  .byte 119
+  .byte 114
+  .byte 105
+  .byte 116
+  .byte 116
+  .byte 101
+  .byte 110
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 10
+  .byte 0
+.string.2:
+  .byte 104
+  .byte 101
+  .byte 108
+  .byte 108
+  .byte 111
+  .byte 32
+  .byte 119
+  .byte 111
+  .byte 114
+  .byte 108
+  .byte 100
+  .byte 0
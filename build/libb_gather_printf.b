@@ -0,0 +1,16 @@
+
+        main() {
+            auto fd;
+
+            fd = creat("libb_gather_printf.out", 0644);
+            vbegin(fd);
+            vputs("a");
+            printf("x*n");
+            vputs("b");
+            vprintn(7, 10);
+            printf("y %d*n", 3);
+            vputchar('*n');
+            vflush();
+            close(fd);
+        }
+    
\ No newline at end of file
@@ -0,0 +1,101 @@
+.globl main
+.section .text.sorted.00001,"ax",@progbits
+.align 16
+.type main, @function
+main:
+  sub $8, %rsp
+  sub $8, %rsp
+  sub $8, %rsp
+  sub $8, %rsp
+  lea .string.0(%rip), %rax
+  push %rax
+  mov $420, %rax
+  push %rax
+  pop %rsi
+  pop %rdi
+  call creat
+  mov %rax, 8(%rsp)
+  push %rax
+  pop %rdi
+  call vbegin
+  lea .string.1(%rip), %rax
+  push %rax
+  pop %rdi
+  call vputs
+  lea .string.2(%rip), %rax
+  push %rax
+  pop %rdi
+  call printf
+  lea .string.3(%rip), %rax
+  push %rax
+  pop %rdi
+  call vputs
+  mov $7, %rax
+  push %rax
+  mov $10, %rax
+  push %rax
+  pop %rsi
+  pop %rdi
+  call vprintn
+  lea .string.4(%rip), %rax
+  push %rax
+  mov $3, %rax
+  push %rax
+  pop %rsi
+  pop %rdi
+  call printf
+  mov $10, %rax
+  push %rax
+  pop %rdi
+  call vputchar
+  call vflush
+  mov 8(%rsp), %rax
+  push %rax
+  pop %rdi
+  call close
+  add $16, %rsp
+  xor %rax, %rax
+  add $16, %rsp
+  ret
+.section .rodata
+.string.0:
+  .byte 108
+  .byte 105
+  .byte 98
+  .byte 98
+  .byte 95
+  .byte 103
+  .byte 97
+  .byte 116
+  .byte 104
+  .byte 101
+  .byte 114
+  .byte 95
+  .byte 112
+  .byte 114
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 102
+  .byte 46
+  .byte 111
+  .byte 117
+  .byte 116
+  .byte 0
+.string.1:
+  .byte 97
+  .byte 0
+.string.2:
+  .byte 120
+  .byte 10
+  .byte 0
+.string.3:
+  .byte 98
+  .byte 0
+.string.4:
+  .byte 121
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 10
+  .byte 0
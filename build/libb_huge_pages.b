@@ -0,0 +1,15 @@
+
+        table[300000] 7, 8, 9;
+
+        main() {
+            extrn table;
+            auto i;
+
+            i = 3;
+            while (i < 300000) {
+                table[i] = i;
+                i++;
+            }
+            printf("%d %d %d*n", table[0] + table[2], table[299999], &table[1] - &table[0]);
+        }
+    
\ No newline at end of file
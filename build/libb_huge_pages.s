@@ -0,0 +1,86 @@
+.globl table
+.data
+.type table, @object
+.align 8
+table:
+  .quad .+8
+  .quad 7
+  .quad 8
+  .quad 9
+  .zero 2399976
+.globl main
+.section .text.sorted.00001,"ax",@progbits
+.align 16
+.type main, @function
+main:
+  sub $8, %rsp
+  sub $8, %rsp
+  sub $8, %rsp
+  sub $8, %rsp
+  mov $3, %rax
+  mov %rax, 8(%rsp)
+.align 16
+.L.start.1:
+  mov 8(%rsp), %rax
+  cmp $300000, %rax
+  setl %al
+  movzb %al, %rax
+  test %rax, %rax
+  je .L.end.1
+  mov 8(%rsp), %rax
+  lea table+8(%rip), %rdi
+  lea (%rdi,%rax,8), %rax
+  mov %rax, %rdi
+  mov 8(%rsp), %rax
+  mov %rax, (%rdi)
+  lea 8(%rsp), %rax
+  mov (%rax), %rcx
+  addq $1, (%rax)
+  mov %rcx, %rax
+  jmp .L.start.1
+.L.end.1:
+  lea .string.0(%rip), %rax
+  push %rax
+  xor %rax, %rax
+  lea table+8(%rip), %rdi
+  mov (%rdi,%rax,8), %rax
+  push %rax
+  mov $2, %rax
+  mov (%rdi,%rax,8), %rax
+  pop %rdi
+  add %rdi, %rax
+  push %rax
+  mov $299999, %rax
+  lea table+8(%rip), %rdi
+  mov (%rdi,%rax,8), %rax
+  push %rax
+  mov $1, %rax
+  lea (%rdi,%rax,8), %rax
+  push %rax
+  xor %rax, %rax
+  lea (%rdi,%rax,8), %rax
+  mov %rax, %rdi
+  pop %rax
+  sub %rdi, %rax
+  push %rax
+  pop %rcx
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  call printf
+  add $16, %rsp
+  xor %rax, %rax
+  add $16, %rsp
+  ret
+.section .rodata
+.string.0:
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 10
+  .byte 0
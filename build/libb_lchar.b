@@ -0,0 +1,13 @@
+
+        main() {
+            auto str;
+
+            lchar(&str, 0, 'f');
+            lchar(&str, 1, 'u');
+            lchar(&str, 2, 'b');
+            lchar(&str, 3, 'a');
+            lchar(&str, 4, 'r');
+            lchar(&str, 5, 0);
+            printf("%s*n", &str);
+        }
+    
\ No newline at end of file
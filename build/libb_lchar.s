@@ -0,0 +1,86 @@
+.globl main
+.section .text.sorted.00001,"ax",@progbits
+.align 16
+.type main, @function
+main:
+  sub $8, %rsp
+  sub $8, %rsp
+  sub $8, %rsp
+  sub $8, %rsp
+  lea 8(%rsp), %rax
+  push %rax
+  xor %rax, %rax
+  push %rax
+  mov $102, %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  call lchar
+  lea 8(%rsp), %rax
+  push %rax
+  mov $1, %rax
+  push %rax
+  mov $117, %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  call lchar
+  lea 8(%rsp), %rax
+  push %rax
+  mov $2, %rax
+  push %rax
+  mov $98, %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  call lchar
+  lea 8(%rsp), %rax
+  push %rax
+  mov $3, %rax
+  push %rax
+  mov $97, %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  call lchar
+  lea 8(%rsp), %rax
+  push %rax
+  mov $4, %rax
+  push %rax
+  mov $114, %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  call lchar
+  lea 8(%rsp), %rax
+  push %rax
+  mov $5, %rax
+  push %rax
+  xor %rax, %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  call lchar
+  lea .string.0(%rip), %rax
+  push %rax
+  lea 16(%rsp), %rax
+  push %rax
+  pop %rsi
+  pop %rdi
+  call printf
+  add $16, %rsp
+  xor %rax, %rax
+  add $16, %rsp
+  ret
+.section .rodata
+.string.0:
+  .byte 37
+  .byte 115
+  .byte 10
+  .byte 0
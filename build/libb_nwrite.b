@@ -0,0 +1,5 @@
+
+        main() {
+            nwrite(1, "foobar*n", 7);
+        }
+    
\ No newline at end of file
@@ -0,0 +1,30 @@
+.globl main
+.section .text.sorted.00001,"ax",@progbits
+.align 16
+.type main, @function
+main:
+  sub $8, %rsp
+  sub $8, %rsp
+  mov $1, %rax
+  push %rax
+  lea .string.0(%rip), %rax
+  push %rax
+  mov $7, %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  call nwrite
+  xor %rax, %rax
+  add $16, %rsp
+  ret
+.section .rodata
+.string.0:
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 98
+  .byte 97
+  .byte 114
+  .byte 10
+  .byte 0
@@ -0,0 +1,10 @@
+
+        main() {
+            printf("Hello, World!*n");
+            printf("%% %% %%%%*n");
+            printf("format %%d: %d %d*n", 123, -123);
+            printf("format %%o: %o %o*n", 234, -234);
+            printf("format %%c: %c %c*n", 'foo', 'bar');
+            printf("format %%s: *"%s*" *"%s*"*n", "Hello", "World");
+        }
+    
\ No newline at end of file
@@ -0,0 +1,186 @@
+.globl main
+.section .text.sorted.00001,"ax",@progbits
+.align 16
+.type main, @function
+main:
+  sub $8, %rsp
+  sub $8, %rsp
+  lea .string.0(%rip), %rax
+  push %rax
+  pop %rdi
+  call printf
+  lea .string.1(%rip), %rax
+  push %rax
+  pop %rdi
+  call printf
+  lea .string.2(%rip), %rax
+  push %rax
+  mov $123, %rax
+  push %rax
+  neg %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  call printf
+  lea .string.3(%rip), %rax
+  push %rax
+  mov $234, %rax
+  push %rax
+  neg %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  call printf
+  lea .string.4(%rip), %rax
+  push %rax
+  mov $7303014, %rax
+  push %rax
+  mov $7496034, %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  call printf
+  lea .string.5(%rip), %rax
+  push %rax
+  lea .string.6(%rip), %rax
+  push %rax
+  lea .string.7(%rip), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  call printf
+  xor %rax, %rax
+  add $16, %rsp
+  ret
+.section .rodata
+.string.0:
+  .byte 72
+  .byte 101
+  .byte 108
+  .byte 108
+  .byte 111
+  .byte 44
+  .byte 32
+  .byte 87
+  .byte 111
+  .byte 114
+  .byte 108
+  .byte 100
+  .byte 33
+  .byte 10
+  .byte 0
+.string.1:
+  .byte 37
+  .byte 37
+  .byte 32
+  .byte 37
+  .byte 37
+  .byte 32
+  .byte 37
+  .byte 37
+  .byte 37
+  .byte 37
+  .byte 10
+  .byte 0
+.string.2:
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 109
+  .byte 97
+  .byte 116
+  .byte 32
+  .byte 37
+  .byte 37
+  .byte 100
+  .byte 58
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 10
+  .byte 0
+.string.3:
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 109
+  .byte 97
+  .byte 116
+  .byte 32
+  .byte 37
+  .byte 37
+  .byte 111
+  .byte 58
+  .byte 32
+  .byte 37
+  .byte 111
+  .byte 32
+  .byte 37
+  .byte 111
+  .byte 10
+  .byte 0
+.string.4:
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 109
+  .byte 97
+  .byte 116
+  .byte 32
+  .byte 37
+  .byte 37
+  .byte 99
+  .byte 58
+  .byte 32
+  .byte 37
+  .byte 99
+  .byte 32
+  .byte 37
+  .byte 99
+  .byte 10
+  .byte 0
+.string.5:
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 109
+  .byte 97
+  .byte 116
+  .byte 32
+  .byte 37
+  .byte 37
+  .byte 115
+  .byte 58
+  .byte 32
+  .byte 34
+  .byte 37
+  .byte 115
+  .byte 34
+  .byte 32
+  .byte 34
+  .byte 37
+  .byte 115
+  .byte 34
+  .byte 10
+  .byte 0
+.string.6:
+  .byte 72
+  .byte 101
+  .byte 108
+  .byte 108
+  .byte 111
+  .byte 0
+.string.7:
+  .byte 87
+  .byte 111
+  .byte 114
+  .byte 108
+  .byte 100
+  .byte 0
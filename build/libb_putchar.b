@@ -0,0 +1,7 @@
+
+        main() {
+            putchar('Hello,');
+            putchar(' World');
+            putchar('!*n');
+        }
+    
\ No newline at end of file
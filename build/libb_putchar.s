@@ -0,0 +1,23 @@
+.globl main
+.section .text.sorted.00001,"ax",@progbits
+.align 16
+.type main, @function
+main:
+  sub $8, %rsp
+  sub $8, %rsp
+  mov $48857072035144, %rax
+  push %rax
+  pop %rdi
+  call putchar
+  mov $110416939144992, %rax
+  push %rax
+  pop %rdi
+  call putchar
+  mov $2593, %rax
+  push %rax
+  pop %rdi
+  call putchar
+  xor %rax, %rax
+  add $16, %rsp
+  ret
+.section .rodata
@@ -0,0 +1,19 @@
+
+        v[37]; w[37];
+
+        main() {
+            extrn v, w;
+            auto i;
+
+            i = 0;
+            while (i < 37) {
+                v[i] = i * 7 % 23 - 11;
+                w[i] = i;
+                i++;
+            }
+            printf("%d %d %d %d*n", vsum(v, 37), vmin(v, 37), vmax(v, 37), vdot(v, w, 37));
+            printf("%d %d %d %d*n", vmin(&v[1], 36), vmin(v, 0), vcount(v, 37, 3), vcountle(v, 37, 0));
+            vaxpy(w, -2, v, 37);
+            printf("%d %d*n", vsum(w, 37), w[36]);
+        }
+    
\ No newline at end of file
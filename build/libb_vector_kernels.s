@@ -0,0 +1,249 @@
+.globl v
+.data
+.type v, @object
+.align 4
+v:
+  .long .+4
+  .zero 148
+.globl w
+.data
+.type w, @object
+.align 4
+w:
+  .long .+4
+  .zero 148
+.globl main
+.section .text.sorted.00001,"ax",@progbits
+.align 16
+.type main, @function
+main:
+  sub $8, %rsp
+  sub $4, %rsp
+  sub $4, %rsp
+  sub $4, %rsp
+  sub $4, %rsp
+  sub $4, %rsp
+  xor %rax, %rax
+  mov %eax, 12(%rsp)
+.align 16
+.L.start.1:
+  movslq 12(%rsp), %rax
+  cmp $37, %rax
+  setl %al
+  movzb %al, %rax
+  test %rax, %rax
+  je .L.end.1
+  movslq 12(%rsp), %rax
+  lea v+4(%rip), %rdi
+  lea (%rdi,%rax,4), %rax
+  push %rax
+  movslq (%rax), %rax
+  movslq 20(%rsp), %rax
+  imul $7, %rax
+  push %rax
+  pop %rax
+  mov %rax, %rcx
+  movabs $-5614226457215950491, %rdx
+  imul %rdx
+  add %rcx, %rdx
+  sar $4, %rdx
+  mov %rcx, %rax
+  shr $63, %rax
+  add %rdx, %rax
+  imul $23, %rax
+  sub %rax, %rcx
+  mov %rcx, %rax
+  sub $11, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  movslq 12(%rsp), %rax
+  lea w+4(%rip), %rdi
+  lea (%rdi,%rax,4), %rax
+  push %rax
+  movslq (%rax), %rax
+  movslq 20(%rsp), %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  lea 12(%rsp), %rax
+  movslq (%rax), %rcx
+  addl $1, (%rax)
+  mov %rcx, %rax
+  jmp .L.start.1
+.L.end.1:
+  lea .string.0(%rip), %rax
+  push %rax
+  lea v+4(%rip), %rax
+  push %rax
+  mov $37, %rax
+  push %rax
+  pop %rsi
+  pop %rdi
+  call vsum
+  movslq %eax, %rax
+  push %rax
+  lea v+4(%rip), %rax
+  push %rax
+  mov $37, %rax
+  push %rax
+  pop %rsi
+  pop %rdi
+  call vmin
+  movslq %eax, %rax
+  push %rax
+  lea v+4(%rip), %rax
+  push %rax
+  mov $37, %rax
+  push %rax
+  pop %rsi
+  pop %rdi
+  call vmax
+  movslq %eax, %rax
+  push %rax
+  lea v+4(%rip), %rax
+  push %rax
+  lea w+4(%rip), %rax
+  push %rax
+  mov $37, %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  call vdot
+  movslq %eax, %rax
+  push %rax
+  pop %r8
+  pop %rcx
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  call printf
+  movslq %eax, %rax
+  lea .string.1(%rip), %rax
+  push %rax
+  mov $1, %rax
+  lea v+4(%rip), %rdi
+  lea (%rdi,%rax,4), %rax
+  push %rax
+  mov $36, %rax
+  push %rax
+  pop %rsi
+  pop %rdi
+  call vmin
+  movslq %eax, %rax
+  push %rax
+  lea v+4(%rip), %rax
+  push %rax
+  xor %rax, %rax
+  push %rax
+  pop %rsi
+  pop %rdi
+  call vmin
+  movslq %eax, %rax
+  push %rax
+  lea v+4(%rip), %rax
+  push %rax
+  mov $37, %rax
+  push %rax
+  mov $3, %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  call vcount
+  movslq %eax, %rax
+  push %rax
+  lea v+4(%rip), %rax
+  push %rax
+  mov $37, %rax
+  push %rax
+  xor %rax, %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  call vcountle
+  movslq %eax, %rax
+  push %rax
+  pop %r8
+  pop %rcx
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  call printf
+  movslq %eax, %rax
+  lea w+4(%rip), %rax
+  push %rax
+  mov $2, %rax
+  neg %rax
+  push %rax
+  lea v+4(%rip), %rax
+  push %rax
+  mov $37, %rax
+  push %rax
+  pop %rcx
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  call vaxpy
+  movslq %eax, %rax
+  lea .string.2(%rip), %rax
+  push %rax
+  lea w+4(%rip), %rax
+  push %rax
+  mov $37, %rax
+  push %rax
+  pop %rsi
+  pop %rdi
+  call vsum
+  movslq %eax, %rax
+  push %rax
+  mov $36, %rax
+  lea w+4(%rip), %rdi
+  movslq (%rdi,%rax,4), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  call printf
+  movslq %eax, %rax
+  add $16, %rsp
+  xor %rax, %rax
+  add $12, %rsp
+  ret
+.section .rodata
+.string.0:
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 10
+  .byte 0
+.string.1:
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 10
+  .byte 0
+.string.2:
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 10
+  .byte 0
@@ -0,0 +1,10 @@
+
+        main() {
+            auto l[3];
+
+            l[0] = 123;
+            l[1] = 'local';
+            l[2] = "string";
+            printf("local = %d, '%c', *"%s*"*n", l[0], l[1], l[2]);
+        }
+    
\ No newline at end of file
@@ -0,0 +1,94 @@
+.globl main
+.section .text.sorted.00001,"ax",@progbits
+.align 16
+.type main, @function
+main:
+  sub $8, %rsp
+  sub $8, %rsp
+  sub $32, %rsp
+  lea 8(%rsp), %rax
+  mov %rax, 0(%rsp)
+  push %rax
+  xor %rax, %rax
+  pop %rdi
+  lea (%rdi,%rax,8), %rax
+  push %rax
+  mov $123, %rax
+  pop %rdi
+  mov %rax, (%rdi)
+  push 0(%rsp)
+  mov $1, %rax
+  pop %rdi
+  lea (%rdi,%rax,8), %rax
+  push %rax
+  mov $465490374508, %rax
+  pop %rdi
+  mov %rax, (%rdi)
+  push 0(%rsp)
+  mov $2, %rax
+  pop %rdi
+  lea (%rdi,%rax,8), %rax
+  push %rax
+  lea .string.0(%rip), %rax
+  pop %rdi
+  mov %rax, (%rdi)
+  lea .string.1(%rip), %rax
+  push %rax
+  push 8(%rsp)
+  xor %rax, %rax
+  pop %rdi
+  mov (%rdi,%rax,8), %rax
+  push %rax
+  push %rdi
+  mov $1, %rax
+  pop %rdi
+  mov (%rdi,%rax,8), %rax
+  push %rax
+  push %rdi
+  mov $2, %rax
+  pop %rdi
+  mov (%rdi,%rax,8), %rax
+  push %rax
+  pop %rcx
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  call printf
+  add $32, %rsp
+  xor %rax, %rax
+  add $16, %rsp
+  ret
+.section .rodata
+.string.0:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 105
+  .byte 110
+  .byte 103
+  .byte 0
+.string.1:
+  .byte 108
+  .byte 111
+  .byte 99
+  .byte 97
+  .byte 108
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 44
+  .byte 32
+  .byte 39
+  .byte 37
+  .byte 99
+  .byte 39
+  .byte 44
+  .byte 32
+  .byte 34
+  .byte 37
+  .byte 115
+  .byte 34
+  .byte 10
+  .byte 0
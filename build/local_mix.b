@@ -0,0 +1,20 @@
+
+        main() {
+            auto e, d;
+            auto c[1];
+            auto b, a;
+            auto p;
+
+            a = 11;
+            b = 22;
+            c[0] = 33;
+            d = 44;
+            e = 55;
+
+            printf("%d %d %d %d", a, b, c - &c, c[0]);
+            printf(" %d %d*n", d, e);
+            p = &a;
+            printf("%d %d %d %d", p[0], p[1], p[2] - &c, p[3]);
+            printf(" %d %d*n", p[4], p[5]);
+        }
+    
\ No newline at end of file
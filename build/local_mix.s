@@ -0,0 +1,166 @@
+.globl main
+.section .text.sorted.00001,"ax",@progbits
+.align 16
+.type main, @function
+main:
+  sub $8, %rsp
+  sub $8, %rsp
+  sub $8, %rsp
+  sub $8, %rsp
+  sub $16, %rsp
+  lea 8(%rsp), %rax
+  mov %rax, 0(%rsp)
+  sub $8, %rsp
+  sub $8, %rsp
+  sub $8, %rsp
+  sub $8, %rsp
+  mov $11, %rax
+  mov %rax, 16(%rsp)
+  mov $22, %rax
+  mov %rax, 24(%rsp)
+  push 32(%rsp)
+  xor %rax, %rax
+  pop %rdi
+  lea (%rdi,%rax,8), %rax
+  push %rax
+  mov $33, %rax
+  pop %rdi
+  mov %rax, (%rdi)
+  mov $44, %rax
+  mov %rax, 48(%rsp)
+  mov $55, %rax
+  mov %rax, 56(%rsp)
+  lea .string.0(%rip), %rax
+  push %rax
+  mov 24(%rsp), %rax
+  push %rax
+  mov 40(%rsp), %rax
+  push %rax
+  mov 56(%rsp), %rax
+  push %rax
+  lea 64(%rsp), %rax
+  mov %rax, %rdi
+  pop %rax
+  sub %rdi, %rax
+  push %rax
+  push 64(%rsp)
+  xor %rax, %rax
+  pop %rdi
+  mov (%rdi,%rax,8), %rax
+  push %rax
+  pop %r8
+  pop %rcx
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  call printf
+  lea .string.1(%rip), %rax
+  push %rax
+  mov 56(%rsp), %rax
+  push %rax
+  mov 72(%rsp), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  call printf
+  lea 16(%rsp), %rax
+  mov %rax, 8(%rsp)
+  lea .string.2(%rip), %rax
+  push %rax
+  push 16(%rsp)
+  xor %rax, %rax
+  pop %rdi
+  mov (%rdi,%rax,8), %rax
+  push %rax
+  push %rdi
+  mov $1, %rax
+  pop %rdi
+  mov (%rdi,%rax,8), %rax
+  push %rax
+  push %rdi
+  mov $2, %rax
+  pop %rdi
+  mov (%rdi,%rax,8), %rax
+  push %rax
+  lea 64(%rsp), %rax
+  mov %rax, %rdi
+  pop %rax
+  sub %rdi, %rax
+  push %rax
+  push 40(%rsp)
+  mov $3, %rax
+  pop %rdi
+  mov (%rdi,%rax,8), %rax
+  push %rax
+  pop %r8
+  pop %rcx
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  call printf
+  lea .string.3(%rip), %rax
+  push %rax
+  push 16(%rsp)
+  mov $4, %rax
+  pop %rdi
+  mov (%rdi,%rax,8), %rax
+  push %rax
+  push %rdi
+  mov $5, %rax
+  pop %rdi
+  mov (%rdi,%rax,8), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  call printf
+  add $64, %rsp
+  xor %rax, %rax
+  add $16, %rsp
+  ret
+.section .rodata
+.string.0:
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 0
+.string.1:
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 10
+  .byte 0
+.string.2:
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 0
+.string.3:
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 10
+  .byte 0
@@ -0,0 +1,104 @@
+.globl main
+.section .text.sorted.00001,"ax",@progbits
+.align 16
+.type main, @function
+main:
+  sub $8, %rsp
+  sub $8, %rsp
+  sub $992, %rsp
+  lea 8(%rsp), %rax
+  mov %rax, 0(%rsp)
+  sub $968, %rsp
+  lea 8(%rsp), %rax
+  mov %rax, 0(%rsp)
+  sub $8, %rsp
+  sub $8, %rsp
+  sub $8, %rsp
+  lea .string.0(%rip), %rax
+  push %rax
+  lea 1000(%rsp), %rax
+  push %rax
+  mov %rax, %rdi
+  pop %rax
+  sub %rdi, %rax
+  push %rax
+  pop %rsi
+  pop %rdi
+  call printf
+  lea .string.1(%rip), %rax
+  push %rax
+  lea 32(%rsp), %rax
+  push %rax
+  lea 1008(%rsp), %rax
+  mov %rax, %rdi
+  pop %rax
+  sub %rdi, %rax
+  push %rax
+  pop %rsi
+  pop %rdi
+  call printf
+  lea .string.2(%rip), %rax
+  push %rax
+  lea 16(%rsp), %rax
+  push %rax
+  lea 1008(%rsp), %rax
+  mov %rax, %rdi
+  pop %rax
+  sub %rdi, %rax
+  push %rax
+  pop %rsi
+  pop %rdi
+  call printf
+  add $1984, %rsp
+  xor %rax, %rax
+  add $16, %rsp
+  ret
+.section .rodata
+.string.0:
+  .byte 111
+  .byte 102
+  .byte 102
+  .byte 115
+  .byte 101
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 10
+  .byte 0
+.string.1:
+  .byte 111
+  .byte 102
+  .byte 102
+  .byte 115
+  .byte 101
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 10
+  .byte 0
+.string.2:
+  .byte 111
+  .byte 102
+  .byte 102
+  .byte 115
+  .byte 101
+  .byte 116
+  .byte 32
+  .byte 99
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 10
+  .byte 0
@@ -0,0 +1,11 @@
+
+        main() {
+            auto a[];
+            auto b[123];
+            auto c[];
+
+            printf("offset a = %d*n", (&a) - &a);
+            printf("offset b = %d*n", (&b) - &a);
+            printf("offset c = %d*n", (&c) - &a);
+        }
+    
\ No newline at end of file
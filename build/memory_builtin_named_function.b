@@ -0,0 +1,16 @@
+
+        main() {
+            auto a, b, c;
+
+            a = 1;
+            b = 2;
+            c = 3;
+            if (likely(a))
+                printf("%d %d*n", prefetch(a, b, c), likely(5));
+            sfence();
+        }
+
+        prefetch(a, b, c) return (a + b * c);
+        likely(x) return (x * 2);
+        sfence() printf("sfence*n");
+    
\ No newline at end of file
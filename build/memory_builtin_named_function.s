@@ -0,0 +1,117 @@
+.globl main
+.section .text.sorted.00002,"ax",@progbits
+.align 16
+.type main, @function
+main:
+  sub $8, %rsp
+  sub $8, %rsp
+  sub $8, %rsp
+  sub $8, %rsp
+  sub $8, %rsp
+  sub $8, %rsp
+  mov $1, %rax
+  mov %rax, 24(%rsp)
+  mov $2, %rax
+  mov %rax, 16(%rsp)
+  mov $3, %rax
+  mov %rax, 8(%rsp)
+  mov 24(%rsp), %rax
+  push %rax
+  call likely.internal
+  add $8, %rsp
+  test %rax, %rax
+  je .L.else.1
+  lea .string.0(%rip), %rax
+  push %rax
+  mov 32(%rsp), %rax
+  push %rax
+  mov 32(%rsp), %rax
+  push %rax
+  mov 32(%rsp), %rax
+  push %rax
+  call prefetch.internal
+  add $24, %rsp
+  push %rax
+  mov $5, %rax
+  push %rax
+  call likely.internal
+  add $8, %rsp
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  call printf
+.L.else.1:
+  call sfence
+  add $32, %rsp
+  xor %rax, %rax
+  add $16, %rsp
+  ret
+.globl prefetch
+.section .text.sorted.00003,"ax",@progbits
+.type prefetch, @function
+prefetch:
+  push %rdi
+  push %rsi
+  push %rdx
+  call prefetch.internal
+  add $24, %rsp
+  ret
+.section .text.sorted.00003,"ax",@progbits
+.align 16
+.type prefetch.internal, @function
+prefetch.internal:
+  mov 24(%rsp), %rax
+  mov %rax, -16(%rsp)
+  mov 16(%rsp), %rax
+  imul 8(%rsp), %rax
+  mov -16(%rsp), %rdi
+  add %rdi, %rax
+  ret
+.globl likely
+.section .text.sorted.00001,"ax",@progbits
+.type likely, @function
+likely:
+  push %rdi
+  call likely.internal
+  add $8, %rsp
+  ret
+.section .text.sorted.00001,"ax",@progbits
+.align 16
+.type likely.internal, @function
+likely.internal:
+  mov 8(%rsp), %rax
+  shl $1, %rax
+  ret
+.globl sfence
+.section .text.sorted.00004,"ax",@progbits
+.align 16
+.type sfence, @function
+sfence:
+  sub $8, %rsp
+  sub $8, %rsp
+  lea .string.1(%rip), %rax
+  push %rax
+  pop %rdi
+  call printf
+  xor %rax, %rax
+  add $16, %rsp
+  ret
+.section .rodata
+.string.0:
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 10
+  .byte 0
+.string.1:
+  .byte 115
+  .byte 102
+  .byte 101
+  .byte 110
+  .byte 99
+  .byte 101
+  .byte 10
+  .byte 0
@@ -0,0 +1,23 @@
+
+        v[16];
+
+        main() {
+            extrn v;
+            auto i, p, s;
+
+            i = 0;
+            while (i < 16) {
+                p = &v[i];
+                prefetch(p + 64, 0, 0);
+                prefetch(p + 64, 1, 3);
+                ntstore(p, i * 3);
+                i++;
+            }
+            sfence();
+            s = 0;
+            i = 0;
+            while (i < 16)
+                s =+ v[i++];
+            printf("%d*n", s);
+        }
+    
\ No newline at end of file
@@ -0,0 +1,91 @@
+.globl v
+.data
+.type v, @object
+.align 4
+v:
+  .long .+4
+  .zero 64
+.globl main
+.section .text.sorted.00001,"ax",@progbits
+.align 16
+.type main, @function
+main:
+  sub $8, %rsp
+  sub $4, %rsp
+  sub $4, %rsp
+  sub $4, %rsp
+  sub $4, %rsp
+  sub $4, %rsp
+  xor %rax, %rax
+  mov %eax, 12(%rsp)
+.align 16
+.L.start.2:
+  movslq 12(%rsp), %rax
+  cmp $16, %rax
+  setl %al
+  movzb %al, %rax
+  test %rax, %rax
+  je .L.end.2
+  lea 8(%rsp), %rax
+  movslq 12(%rsp), %rax
+  lea v+4(%rip), %rdi
+  lea (%rdi,%rax,4), %rax
+  mov %eax, 8(%rsp)
+  movslq 8(%rsp), %rax
+  add $64, %rax
+  prefetchnta (%rax)
+  movslq 8(%rsp), %rax
+  add $64, %rax
+  prefetchw (%rax)
+  movslq 8(%rsp), %rax
+  push %rax
+  movslq 20(%rsp), %rax
+  imul $3, %rax
+  pop %rdi
+  movnti %eax, (%rdi)
+  lea 12(%rsp), %rax
+  movslq (%rax), %rcx
+  addl $1, (%rax)
+  mov %rcx, %rax
+  jmp .L.start.2
+.L.end.2:
+  sfence
+  xor %rax, %rax
+  mov %eax, 4(%rsp)
+  mov %eax, 12(%rsp)
+.align 16
+.L.start.3:
+  movslq 12(%rsp), %rax
+  cmp $16, %rax
+  setl %al
+  movzb %al, %rax
+  test %rax, %rax
+  je .L.end.3
+  lea 12(%rsp), %rax
+  movslq (%rax), %rcx
+  addl $1, (%rax)
+  mov %rcx, %rax
+  lea v+4(%rip), %rdi
+  movslq (%rdi,%rax,4), %rax
+  add %eax, 4(%rsp)
+  movslq 4(%rsp), %rax
+  jmp .L.start.3
+.L.end.3:
+  lea .string.0(%rip), %rax
+  push %rax
+  movslq 12(%rsp), %rax
+  push %rax
+  pop %rsi
+  pop %rdi
+  call printf
+  movslq %eax, %rax
+  add $16, %rsp
+  xor %rax, %rax
+  add $12, %rsp
+  ret
+.section .rodata
+.string.0:
+  .byte 37
+  .byte 100
+  .byte 10
+  .byte 0
@@ -0,0 +1,277 @@
+.globl main
+.section .text.sorted.00001,"ax",@progbits
+.align 16
+.type main, @function
+main:
+  sub $8, %rsp
+  sub $8, %rsp
+  sub $8, %rsp
+  sub $8, %rsp
+  mov x(%rip), %rax
+  push %rax
+  mov $100, %rax
+  pop %rdi
+  add %rdi, %rax
+  mov %rax, 8(%rsp)
+  lea .string.0(%rip), %rax
+  push %rax
+  mov %rdi, %rax
+  push %rax
+  mov 24(%rsp), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  call printf
+  mov x(%rip), %rax
+  test %rax, %rax
+  je .L.else.5
+  lea .string.1(%rip), %rax
+  jmp .L.tail.main.0
+.L.else.5:
+  lea .string.2(%rip), %rax
+.L.tail.main.0:
+  push %rax
+  pop %rdi
+  call printf
+  mov 8(%rsp), %rax
+  test %rax, %rax
+  je .L.else.6
+  lea .string.3(%rip), %rax
+  jmp .L.tail.main.1
+.L.else.6:
+  lea .string.4(%rip), %rax
+.L.tail.main.1:
+  push %rax
+  pop %rdi
+  call printf
+  mov x(%rip), %rax
+  test %rax, %rax
+  sete %al
+  movzx %al, %rax
+  test %rax, %rax
+  je .L.else.7
+  lea .string.5(%rip), %rax
+  jmp .L.tail.main.2
+.L.else.7:
+  lea .string.6(%rip), %rax
+.L.tail.main.2:
+  push %rax
+  pop %rdi
+  call printf
+  mov 8(%rsp), %rax
+  test %rax, %rax
+  sete %al
+  movzx %al, %rax
+  test %rax, %rax
+  je .L.else.8
+  lea .string.7(%rip), %rax
+  jmp .L.tail.main.3
+.L.else.8:
+  lea .string.8(%rip), %rax
+.L.tail.main.3:
+  push %rax
+  pop %rdi
+  call printf
+.align 16
+.L.start.9:
+  mov x(%rip), %rax
+  test %rax, %rax
+  sete %al
+  movzx %al, %rax
+  test %rax, %rax
+  je .L.end.9
+  lea .string.9(%rip), %rax
+  push %rax
+  mov x(%rip), %rax
+  push %rax
+  pop %rsi
+  pop %rdi
+  call printf
+  lea x(%rip), %rax
+  push %rax
+  mov $42, %rax
+  pop %rdi
+  mov %rax, (%rdi)
+  jmp .L.start.9
+.L.end.9:
+  add $16, %rsp
+  xor %rax, %rax
+  add $16, %rsp
+  ret
+.globl x
+.data
+.type x, @object
+.align 8
+x:
+  .zero 8
+.section .rodata
+.string.0:
+  .byte 120
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 44
+  .byte 32
+  .byte 121
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 10
+  .byte 0
+.string.1:
+  .byte 105
+  .byte 102
+  .byte 32
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 32
+  .byte 87
+  .byte 82
+  .byte 79
+  .byte 78
+  .byte 71
+  .byte 10
+  .byte 0
+.string.2:
+  .byte 105
+  .byte 102
+  .byte 32
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 32
+  .byte 67
+  .byte 111
+  .byte 114
+  .byte 114
+  .byte 101
+  .byte 99
+  .byte 116
+  .byte 10
+  .byte 0
+.string.3:
+  .byte 105
+  .byte 102
+  .byte 32
+  .byte 40
+  .byte 121
+  .byte 41
+  .byte 32
+  .byte 67
+  .byte 111
+  .byte 114
+  .byte 114
+  .byte 101
+  .byte 99
+  .byte 116
+  .byte 10
+  .byte 0
+.string.4:
+  .byte 105
+  .byte 102
+  .byte 32
+  .byte 40
+  .byte 121
+  .byte 41
+  .byte 32
+  .byte 87
+  .byte 82
+  .byte 79
+  .byte 78
+  .byte 71
+  .byte 10
+  .byte 0
+.string.5:
+  .byte 105
+  .byte 102
+  .byte 32
+  .byte 40
+  .byte 33
+  .byte 120
+  .byte 41
+  .byte 32
+  .byte 67
+  .byte 111
+  .byte 114
+  .byte 114
+  .byte 101
+  .byte 99
+  .byte 116
+  .byte 10
+  .byte 0
+.string.6:
+  .byte 105
+  .byte 102
+  .byte 32
+  .byte 40
+  .byte 33
+  .byte 120
+  .byte 41
+  .byte 32
+  .byte 87
+  .byte 82
+  .byte 79
+  .byte 78
+  .byte 71
+  .byte 10
+  .byte 0
+.string.7:
+  .byte 105
+  .byte 102
+  .byte 32
+  .byte 40
+  .byte 33
+  .byte 121
+  .byte 41
+  .byte 32
+  .byte 87
+  .byte 82
+  .byte 79
+  .byte 78
+  .byte 71
+  .byte 10
+  .byte 0
+.string.8:
+  .byte 105
+  .byte 102
+  .byte 32
+  .byte 40
+  .byte 33
+  .byte 121
+  .byte 41
+  .byte 32
+  .byte 67
+  .byte 111
+  .byte 114
+  .byte 114
+  .byte 101
+  .byte 99
+  .byte 116
+  .byte 10
+  .byte 0
+.string.9:
+  .byte 119
+  .byte 104
+  .byte 105
+  .byte 108
+  .byte 101
+  .byte 32
+  .byte 40
+  .byte 33
+  .byte 120
+  .byte 41
+  .byte 32
+  .byte 120
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 10
+  .byte 0
@@ -0,0 +1,10 @@
+
+
+        main() {
+            auto v;
+            v = 012345;
+            printf("%d*n", v);
+            v = -04567;
+            printf("%d*n", v);
+        }
+    
\ No newline at end of file
@@ -0,0 +1,16 @@
+
+        sum(n) {
+            auto i, s;
+
+            i = s = 0;
+            while (i < n) {
+                s =+ i;
+                i++;
+            }
+            return (s);
+        }
+
+        main() {
+            printf("%d %d*n", sum(10), sum(100));
+        }
+    
\ No newline at end of file
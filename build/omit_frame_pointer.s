@@ -0,0 +1,68 @@
+.globl sum
+.section .text.sorted.00002,"ax",@progbits
+.type sum, @function
+sum:
+  push %rdi
+  call sum.internal
+  add $8, %rsp
+  ret
+.section .text.sorted.00002,"ax",@progbits
+.align 16
+.type sum.internal, @function
+sum.internal:
+  xor %rax, %rax
+  mov %rax, -24(%rsp)
+  mov %rax, -16(%rsp)
+.align 16
+.L.start.1:
+  mov -16(%rsp), %rax
+  cmp 8(%rsp), %rax
+  setl %al
+  movzb %al, %rax
+  test %rax, %rax
+  je .L.end.1
+  mov -16(%rsp), %rax
+  add %rax, -24(%rsp)
+  lea -16(%rsp), %rax
+  mov (%rax), %rcx
+  addq $1, (%rax)
+  mov %rcx, %rax
+  jmp .L.start.1
+.L.end.1:
+  mov -24(%rsp), %rax
+  ret
+.globl main
+.section .text.sorted.00001,"ax",@progbits
+.align 16
+.type main, @function
+main:
+  sub $8, %rsp
+  sub $8, %rsp
+  lea .string.0(%rip), %rax
+  push %rax
+  mov $10, %rax
+  push %rax
+  call sum.internal
+  add $8, %rsp
+  push %rax
+  mov $100, %rax
+  push %rax
+  call sum.internal
+  add $8, %rsp
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  call printf
+  xor %rax, %rax
+  add $16, %rsp
+  ret
+.section .rodata
+.string.0:
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 10
+  .byte 0
@@ -0,0 +1,105 @@
+.globl sign
+.text
+.type sign, @function
+sign:
+  push %rbp
+  mov %rsp, %rbp
+  sub $8, %rsp
+  sub $8, %rsp
+  mov %rdi, -16(%rbp)
+  lea -16(%rbp), %rax
+  mov (%rax), %rax
+  push %rax
+  xor %rax, %rax
+  pop %rdi
+  cmp %rax, %rdi
+  setl %al
+  movzb %al, %rax
+  cmp $0, %rax
+  je .L.else.0
+  mov $1, %rax
+  neg %rax
+  jmp .L.return.sign
+  jmp .L.end.0
+.L.else.0:
+  lea -16(%rbp), %rax
+  mov (%rax), %rax
+  push %rax
+  xor %rax, %rax
+  pop %rdi
+  cmp %rax, %rdi
+  setg %al
+  movzb %al, %rax
+  cmp $0, %rax
+  je .L.cond.else.0
+  mov $1, %rax
+  jmp .L.cond.end.0
+.L.cond.else.0:
+  xor %rax, %rax
+.L.cond.end.0:
+  jmp .L.return.sign
+.L.end.0:
+  xor %rax, %rax
+.L.return.sign:
+  mov %rbp, %rsp
+  pop %rbp
+  ret
+.globl main
+.text
+.type main, @function
+main:
+  push %rbp
+  mov %rsp, %rbp
+  sub $8, %rsp
+  lea printf(%rip), %rax
+  push %rax
+  lea .string.0(%rip), %rax
+  push %rax
+  lea sign(%rip), %rax
+  push %rax
+  mov $7, %rax
+  neg %rax
+  push %rax
+  pop %rdi
+  pop %r10
+  call *%r10
+  push %rax
+  lea sign(%rip), %rax
+  push %rax
+  xor %rax, %rax
+  push %rax
+  pop %rdi
+  pop %r10
+  call *%r10
+  push %rax
+  lea sign(%rip), %rax
+  push %rax
+  mov $7, %rax
+  push %rax
+  pop %rdi
+  pop %r10
+  call *%r10
+  push %rax
+  pop %rcx
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  pop %r10
+  call *%r10
+  xor %rax, %rax
+.L.return.main:
+  mov %rbp, %rsp
+  pop %rbp
+  ret
+.section .rodata
+.string.0:
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 10
+  .byte 0
@@ -0,0 +1,11 @@
+
+    sign(x) {
+        if (x < 0)
+            return (-1);
+        else
+            return (x > 0 ? 1 : 0);
+    }
+
+    main() {
+        printf("%d %d %d*n", sign(-7), sign(0), sign(7));
+    }
@@ -0,0 +1,81 @@
+.globl sign
+.text
+.type sign, @function
+sign:
+  push %rbp
+  mov %rsp, %rbp
+  sub $8, %rsp
+  sub $8, %rsp
+  mov %rdi, -16(%rbp)
+  mov -16(%rbp), %rax
+  test %rax, %rax
+  setl %al
+  movzb %al, %rax
+  test %rax, %rax
+  je .L.else.1
+  mov $1, %rax
+  neg %rax
+  jmp .L.return.sign
+.L.else.1:
+  mov -16(%rbp), %rax
+  test %rax, %rax
+  setg %al
+  movzb %al, %rax
+  push %rax
+  mov $1, %rax
+  push %rax
+  xor %rax, %rax
+  pop %rdi
+  pop %rcx
+  cmp $0, %rcx
+  cmovne %rdi, %rax
+.L.return.sign:
+  mov %rbp, %rsp
+  pop %rbp
+  ret
+.globl main
+.text
+.type main, @function
+main:
+  push %rbp
+  mov %rsp, %rbp
+  sub $8, %rsp
+  lea .string.0(%rip), %rax
+  push %rax
+  mov $7, %rax
+  neg %rax
+  push %rax
+  pop %rdi
+  call sign
+  push %rax
+  xor %rax, %rax
+  push %rax
+  pop %rdi
+  call sign
+  push %rax
+  mov $7, %rax
+  push %rax
+  pop %rdi
+  call sign
+  push %rax
+  pop %rcx
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  call printf
+  xor %rax, %rax
+  mov %rbp, %rsp
+  pop %rbp
+  ret
+.section .rodata
+.string.0:
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 10
+  .byte 0
@@ -0,0 +1,81 @@
+.globl sign
+.section .text.sorted.00002,"ax",@progbits
+.type sign, @function
+sign:
+  push %rdi
+  call sign.internal
+  add $8, %rsp
+  ret
+.section .text.sorted.00002,"ax",@progbits
+.align 16
+.type sign.internal, @function
+sign.internal:
+  mov 8(%rsp), %rax
+  test %rax, %rax
+  setl %al
+  movzb %al, %rax
+  test %rax, %rax
+  je .L.else.1
+  mov $1, %rax
+  neg %rax
+  jmp .L.return.sign.internal
+.L.else.1:
+  mov 8(%rsp), %rax
+  test %rax, %rax
+  setg %al
+  movzb %al, %rax
+  mov %rax, -16(%rsp)
+  mov $1, %rax
+  mov %rax, -24(%rsp)
+  xor %rax, %rax
+  mov -24(%rsp), %rdi
+  mov -16(%rsp), %rcx
+  cmp $0, %rcx
+  cmovne %rdi, %rax
+.L.return.sign.internal:
+  ret
+.globl main
+.section .text.sorted.00001,"ax",@progbits
+.align 16
+.type main, @function
+main:
+  sub $8, %rsp
+  sub $8, %rsp
+  lea .string.0(%rip), %rax
+  push %rax
+  mov $7, %rax
+  neg %rax
+  push %rax
+  call sign.internal
+  add $8, %rsp
+  push %rax
+  xor %rax, %rax
+  push %rax
+  call sign.internal
+  add $8, %rsp
+  push %rax
+  mov $7, %rax
+  push %rax
+  call sign.internal
+  add $8, %rsp
+  push %rax
+  pop %rcx
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  call printf
+  xor %rax, %rax
+  add $16, %rsp
+  ret
+.section .rodata
+.string.0:
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 10
+  .byte 0
@@ -0,0 +1,13 @@
+
+        main() {
+            auto i, s, p;
+
+            i = s = 0;
+            while (i < 10) {
+                s =+ i;
+                i++;
+            }
+            p = &s;
+            printf("%d*n", *p);
+        }
+    
\ No newline at end of file
@@ -0,0 +1,79 @@
+.globl main
+.section .text.sorted.00001,"ax",@progbits
+.align 16
+.type main, @function
+main:
+  sub $8, %rsp
+  sub $8, %rsp
+  sub $8, %rsp
+  sub $8, %rsp
+  sub $8, %rsp
+  sub $8, %rsp
+  xor %rax, %rax
+  mov %rax, 16(%rsp)
+  mov %rax, 24(%rsp)
+.align 16
+.L.unroll.1:
+  mov 24(%rsp), %rax
+  add $3, %rax
+  mov $10, %rdi
+  cmp %rdi, %rax
+  jge .L.start.1
+  mov 24(%rsp), %rax
+  add %rax, 16(%rsp)
+  lea 24(%rsp), %rax
+  mov (%rax), %rcx
+  addq $1, (%rax)
+  mov 24(%rsp), %rax
+  add %rax, 16(%rsp)
+  lea 24(%rsp), %rax
+  mov (%rax), %rcx
+  addq $1, (%rax)
+  mov 24(%rsp), %rax
+  add %rax, 16(%rsp)
+  lea 24(%rsp), %rax
+  mov (%rax), %rcx
+  addq $1, (%rax)
+  mov 24(%rsp), %rax
+  add %rax, 16(%rsp)
+  lea 24(%rsp), %rax
+  mov (%rax), %rcx
+  addq $1, (%rax)
+  mov %rcx, %rax
+  jmp .L.unroll.1
+.align 16
+.L.start.1:
+  mov 24(%rsp), %rax
+  cmp $10, %rax
+  setl %al
+  movzb %al, %rax
+  test %rax, %rax
+  je .L.end.1
+  mov 24(%rsp), %rax
+  add %rax, 16(%rsp)
+  lea 24(%rsp), %rax
+  mov (%rax), %rcx
+  addq $1, (%rax)
+  mov %rcx, %rax
+  jmp .L.start.1
+.L.end.1:
+  lea 16(%rsp), %rax
+  mov %rax, 8(%rsp)
+  lea .string.0(%rip), %rax
+  push %rax
+  mov 16(%rsp), %rax
+  mov (%rax), %rax
+  push %rax
+  pop %rsi
+  pop %rdi
+  call printf
+  add $32, %rsp
+  xor %rax, %rax
+  add $16, %rsp
+  ret
+.section .rodata
+.string.0:
+  .byte 37
+  .byte 100
+  .byte 10
+  .byte 0
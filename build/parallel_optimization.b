@@ -0,0 +1,22 @@
+
+        sum(n) {
+            auto s;
+
+            s = 0;
+            while (n > 0)
+                s =+ n--;
+            return (s);
+        }
+
+        mul(a, b) {
+            return (a * b);
+        }
+
+        clamp(x, lo, hi) {
+            return (x < lo ? lo : x > hi ? hi : x);
+        }
+
+        main() {
+            printf("%d %d %d*n", sum(100), mul(6, 7), clamp(15, 0, 10));
+        }
+    
\ No newline at end of file
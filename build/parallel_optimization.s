@@ -0,0 +1,134 @@
+.globl sum
+.section .text.sorted.00001,"ax",@progbits
+.type sum, @function
+sum:
+  push %rdi
+  call sum.internal
+  add $8, %rsp
+  ret
+.section .text.sorted.00001,"ax",@progbits
+.align 16
+.type sum.internal, @function
+sum.internal:
+  xor %rax, %rax
+  mov %rax, -16(%rsp)
+.align 16
+.L.start.1:
+  mov 8(%rsp), %rax
+  test %rax, %rax
+  setg %al
+  movzb %al, %rax
+  test %rax, %rax
+  je .L.end.1
+  lea 8(%rsp), %rax
+  mov (%rax), %rcx
+  subq $1, (%rax)
+  mov %rcx, %rax
+  add %rax, -16(%rsp)
+  mov -16(%rsp), %rax
+  jmp .L.start.1
+.L.end.1:
+  mov -16(%rsp), %rax
+  ret
+.globl mul
+.section .text.sorted.00003,"ax",@progbits
+.type mul, @function
+mul:
+  push %rdi
+  push %rsi
+  call mul.internal
+  add $16, %rsp
+  ret
+.section .text.sorted.00003,"ax",@progbits
+.align 16
+.type mul.internal, @function
+mul.internal:
+  mov 16(%rsp), %rax
+  imul 8(%rsp), %rax
+  ret
+.globl clamp
+.section .text.sorted.00004,"ax",@progbits
+.type clamp, @function
+clamp:
+  push %rdi
+  push %rsi
+  push %rdx
+  call clamp.internal
+  add $24, %rsp
+  ret
+.section .text.sorted.00004,"ax",@progbits
+.align 16
+.type clamp.internal, @function
+clamp.internal:
+  mov 24(%rsp), %rax
+  cmp 16(%rsp), %rax
+  setl %al
+  movzb %al, %rax
+  test %rax, %rax
+  je .L.cond.else.2
+  mov 16(%rsp), %rax
+  jmp .L.return.clamp.internal
+.L.cond.else.2:
+  mov 24(%rsp), %rax
+  cmp 8(%rsp), %rax
+  setg %al
+  movzb %al, %rax
+  mov %rax, -16(%rsp)
+  mov 8(%rsp), %rax
+  mov %rax, %rdi
+  mov 24(%rsp), %rax
+  mov -16(%rsp), %rcx
+  cmp $0, %rcx
+  cmovne %rdi, %rax
+.L.return.clamp.internal:
+  ret
+.globl main
+.section .text.sorted.00002,"ax",@progbits
+.align 16
+.type main, @function
+main:
+  sub $8, %rsp
+  sub $8, %rsp
+  lea .string.0(%rip), %rax
+  push %rax
+  mov $100, %rax
+  push %rax
+  call sum.internal
+  add $8, %rsp
+  push %rax
+  mov $6, %rax
+  push %rax
+  mov $7, %rax
+  push %rax
+  call mul.internal
+  add $16, %rsp
+  push %rax
+  mov $15, %rax
+  push %rax
+  xor %rax, %rax
+  push %rax
+  mov $10, %rax
+  push %rax
+  call clamp.internal
+  add $24, %rsp
+  push %rax
+  pop %rcx
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  call printf
+  xor %rax, %rax
+  add $16, %rsp
+  ret
+.section .rodata
+.string.0:
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 10
+  .byte 0
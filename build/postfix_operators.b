@@ -0,0 +1,49 @@
+
+        incr(x) {
+            printf("increment %d*n", x++);
+            return (x);
+        }
+
+        add(a, b) {
+            printf("add %d + %d*n", a, b);
+            return (a + b);
+        }
+
+        decr(x) {
+            printf("decrement %d*n", x--);
+            return (x);
+        }
+
+        sub(a, b) {
+            printf("subtract %d - %d*n", a, b);
+            return (a - b);
+        }
+
+        assign_local(x) {
+            auto result;
+            printf("assign local %d*n", x);
+            result = x;
+            return (result);
+        }
+
+        assign_global(x) {
+            extrn g;
+
+            printf("assign global %d*n", x);
+            g = x;
+        }
+
+        main() {
+            extrn g;
+
+            printf("%d*n", incr(42));
+            printf("%d*n", add(42, 123));
+            printf("%d*n", decr(42));
+            printf("%d*n", sub(42, 123));
+            printf("%d*n", assign_local(42));
+            assign_global(42);
+            printf("%d*n", g);
+        }
+
+        g;
+    
\ No newline at end of file
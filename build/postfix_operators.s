@@ -0,0 +1,371 @@
+.globl incr
+.section .text.sorted.00003,"ax",@progbits
+.type incr, @function
+incr:
+  push %rdi
+  call incr.internal
+  add $8, %rsp
+  ret
+.section .text.sorted.00003,"ax",@progbits
+.align 16
+.type incr.internal, @function
+incr.internal:
+  sub $8, %rsp
+  lea .string.0(%rip), %rax
+  push %rax
+  lea 24(%rsp), %rax
+  mov (%rax), %rcx
+  addq $1, (%rax)
+  mov %rcx, %rax
+  push %rax
+  pop %rsi
+  pop %rdi
+  call printf
+  mov 16(%rsp), %rax
+  add $8, %rsp
+  ret
+.globl add
+.section .text.sorted.00005,"ax",@progbits
+.type add, @function
+add:
+  push %rdi
+  push %rsi
+  call add.internal
+  add $16, %rsp
+  ret
+.section .text.sorted.00005,"ax",@progbits
+.align 16
+.type add.internal, @function
+add.internal:
+  sub $8, %rsp
+  lea .string.1(%rip), %rax
+  push %rax
+  mov 32(%rsp), %rax
+  push %rax
+  mov 32(%rsp), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  call printf
+  mov 24(%rsp), %rax
+  add 16(%rsp), %rax
+  add $8, %rsp
+  ret
+.globl decr
+.section .text.sorted.00006,"ax",@progbits
+.type decr, @function
+decr:
+  push %rdi
+  call decr.internal
+  add $8, %rsp
+  ret
+.section .text.sorted.00006,"ax",@progbits
+.align 16
+.type decr.internal, @function
+decr.internal:
+  sub $8, %rsp
+  lea .string.2(%rip), %rax
+  push %rax
+  lea 24(%rsp), %rax
+  mov (%rax), %rcx
+  subq $1, (%rax)
+  mov %rcx, %rax
+  push %rax
+  pop %rsi
+  pop %rdi
+  call printf
+  mov 16(%rsp), %rax
+  add $8, %rsp
+  ret
+.globl sub
+.section .text.sorted.00002,"ax",@progbits
+.type sub, @function
+sub:
+  push %rdi
+  push %rsi
+  call sub.internal
+  add $16, %rsp
+  ret
+.section .text.sorted.00002,"ax",@progbits
+.align 16
+.type sub.internal, @function
+sub.internal:
+  sub $8, %rsp
+  lea .string.3(%rip), %rax
+  push %rax
+  mov 32(%rsp), %rax
+  push %rax
+  mov 32(%rsp), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  call printf
+  mov 24(%rsp), %rax
+  sub 16(%rsp), %rax
+  add $8, %rsp
+  ret
+.globl assign_local
+.section .text.sorted.00001,"ax",@progbits
+.type assign_local, @function
+assign_local:
+  push %rdi
+  call assign_local.internal
+  add $8, %rsp
+  ret
+.section .text.sorted.00001,"ax",@progbits
+.align 16
+.type assign_local.internal, @function
+assign_local.internal:
+  sub $8, %rsp
+  sub $8, %rsp
+  lea .string.4(%rip), %rax
+  push %rax
+  mov 32(%rsp), %rax
+  push %rax
+  pop %rsi
+  pop %rdi
+  call printf
+  mov 24(%rsp), %rax
+  add $16, %rsp
+  ret
+.globl assign_global
+.section .text.sorted.00007,"ax",@progbits
+.type assign_global, @function
+assign_global:
+  push %rdi
+  call assign_global.internal
+  add $8, %rsp
+  ret
+.section .text.sorted.00007,"ax",@progbits
+.align 16
+.type assign_global.internal, @function
+assign_global.internal:
+  sub $8, %rsp
+  lea .string.5(%rip), %rax
+  push %rax
+  mov 24(%rsp), %rax
+  push %rax
+  pop %rsi
+  pop %rdi
+  call printf
+  lea g(%rip), %rax
+  mov %rax, %rdi
+  mov 16(%rsp), %rax
+  mov %rax, (%rdi)
+  xor %rax, %rax
+  add $8, %rsp
+  ret
+.globl main
+.section .text.sorted.00004,"ax",@progbits
+.align 16
+.type main, @function
+main:
+  sub $8, %rsp
+  sub $8, %rsp
+  lea .string.6(%rip), %rax
+  push %rax
+  mov $42, %rax
+  push %rax
+  call incr.internal
+  add $8, %rsp
+  push %rax
+  pop %rsi
+  pop %rdi
+  call printf
+  lea .string.7(%rip), %rax
+  push %rax
+  mov $42, %rax
+  push %rax
+  mov $123, %rax
+  push %rax
+  call add.internal
+  add $16, %rsp
+  push %rax
+  pop %rsi
+  pop %rdi
+  call printf
+  lea .string.8(%rip), %rax
+  push %rax
+  mov $42, %rax
+  push %rax
+  call decr.internal
+  add $8, %rsp
+  push %rax
+  pop %rsi
+  pop %rdi
+  call printf
+  lea .string.9(%rip), %rax
+  push %rax
+  mov $42, %rax
+  push %rax
+  mov $123, %rax
+  push %rax
+  call sub.internal
+  add $16, %rsp
+  push %rax
+  pop %rsi
+  pop %rdi
+  call printf
+  lea .string.10(%rip), %rax
+  push %rax
+  mov $42, %rax
+  push %rax
+  call assign_local.internal
+  add $8, %rsp
+  push %rax
+  pop %rsi
+  pop %rdi
+  call printf
+  mov $42, %rax
+  push %rax
+  call assign_global.internal
+  add $8, %rsp
+  lea .string.11(%rip), %rax
+  push %rax
+  mov g(%rip), %rax
+  push %rax
+  pop %rsi
+  pop %rdi
+  call printf
+  xor %rax, %rax
+  add $16, %rsp
+  ret
+.globl g
+.data
+.type g, @object
+.align 8
+g:
+  .zero 8
+.section .rodata
+.string.0:
+  .byte 105
+  .byte 110
+  .byte 99
+  .byte 114
+  .byte 101
+  .byte 109
+  .byte 101
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 10
+  .byte 0
+.string.1:
+  .byte 97
+  .byte 100
+  .byte 100
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 43
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 10
+  .byte 0
+.string.2:
+  .byte 100
+  .byte 101
+  .byte 99
+  .byte 114
+  .byte 101
+  .byte 109
+  .byte 101
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 10
+  .byte 0
+.string.3:
+  .byte 115
+  .byte 117
+  .byte 98
+  .byte 116
+  .byte 114
+  .byte 97
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 45
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 10
+  .byte 0
+.string.4:
+  .byte 97
+  .byte 115
+  .byte 115
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 32
+  .byte 108
+  .byte 111
+  .byte 99
+  .byte 97
+  .byte 108
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 10
+  .byte 0
+.string.5:
+  .byte 97
+  .byte 115
+  .byte 115
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 32
+  .byte 103
+  .byte 108
+  .byte 111
+  .byte 98
+  .byte 97
+  .byte 108
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 10
+  .byte 0
+.string.6:
+  .byte 37
+  .byte 100
+  .byte 10
+  .byte 0
+.string.7:
+  .byte 37
+  .byte 100
+  .byte 10
+  .byte 0
+.string.8:
+  .byte 37
+  .byte 100
+  .byte 10
+  .byte 0
+.string.9:
+  .byte 37
+  .byte 100
+  .byte 10
+  .byte 0
+.string.10:
+  .byte 37
+  .byte 100
+  .byte 10
+  .byte 0
+.string.11:
+  .byte 37
+  .byte 100
+  .byte 10
+  .byte 0
@@ -0,0 +1,5 @@
+
+        main() {
+            printf("12345 + 10 << 4 -> %d*n", 12345 + 10 << 4);
+        }
+    
\ No newline at end of file
@@ -0,0 +1,5 @@
+
+        main() {
+            printf("5 + 3 < 9 -> %d*n", 5 + 3 < 9);
+        }
+    
\ No newline at end of file
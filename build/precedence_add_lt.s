@@ -0,0 +1,40 @@
+.globl main
+.section .text.sorted.00001,"ax",@progbits
+.align 16
+.type main, @function
+main:
+  sub $8, %rsp
+  sub $8, %rsp
+  lea .string.0(%rip), %rax
+  push %rax
+  mov $5, %rax
+  add $3, %rax
+  cmp $9, %rax
+  setl %al
+  movzb %al, %rax
+  push %rax
+  pop %rsi
+  pop %rdi
+  call printf
+  xor %rax, %rax
+  add $16, %rsp
+  ret
+.section .rodata
+.string.0:
+  .byte 53
+  .byte 32
+  .byte 43
+  .byte 32
+  .byte 51
+  .byte 32
+  .byte 60
+  .byte 32
+  .byte 57
+  .byte 32
+  .byte 45
+  .byte 62
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 10
+  .byte 0
@@ -0,0 +1,5 @@
+
+        main() {
+            printf("3 + 4 ** 2 -> %d*n", 3 + 4 * 2);
+        }
+    
\ No newline at end of file
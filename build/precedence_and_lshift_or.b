@@ -0,0 +1,5 @@
+
+        main() {
+            printf("7 & 3 << 2 | 8 -> %d*n", 7 & 3 << 2 | 8);
+        }
+    
\ No newline at end of file
@@ -0,0 +1,51 @@
+.globl main
+.section .text.sorted.00001,"ax",@progbits
+.align 16
+.type main, @function
+main:
+  sub $8, %rsp
+  sub $8, %rsp
+  lea .string.0(%rip), %rax
+  push %rax
+  mov $7, %rax
+  push %rax
+  mov $3, %rax
+  push %rax
+  mov $2, %rax
+  mov %rax, %rcx
+  pop %rax
+  shl %cl, %rax
+  pop %rdi
+  and %rdi, %rax
+  or $8, %rax
+  push %rax
+  pop %rsi
+  pop %rdi
+  call printf
+  xor %rax, %rax
+  add $16, %rsp
+  ret
+.section .rodata
+.string.0:
+  .byte 55
+  .byte 32
+  .byte 38
+  .byte 32
+  .byte 51
+  .byte 32
+  .byte 60
+  .byte 60
+  .byte 32
+  .byte 50
+  .byte 32
+  .byte 124
+  .byte 32
+  .byte 56
+  .byte 32
+  .byte 45
+  .byte 62
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 10
+  .byte 0
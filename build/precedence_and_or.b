@@ -0,0 +1,5 @@
+
+        main() {
+            printf("2 & 3 | 4 -> %d*n", 2 & 3 | 4);
+        }
+    
\ No newline at end of file
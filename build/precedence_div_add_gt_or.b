@@ -0,0 +1,5 @@
+
+        main() {
+            printf("6 / 2 + 1 > 3 | 2 -> %d*n", 6 / 2 + 1 > 3 | 2);
+        }
+    
\ No newline at end of file
@@ -0,0 +1,5 @@
+
+        main() {
+            printf("10 / 2 %% 3 -> %d*n", 10 / 2 % 3);
+        }
+    
\ No newline at end of file
@@ -0,0 +1,51 @@
+.globl main
+.section .text.sorted.00001,"ax",@progbits
+.align 16
+.type main, @function
+main:
+  sub $8, %rsp
+  sub $8, %rsp
+  lea .string.0(%rip), %rax
+  push %rax
+  mov $16, %rax
+  push %rax
+  pop %rax
+  mov %rax, %rdx
+  sar $63, %rdx
+  shr $63, %rdx
+  add %rax, %rdx
+  sar $1, %rdx
+  mov %rdx, %rax
+  push %rax
+  mov $1, %rax
+  mov %rax, %rcx
+  pop %rax
+  sar %cl, %rax
+  push %rax
+  pop %rsi
+  pop %rdi
+  call printf
+  xor %rax, %rax
+  add $16, %rsp
+  ret
+.section .rodata
+.string.0:
+  .byte 49
+  .byte 54
+  .byte 32
+  .byte 47
+  .byte 32
+  .byte 50
+  .byte 32
+  .byte 62
+  .byte 62
+  .byte 32
+  .byte 49
+  .byte 32
+  .byte 45
+  .byte 62
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 10
+  .byte 0
@@ -0,0 +1,5 @@
+
+        main() {
+            printf("3 == 3 & 1 -> %d*n", 3 == 3 & 1);
+        }
+    
\ No newline at end of file
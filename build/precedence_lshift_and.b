@@ -0,0 +1,5 @@
+
+        main() {
+            printf("3 << 2 & 7 -> %d*n", 3 << 2 & 7);
+        }
+    
\ No newline at end of file
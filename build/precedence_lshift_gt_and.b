@@ -0,0 +1,5 @@
+
+        main() {
+            printf("1 << 3 > 5 & 2 -> %d*n", 1 << 3 > 5 & 2);
+        }
+    
\ No newline at end of file
@@ -0,0 +1,5 @@
+
+        main() {
+            printf("1 << 2 < 5 -> %d*n", 1 << 2 < 5);
+        }
+    
\ No newline at end of file
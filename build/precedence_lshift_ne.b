@@ -0,0 +1,5 @@
+
+        main() {
+            printf("1 << 4 != 15 -> %d*n", 1 << 4 != 15);
+        }
+    
\ No newline at end of file
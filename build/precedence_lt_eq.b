@@ -0,0 +1,5 @@
+
+        main() {
+            printf("4 < 6 == 1 -> %d*n", 4 < 6 == 1);
+        }
+    
\ No newline at end of file
@@ -0,0 +1,43 @@
+.globl main
+.section .text.sorted.00001,"ax",@progbits
+.align 16
+.type main, @function
+main:
+  sub $8, %rsp
+  sub $8, %rsp
+  lea .string.0(%rip), %rax
+  push %rax
+  mov $4, %rax
+  cmp $6, %rax
+  setl %al
+  movzb %al, %rax
+  cmp $1, %rax
+  sete %al
+  movzb %al, %rax
+  push %rax
+  pop %rsi
+  pop %rdi
+  call printf
+  xor %rax, %rax
+  add $16, %rsp
+  ret
+.section .rodata
+.string.0:
+  .byte 52
+  .byte 32
+  .byte 60
+  .byte 32
+  .byte 54
+  .byte 32
+  .byte 61
+  .byte 61
+  .byte 32
+  .byte 49
+  .byte 32
+  .byte 45
+  .byte 62
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 10
+  .byte 0
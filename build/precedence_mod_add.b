@@ -0,0 +1,5 @@
+
+        main() {
+            printf("7 %% 3 + 2 -> %d*n", 7 % 3 + 2);
+        }
+    
\ No newline at end of file
@@ -0,0 +1,49 @@
+.globl main
+.section .text.sorted.00001,"ax",@progbits
+.align 16
+.type main, @function
+main:
+  sub $8, %rsp
+  sub $8, %rsp
+  lea .string.0(%rip), %rax
+  push %rax
+  mov $7, %rax
+  push %rax
+  pop %rax
+  mov %rax, %rcx
+  movabs $6148914691236517206, %rdx
+  imul %rdx
+  mov %rcx, %rax
+  shr $63, %rax
+  add %rdx, %rax
+  imul $3, %rax
+  sub %rax, %rcx
+  mov %rcx, %rax
+  add $2, %rax
+  push %rax
+  pop %rsi
+  pop %rdi
+  call printf
+  xor %rax, %rax
+  add $16, %rsp
+  ret
+.section .rodata
+.string.0:
+  .byte 55
+  .byte 32
+  .byte 37
+  .byte 37
+  .byte 32
+  .byte 51
+  .byte 32
+  .byte 43
+  .byte 32
+  .byte 50
+  .byte 32
+  .byte 45
+  .byte 62
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 10
+  .byte 0
@@ -0,0 +1,5 @@
+
+        main() {
+            printf("15 %% 4 << 2 -> %d*n", 15 % 4 << 2);
+        }
+    
\ No newline at end of file
@@ -0,0 +1,52 @@
+.globl main
+.section .text.sorted.00001,"ax",@progbits
+.align 16
+.type main, @function
+main:
+  sub $8, %rsp
+  sub $8, %rsp
+  lea .string.0(%rip), %rax
+  push %rax
+  mov $15, %rax
+  push %rax
+  pop %rax
+  mov %rax, %rdx
+  sar $63, %rdx
+  shr $62, %rdx
+  add %rax, %rdx
+  and $-4, %rdx
+  sub %rdx, %rax
+  push %rax
+  mov $2, %rax
+  mov %rax, %rcx
+  pop %rax
+  shl %cl, %rax
+  push %rax
+  pop %rsi
+  pop %rdi
+  call printf
+  xor %rax, %rax
+  add $16, %rsp
+  ret
+.section .rodata
+.string.0:
+  .byte 49
+  .byte 53
+  .byte 32
+  .byte 37
+  .byte 37
+  .byte 32
+  .byte 52
+  .byte 32
+  .byte 60
+  .byte 60
+  .byte 32
+  .byte 50
+  .byte 32
+  .byte 45
+  .byte 62
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 10
+  .byte 0
@@ -0,0 +1,5 @@
+
+        main() {
+            printf("2 ** 3 + 4 < 11 -> %d*n", 2 * 3 + 4 < 11);
+        }
+    
\ No newline at end of file
@@ -0,0 +1,5 @@
+
+        main() {
+            printf("5 ** 2 + 3 ** 4 -> %d*n", 5 * 2 + 3 * 4);
+        }
+    
\ No newline at end of file
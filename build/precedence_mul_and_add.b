@@ -0,0 +1,5 @@
+
+        main() {
+            printf("4 ** 2 & 3 + 1 -> %d*n", 4 * 2 & 3 + 1);
+        }
+    
\ No newline at end of file
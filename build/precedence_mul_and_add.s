@@ -0,0 +1,46 @@
+.globl main
+.section .text.sorted.00001,"ax",@progbits
+.align 16
+.type main, @function
+main:
+  sub $8, %rsp
+  sub $8, %rsp
+  lea .string.0(%rip), %rax
+  push %rax
+  mov $4, %rax
+  shl $1, %rax
+  push %rax
+  mov $3, %rax
+  add $1, %rax
+  pop %rdi
+  and %rdi, %rax
+  push %rax
+  pop %rsi
+  pop %rdi
+  call printf
+  xor %rax, %rax
+  add $16, %rsp
+  ret
+.section .rodata
+.string.0:
+  .byte 52
+  .byte 32
+  .byte 42
+  .byte 32
+  .byte 50
+  .byte 32
+  .byte 38
+  .byte 32
+  .byte 51
+  .byte 32
+  .byte 43
+  .byte 32
+  .byte 49
+  .byte 32
+  .byte 45
+  .byte 62
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 10
+  .byte 0
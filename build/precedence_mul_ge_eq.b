@@ -0,0 +1,5 @@
+
+        main() {
+            printf("5 ** 2 >= 10 == 1 -> %d*n", 5 * 2 >= 10 == 1);
+        }
+    
\ No newline at end of file
@@ -0,0 +1,5 @@
+
+        main() {
+            printf("4 ** 3 << 2 -> %d*n", 4 * 3 << 2);
+        }
+    
\ No newline at end of file
@@ -0,0 +1,5 @@
+
+        main() {
+            printf("5 ** 2 << 1 + 3 -> %d*n", 5 * 2 << 1 + 3);
+        }
+    
\ No newline at end of file
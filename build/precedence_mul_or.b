@@ -0,0 +1,5 @@
+
+        main() {
+            printf("0 ** 5 | 3 -> %d*n", 0 * 5 | 3);
+        }
+    
\ No newline at end of file
@@ -0,0 +1,5 @@
+
+        main() {
+            printf("2 | 4 >> 1 -> %d*n", 2 | 4 >> 1);
+        }
+    
\ No newline at end of file
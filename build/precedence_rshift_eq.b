@@ -0,0 +1,5 @@
+
+        main() {
+            printf("8 >> 2 == 2 -> %d*n", 8 >> 2 == 2);
+        }
+    
\ No newline at end of file
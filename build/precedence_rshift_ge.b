@@ -0,0 +1,5 @@
+
+        main() {
+            printf("98765 >> 3 >= 12345 -> %d*n", 98765 >> 3 >= 12345);
+        }
+    
\ No newline at end of file
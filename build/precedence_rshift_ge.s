@@ -0,0 +1,54 @@
+.globl main
+.section .text.sorted.00001,"ax",@progbits
+.align 16
+.type main, @function
+main:
+  sub $8, %rsp
+  sub $8, %rsp
+  lea .string.0(%rip), %rax
+  push %rax
+  mov $98765, %rax
+  push %rax
+  mov $3, %rax
+  mov %rax, %rcx
+  pop %rax
+  sar %cl, %rax
+  cmp $12345, %rax
+  setge %al
+  movzb %al, %rax
+  push %rax
+  pop %rsi
+  pop %rdi
+  call printf
+  xor %rax, %rax
+  add $16, %rsp
+  ret
+.section .rodata
+.string.0:
+  .byte 57
+  .byte 56
+  .byte 55
+  .byte 54
+  .byte 53
+  .byte 32
+  .byte 62
+  .byte 62
+  .byte 32
+  .byte 51
+  .byte 32
+  .byte 62
+  .byte 61
+  .byte 32
+  .byte 49
+  .byte 50
+  .byte 51
+  .byte 52
+  .byte 53
+  .byte 32
+  .byte 45
+  .byte 62
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 10
+  .byte 0
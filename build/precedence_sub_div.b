@@ -0,0 +1,5 @@
+
+        main() {
+            printf("10 - 6 / 2 -> %d*n", 10 - 6 / 2);
+        }
+    
\ No newline at end of file
@@ -0,0 +1,5 @@
+
+        main() {
+            printf("16 - 8 >> 1 -> %d*n", 16 - 8 >> 1);
+        }
+    
\ No newline at end of file
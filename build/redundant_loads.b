@@ -0,0 +1,14 @@
+
+        n 7;
+        v[3] 1, 2, 3;
+
+        main() {
+            extrn n, v;
+            auto i, s;
+
+            s = n * n + n;
+            i = 1;
+            v[i] = v[i] + s;
+            printf("%d %d*n", s, v[i]);
+        }
+    
\ No newline at end of file
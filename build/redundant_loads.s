@@ -0,0 +1,68 @@
+.globl n
+.data
+.type n, @object
+.align 8
+n:
+  .quad 7
+.globl v
+.data
+.type v, @object
+.align 8
+v:
+  .quad .+8
+  .quad 1
+  .quad 2
+  .quad 3
+.globl main
+.section .text.sorted.00001,"ax",@progbits
+.align 16
+.type main, @function
+main:
+  sub $8, %rsp
+  sub $8, %rsp
+  sub $8, %rsp
+  sub $8, %rsp
+  mov n(%rip), %rax
+  push %rax
+  pop %rdi
+  imul %rdi, %rax
+  push %rax
+  mov %rdi, %rax
+  pop %rdi
+  add %rdi, %rax
+  mov %rax, 0(%rsp)
+  mov $1, %rax
+  mov %rax, 8(%rsp)
+  lea v+8(%rip), %rdi
+  lea (%rdi,%rax,8), %rax
+  push %rax
+  mov 16(%rsp), %rax
+  mov (%rdi,%rax,8), %rax
+  add 8(%rsp), %rax
+  pop %rdi
+  mov %rax, (%rdi)
+  lea .string.0(%rip), %rax
+  push %rax
+  mov 8(%rsp), %rax
+  push %rax
+  mov 24(%rsp), %rax
+  lea v+8(%rip), %rdi
+  mov (%rdi,%rax,8), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  call printf
+  add $16, %rsp
+  xor %rax, %rax
+  add $16, %rsp
+  ret
+.section .rodata
+.string.0:
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 10
+  .byte 0
@@ -0,0 +1,22 @@
+
+        printd(n, b) {
+            auto a;
+
+            if (n < 0) {
+                putchar('-');
+                n = -n;
+            }
+            if (a = n / b)
+                printd(a, b);
+            putchar(n % b + '0');
+        }
+
+        main() {
+            printd(1234, 10);
+            putchar(' ');
+            printd(-987, 10);
+            putchar(' ');
+            printd(255, 8);
+            putchar('*n');
+        }
+    
\ No newline at end of file
@@ -0,0 +1,163 @@
+.globl printd
+.section .text.sorted.00002,"ax",@progbits
+.type printd, @function
+printd:
+  push %rdi
+  push %rsi
+  call printd.internal
+  add $16, %rsp
+  ret
+.section .text.sorted.00002,"ax",@progbits
+.align 16
+.type printd.internal, @function
+printd.internal:
+  sub $8, %rsp
+  sub $8, %rsp
+  sub $8, %rsp
+  mov 40(%rsp), %rax
+  test %rax, %rax
+  setl %al
+  movzb %al, %rax
+  test %rax, %rax
+  je .L.else.2
+  mov $45, %rax
+  push %rax
+  pop %rdi
+  call putchar
+  mov 40(%rsp), %rax
+  neg %rax
+  mov %rax, 40(%rsp)
+.L.else.2:
+  mov 40(%rsp), %rax
+  push %rax
+  mov 40(%rsp), %rax
+  mov %rax, %rdi
+  pop %rax
+  cqo
+  idiv %rdi
+  test %rax, %rax
+  je .L.else.3
+  push %rax
+  mov %rdi, %rax
+  push %rax
+  call printd.internal
+  add $16, %rsp
+.L.else.3:
+  mov 40(%rsp), %rax
+  push %rax
+  mov 40(%rsp), %rax
+  mov %rax, %rdi
+  pop %rax
+  cqo
+  idiv %rdi
+  mov %rdx, %rax
+  add $48, %rax
+  push %rax
+  pop %rdi
+  call putchar
+  add $16, %rsp
+  xor %rax, %rax
+  add $8, %rsp
+  ret
+.section .text.sorted.00002,"ax",@progbits
+.align 16
+.type printd.spec.0, @function
+printd.spec.0:
+  sub $8, %rsp
+  sub $8, %rsp
+  sub $8, %rsp
+  mov 40(%rsp), %rax
+  test %rax, %rax
+  setl %al
+  movzb %al, %rax
+  test %rax, %rax
+  je .L.else.4
+  mov $45, %rax
+  push %rax
+  pop %rdi
+  call putchar
+  mov 40(%rsp), %rax
+  neg %rax
+  mov %rax, 40(%rsp)
+.L.else.4:
+  mov 40(%rsp), %rax
+  push %rax
+  pop %rax
+  mov %rax, %rcx
+  movabs $7378697629483820647, %rdx
+  imul %rdx
+  sar $2, %rdx
+  mov %rcx, %rax
+  shr $63, %rax
+  add %rdx, %rax
+  test %rax, %rax
+  je .L.else.5
+  push %rax
+  mov $10, %rax
+  push %rax
+  call printd.spec.0
+  add $16, %rsp
+.L.else.5:
+  mov 40(%rsp), %rax
+  push %rax
+  pop %rax
+  mov %rax, %rcx
+  movabs $7378697629483820647, %rdx
+  imul %rdx
+  sar $2, %rdx
+  mov %rcx, %rax
+  shr $63, %rax
+  add %rdx, %rax
+  imul $10, %rax
+  sub %rax, %rcx
+  mov %rcx, %rax
+  add $48, %rax
+  push %rax
+  pop %rdi
+  call putchar
+  add $16, %rsp
+  xor %rax, %rax
+  add $8, %rsp
+  ret
+.globl main
+.section .text.sorted.00001,"ax",@progbits
+.align 16
+.type main, @function
+main:
+  sub $8, %rsp
+  sub $8, %rsp
+  mov $1234, %rax
+  push %rax
+  mov $10, %rax
+  push %rax
+  call printd.spec.0
+  add $16, %rsp
+  mov $32, %rax
+  push %rax
+  pop %rdi
+  call putchar
+  mov $987, %rax
+  neg %rax
+  push %rax
+  mov $10, %rax
+  push %rax
+  call printd.spec.0
+  add $16, %rsp
+  mov $32, %rax
+  push %rax
+  pop %rdi
+  call putchar
+  mov $255, %rax
+  push %rax
+  mov $8, %rax
+  push %rax
+  call printd.internal
+  add $16, %rsp
+  mov $10, %rax
+  push %rax
+  pop %rdi
+  call putchar
+  xor %rax, %rax
+  add $16, %rsp
+  ret
+.section .rodata
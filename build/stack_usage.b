@@ -0,0 +1,24 @@
+
+        depth(n) {
+            if (n == 0)
+                return (0);
+            return (1 + depth(n - 1));
+        }
+
+        sum(a, b, c) {
+            auto v 2;
+
+            v[0] = a;
+            v[1] = b;
+            v[2] = c;
+            return (v[0] + v[1] + v[2]);
+        }
+
+        twice(x) {
+            return (sum(x, x, 0));
+        }
+
+        main() {
+            printf("%d %d*n", twice(21), depth(5));
+        }
+    
\ No newline at end of file
@@ -0,0 +1,155 @@
+.globl depth
+.section .text.sorted.00004,"ax",@progbits
+.type depth, @function
+depth:
+  push %rdi
+  call depth.internal
+  add $8, %rsp
+  ret
+.section .text.sorted.00004,"ax",@progbits
+.align 16
+.type depth.internal, @function
+depth.internal:
+  sub $8, %rsp
+  mov 16(%rsp), %rax
+  test %rax, %rax
+  sete %al
+  movzb %al, %rax
+  test %rax, %rax
+  je .L.else.1
+  xor %rax, %rax
+  jmp .L.return.depth.internal
+.L.else.1:
+  mov $1, %rax
+  push %rax
+  mov 24(%rsp), %rax
+  push %rax
+  mov $1, %rax
+  mov %rax, %rdi
+  pop %rax
+  sub %rdi, %rax
+  push %rax
+  call depth.internal
+  add $8, %rsp
+  pop %rdi
+  add %rdi, %rax
+.L.return.depth.internal:
+  add $8, %rsp
+  ret
+.globl sum
+.section .text.sorted.00001,"ax",@progbits
+.type sum, @function
+sum:
+  push %rdi
+  push %rsi
+  push %rdx
+  call sum.internal
+  add $24, %rsp
+  ret
+.section .text.sorted.00001,"ax",@progbits
+.align 16
+.type sum.internal, @function
+sum.internal:
+  lea -24(%rsp), %rax
+  mov %rax, -32(%rsp)
+  mov %rax, -40(%rsp)
+  xor %rax, %rax
+  mov -40(%rsp), %rdi
+  lea (%rdi,%rax,8), %rax
+  mov %rax, %rdi
+  mov 24(%rsp), %rax
+  mov %rax, (%rdi)
+  mov -32(%rsp), %r11
+  mov %r11, -40(%rsp)
+  mov $1, %rax
+  mov -40(%rsp), %rdi
+  lea (%rdi,%rax,8), %rax
+  mov %rax, %rdi
+  mov 16(%rsp), %rax
+  mov %rax, (%rdi)
+  mov -32(%rsp), %r11
+  mov %r11, -40(%rsp)
+  mov $2, %rax
+  mov -40(%rsp), %rdi
+  lea (%rdi,%rax,8), %rax
+  mov %rax, %rdi
+  mov 8(%rsp), %rax
+  mov %rax, (%rdi)
+  mov -32(%rsp), %r11
+  mov %r11, -40(%rsp)
+  xor %rax, %rax
+  mov -40(%rsp), %rdi
+  mov (%rdi,%rax,8), %rax
+  mov %rax, -40(%rsp)
+  mov %rdi, -48(%rsp)
+  mov $1, %rax
+  mov -48(%rsp), %rdi
+  mov (%rdi,%rax,8), %rax
+  mov -40(%rsp), %rdi
+  add %rdi, %rax
+  mov %rax, -40(%rsp)
+  mov -32(%rsp), %r11
+  mov %r11, -48(%rsp)
+  mov $2, %rax
+  mov -48(%rsp), %rdi
+  mov (%rdi,%rax,8), %rax
+  mov -40(%rsp), %rdi
+  add %rdi, %rax
+  ret
+.globl twice
+.section .text.sorted.00002,"ax",@progbits
+.type twice, @function
+twice:
+  push %rdi
+  call twice.internal
+  add $8, %rsp
+  ret
+.section .text.sorted.00002,"ax",@progbits
+.align 16
+.type twice.internal, @function
+twice.internal:
+  sub $8, %rsp
+  mov 16(%rsp), %rax
+  push %rax
+  push %rax
+  xor %rax, %rax
+  push %rax
+  call sum.internal
+  add $24, %rsp
+  add $8, %rsp
+  ret
+.globl main
+.section .text.sorted.00003,"ax",@progbits
+.align 16
+.type main, @function
+main:
+  sub $8, %rsp
+  sub $8, %rsp
+  lea .string.0(%rip), %rax
+  push %rax
+  mov $21, %rax
+  push %rax
+  call twice.internal
+  add $8, %rsp
+  push %rax
+  mov $5, %rax
+  push %rax
+  call depth.internal
+  add $8, %rsp
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  call printf
+  xor %rax, %rax
+  add $16, %rsp
+  ret
+.section .rodata
+.string.0:
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 10
+  .byte 0
@@ -0,0 +1,13 @@
+
+        sa "*t*0x";
+        sb "foo*ebar";
+        sc "bar";
+
+        main() {
+            extrn sa, sb;
+
+            printf("*(*)***"*n");
+            printf("%d %d %d*n", char(sa, 0), char(sa, 1), char(sa, 2));
+            printf("%d %d %d %d %d*n", char(sb, 0), char(sb, 1), char(sb, 2), char(sb, 3), char(sb, 4));
+        }
+    
\ No newline at end of file
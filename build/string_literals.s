@@ -0,0 +1,155 @@
+.globl sa
+.data
+.type sa, @object
+.align 8
+sa:
+  .quad .string.0
+.globl sb
+.data
+.type sb, @object
+.align 8
+sb:
+  .quad .string.1
+.globl main
+.section .text.sorted.00001,"ax",@progbits
+.align 16
+.type main, @function
+main:
+  sub $8, %rsp
+  sub $8, %rsp
+  lea .string.3(%rip), %rax
+  push %rax
+  pop %rdi
+  call printf
+  lea .string.4(%rip), %rax
+  push %rax
+  mov sa(%rip), %rax
+  push %rax
+  xor %rax, %rax
+  push %rax
+  pop %rsi
+  pop %rdi
+  call char
+  push %rax
+  mov sa(%rip), %rax
+  push %rax
+  mov $1, %rax
+  push %rax
+  pop %rsi
+  pop %rdi
+  call char
+  push %rax
+  mov sa(%rip), %rax
+  push %rax
+  mov $2, %rax
+  push %rax
+  pop %rsi
+  pop %rdi
+  call char
+  push %rax
+  pop %rcx
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  call printf
+  lea .string.5(%rip), %rax
+  push %rax
+  mov sb(%rip), %rax
+  push %rax
+  xor %rax, %rax
+  push %rax
+  pop %rsi
+  pop %rdi
+  call char
+  push %rax
+  mov sb(%rip), %rax
+  push %rax
+  mov $1, %rax
+  push %rax
+  pop %rsi
+  pop %rdi
+  call char
+  push %rax
+  mov sb(%rip), %rax
+  push %rax
+  mov $2, %rax
+  push %rax
+  pop %rsi
+  pop %rdi
+  call char
+  push %rax
+  mov sb(%rip), %rax
+  push %rax
+  mov $3, %rax
+  push %rax
+  pop %rsi
+  pop %rdi
+  call char
+  push %rax
+  mov sb(%rip), %rax
+  push %rax
+  mov $4, %rax
+  push %rax
+  pop %rsi
+  pop %rdi
+  call char
+  push %rax
+  pop %r9
+  pop %r8
+  pop %rcx
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  call printf
+  xor %rax, %rax
+  add $16, %rsp
+  ret
+.section .rodata
+.string.0:
+  .byte 9
+  .byte 0
+.string.1:
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 0
+.string.2:
+  .byte 98
+  .byte 97
+  .byte 114
+  .byte 0
+.string.3:
+  .byte 40
+  .byte 41
+  .byte 42
+  .byte 34
+  .byte 10
+  .byte 0
+.string.4:
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 10
+  .byte 0
+.string.5:
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 10
+  .byte 0
@@ -0,0 +1,29 @@
+
+        fib(n) {
+            if (n < 2)
+                return (n);
+            return (fib(n - 1) + fib(n - 2));
+        }
+
+        cold(n) {
+            return (n * 3);
+        }
+
+        sum(n) {
+            auto s;
+
+            s = 0;
+            while (n > 0)
+                s =+ cold(n--);
+            return (s);
+        }
+
+        main() {
+            auto i;
+
+            i = 0;
+            while (i < 20)
+                printf("%d ", fib(i++));
+            printf("*n%d %d %d*n", fib(22), sum(100), sum(1000));
+        }
+    
\ No newline at end of file
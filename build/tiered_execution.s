@@ -0,0 +1,177 @@
+.globl fib
+.section .text.sorted.00001,"ax",@progbits
+.type fib, @function
+fib:
+  push %rdi
+  call fib.internal
+  add $8, %rsp
+  ret
+.section .text.sorted.00001,"ax",@progbits
+.align 16
+.type fib.internal, @function
+fib.internal:
+  sub $8, %rsp
+  mov 16(%rsp), %rax
+  cmp $2, %rax
+  setl %al
+  movzb %al, %rax
+  test %rax, %rax
+  je .L.else.3
+  mov 16(%rsp), %rax
+  jmp .L.return.fib.internal
+.L.else.3:
+  mov 16(%rsp), %rax
+  push %rax
+  mov $1, %rax
+  mov %rax, %rdi
+  pop %rax
+  sub %rdi, %rax
+  push %rax
+  call fib.internal
+  add $8, %rsp
+  push %rax
+  mov 24(%rsp), %rax
+  push %rax
+  mov $2, %rax
+  mov %rax, %rdi
+  pop %rax
+  sub %rdi, %rax
+  push %rax
+  call fib.internal
+  add $8, %rsp
+  pop %rdi
+  add %rdi, %rax
+.L.return.fib.internal:
+  add $8, %rsp
+  ret
+.globl cold
+.section .text.sorted.00004,"ax",@progbits
+.type cold, @function
+cold:
+  push %rdi
+  call cold.internal
+  add $8, %rsp
+  ret
+.section .text.sorted.00004,"ax",@progbits
+.align 16
+.type cold.internal, @function
+cold.internal:
+  mov 8(%rsp), %rax
+  imul $3, %rax
+  ret
+.globl sum
+.section .text.sorted.00003,"ax",@progbits
+.type sum, @function
+sum:
+  push %rdi
+  call sum.internal
+  add $8, %rsp
+  ret
+.section .text.sorted.00003,"ax",@progbits
+.align 16
+.type sum.internal, @function
+sum.internal:
+  sub $8, %rsp
+  sub $8, %rsp
+  xor %rax, %rax
+  mov %rax, 0(%rsp)
+.align 16
+.L.start.4:
+  mov 24(%rsp), %rax
+  test %rax, %rax
+  setg %al
+  movzb %al, %rax
+  test %rax, %rax
+  je .L.end.4
+  lea 24(%rsp), %rax
+  mov (%rax), %rcx
+  subq $1, (%rax)
+  mov %rcx, %rax
+  push %rax
+  call cold.internal
+  add $8, %rsp
+  add %rax, 0(%rsp)
+  mov 0(%rsp), %rax
+  jmp .L.start.4
+.L.end.4:
+  mov 0(%rsp), %rax
+  add $16, %rsp
+  ret
+.globl main
+.section .text.sorted.00002,"ax",@progbits
+.align 16
+.type main, @function
+main:
+  sub $8, %rsp
+  sub $8, %rsp
+  sub $8, %rsp
+  sub $8, %rsp
+  xor %rax, %rax
+  mov %rax, 8(%rsp)
+.align 16
+.L.start.5:
+  mov 8(%rsp), %rax
+  cmp $20, %rax
+  setl %al
+  movzb %al, %rax
+  test %rax, %rax
+  je .L.end.5
+  lea .string.0(%rip), %rax
+  push %rax
+  lea 16(%rsp), %rax
+  mov (%rax), %rcx
+  addq $1, (%rax)
+  mov %rcx, %rax
+  push %rax
+  call fib.internal
+  add $8, %rsp
+  push %rax
+  pop %rsi
+  pop %rdi
+  call printf
+  jmp .L.start.5
+.L.end.5:
+  lea .string.1(%rip), %rax
+  push %rax
+  mov $22, %rax
+  push %rax
+  call fib.internal
+  add $8, %rsp
+  push %rax
+  mov $100, %rax
+  push %rax
+  call sum.internal
+  add $8, %rsp
+  push %rax
+  mov $1000, %rax
+  push %rax
+  call sum.internal
+  add $8, %rsp
+  push %rax
+  pop %rcx
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  call printf
+  add $16, %rsp
+  xor %rax, %rax
+  add $16, %rsp
+  ret
+.section .rodata
+.string.0:
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 0
+.string.1:
+  .byte 10
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 10
+  .byte 0
@@ -0,0 +1,22 @@
+
+        main() {
+            extrn x;
+            auto y;
+
+            printf("global -x = %d, expect %d*n", -x, -42);
+            x = 0;
+            printf("global !x = %d, expect %d*n", !x, 1);
+            y = 987;
+            x = &y;
+            printf("global **x = %d, expect %d*n", *x, y);
+
+            printf("local -y = %d, expect %d*n", -y, -987);
+            y = 0;
+            printf("local !y = %d, expect %d*n", !y, 1);
+            x = 42;
+            y = &x;
+            printf("local **y = %d, expect %d*n", *y, x);
+        }
+
+        x 42;
+    
\ No newline at end of file
@@ -0,0 +1,276 @@
+.globl main
+.section .text.sorted.00001,"ax",@progbits
+.align 16
+.type main, @function
+main:
+  sub $8, %rsp
+  sub $8, %rsp
+  sub $8, %rsp
+  sub $8, %rsp
+  lea .string.0(%rip), %rax
+  push %rax
+  mov x(%rip), %rax
+  neg %rax
+  push %rax
+  mov $42, %rax
+  neg %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  call printf
+  lea x(%rip), %rax
+  push %rax
+  xor %rax, %rax
+  pop %rdi
+  mov %rax, (%rdi)
+  lea .string.1(%rip), %rax
+  push %rax
+  mov x(%rip), %rax
+  test %rax, %rax
+  sete %al
+  movzx %al, %rax
+  push %rax
+  mov $1, %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  call printf
+  mov $987, %rax
+  mov %rax, 8(%rsp)
+  lea x(%rip), %rax
+  push %rax
+  lea 16(%rsp), %rax
+  pop %rdi
+  mov %rax, (%rdi)
+  lea .string.2(%rip), %rax
+  push %rax
+  mov x(%rip), %rax
+  mov (%rax), %rax
+  push %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  call printf
+  lea .string.3(%rip), %rax
+  push %rax
+  mov 16(%rsp), %rax
+  neg %rax
+  push %rax
+  mov $987, %rax
+  neg %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  call printf
+  xor %rax, %rax
+  mov %rax, 8(%rsp)
+  lea .string.4(%rip), %rax
+  push %rax
+  mov 16(%rsp), %rax
+  test %rax, %rax
+  sete %al
+  movzx %al, %rax
+  push %rax
+  mov $1, %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  call printf
+  lea x(%rip), %rax
+  push %rax
+  mov $42, %rax
+  pop %rdi
+  mov %rax, (%rdi)
+  lea x(%rip), %rax
+  mov %rax, 8(%rsp)
+  lea .string.5(%rip), %rax
+  push %rax
+  mov %rdi, %rax
+  mov (%rax), %rax
+  push %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  call printf
+  add $16, %rsp
+  xor %rax, %rax
+  add $16, %rsp
+  ret
+.globl x
+.data
+.type x, @object
+.align 8
+x:
+  .quad 42
+.section .rodata
+.string.0:
+  .byte 103
+  .byte 108
+  .byte 111
+  .byte 98
+  .byte 97
+  .byte 108
+  .byte 32
+  .byte 45
+  .byte 120
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 44
+  .byte 32
+  .byte 101
+  .byte 120
+  .byte 112
+  .byte 101
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 10
+  .byte 0
+.string.1:
+  .byte 103
+  .byte 108
+  .byte 111
+  .byte 98
+  .byte 97
+  .byte 108
+  .byte 32
+  .byte 33
+  .byte 120
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 44
+  .byte 32
+  .byte 101
+  .byte 120
+  .byte 112
+  .byte 101
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 10
+  .byte 0
+.string.2:
+  .byte 103
+  .byte 108
+  .byte 111
+  .byte 98
+  .byte 97
+  .byte 108
+  .byte 32
+  .byte 42
+  .byte 120
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 44
+  .byte 32
+  .byte 101
+  .byte 120
+  .byte 112
+  .byte 101
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 10
+  .byte 0
+.string.3:
+  .byte 108
+  .byte 111
+  .byte 99
+  .byte 97
+  .byte 108
+  .byte 32
+  .byte 45
+  .byte 121
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 44
+  .byte 32
+  .byte 101
+  .byte 120
+  .byte 112
+  .byte 101
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 10
+  .byte 0
+.string.4:
+  .byte 108
+  .byte 111
+  .byte 99
+  .byte 97
+  .byte 108
+  .byte 32
+  .byte 33
+  .byte 121
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 44
+  .byte 32
+  .byte 101
+  .byte 120
+  .byte 112
+  .byte 101
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 10
+  .byte 0
+.string.5:
+  .byte 108
+  .byte 111
+  .byte 99
+  .byte 97
+  .byte 108
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 44
+  .byte 32
+  .byte 101
+  .byte 120
+  .byte 112
+  .byte 101
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 10
+  .byte 0
@@ -0,0 +1,21 @@
+
+        main() {
+            auto i, n, s, t;
+
+            i = s = 0;
+            n = 8;
+            while (i < n) {
+                s =+ 1;
+                t = i;
+                while (i < t + 3) i++;
+            }
+            printf("%d %d*n", s, i);
+
+            i = s = 0;
+            while (i < n) {
+                s =+ i;
+                if (s > 100) s = 0; else i++;
+            }
+            printf("%d %d*n", s, i);
+        }
+    
\ No newline at end of file
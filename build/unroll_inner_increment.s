@@ -0,0 +1,116 @@
+.globl main
+.section .text.sorted.00001,"ax",@progbits
+.align 16
+.type main, @function
+main:
+  sub $8, %rsp
+  sub $8, %rsp
+  sub $8, %rsp
+  sub $8, %rsp
+  sub $8, %rsp
+  sub $8, %rsp
+  xor %rax, %rax
+  mov %rax, 8(%rsp)
+  mov %rax, 24(%rsp)
+  mov $8, %rax
+  mov %rax, 16(%rsp)
+.align 16
+.L.start.4:
+  mov 24(%rsp), %rax
+  cmp 16(%rsp), %rax
+  setl %al
+  movzb %al, %rax
+  test %rax, %rax
+  je .L.end.4
+  mov $1, %rax
+  add %rax, 8(%rsp)
+  mov 24(%rsp), %rax
+  mov %rax, 0(%rsp)
+.align 16
+.L.start.5:
+  mov 24(%rsp), %rax
+  push %rax
+  mov 8(%rsp), %rax
+  add $3, %rax
+  pop %rdi
+  cmp %rax, %rdi
+  setl %al
+  movzb %al, %rax
+  test %rax, %rax
+  je .L.start.4
+  lea 24(%rsp), %rax
+  mov (%rax), %rcx
+  addq $1, (%rax)
+  mov %rcx, %rax
+  jmp .L.start.5
+.L.end.4:
+  lea .string.0(%rip), %rax
+  push %rax
+  mov 16(%rsp), %rax
+  push %rax
+  mov 40(%rsp), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  call printf
+  xor %rax, %rax
+  mov %rax, 8(%rsp)
+  mov %rax, 24(%rsp)
+.align 16
+.L.start.6:
+  mov 24(%rsp), %rax
+  cmp 16(%rsp), %rax
+  setl %al
+  movzb %al, %rax
+  test %rax, %rax
+  je .L.end.6
+  mov 24(%rsp), %rax
+  add %rax, 8(%rsp)
+  mov 8(%rsp), %rax
+  cmp $100, %rax
+  setg %al
+  movzb %al, %rax
+  test %rax, %rax
+  je .L.else.7
+  xor %rax, %rax
+  mov %rax, 8(%rsp)
+  jmp .L.start.6
+.L.else.7:
+  lea 24(%rsp), %rax
+  mov (%rax), %rcx
+  addq $1, (%rax)
+  mov %rcx, %rax
+  jmp .L.start.6
+.L.end.6:
+  lea .string.1(%rip), %rax
+  push %rax
+  mov 16(%rsp), %rax
+  push %rax
+  mov 40(%rsp), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  call printf
+  add $32, %rsp
+  xor %rax, %rax
+  add $16, %rsp
+  ret
+.section .rodata
+.string.0:
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 10
+  .byte 0
+.string.1:
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 10
+  .byte 0
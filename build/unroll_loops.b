@@ -0,0 +1,21 @@
+
+        main() {
+            auto i, n, s, v[20];
+
+            i = s = 0;
+            n = 11;
+            while (i < n) {
+                v[i] = i * i;
+                s =+ v[i];
+                i++;
+            }
+            printf("%d %d*n", s, i);
+
+            i = 0;
+            while (i <= 010) {
+                s =- i;
+                i++;
+            }
+            printf("%d %d*n", s, i);
+        }
+    
\ No newline at end of file
@@ -0,0 +1,195 @@
+.globl main
+.section .text.sorted.00001,"ax",@progbits
+.align 16
+.type main, @function
+main:
+  sub $8, %rsp
+  sub $8, %rsp
+  sub $8, %rsp
+  sub $8, %rsp
+  sub $8, %rsp
+  sub $168, %rsp
+  lea 8(%rsp), %rax
+  mov %rax, 0(%rsp)
+  xor %rax, %rax
+  mov %rax, 168(%rsp)
+  mov %rax, 184(%rsp)
+  mov $11, %rax
+  mov %rax, 176(%rsp)
+.align 16
+.L.unroll.2:
+  mov 184(%rsp), %rax
+  add $2, %rax
+  mov 176(%rsp), %rdi
+  cmp %rdi, %rax
+  jge .L.start.2
+  mov 0(%rsp), %rdi
+  mov 184(%rsp), %rax
+  lea (%rdi,%rax,8), %rax
+  push %rax
+  mov 192(%rsp), %rax
+  push %rax
+  pop %rdi
+  imul %rdi, %rax
+  pop %rdi
+  mov %rax, (%rdi)
+  lea 168(%rsp), %rax
+  mov 0(%rsp), %rdi
+  mov 184(%rsp), %rax
+  mov (%rdi,%rax,8), %rax
+  add %rax, 168(%rsp)
+  lea 184(%rsp), %rax
+  mov (%rax), %rcx
+  addq $1, (%rax)
+  mov %rcx, %rax
+  mov 0(%rsp), %rdi
+  mov 184(%rsp), %rax
+  lea (%rdi,%rax,8), %rax
+  push %rax
+  mov 192(%rsp), %rax
+  push %rax
+  pop %rdi
+  imul %rdi, %rax
+  pop %rdi
+  mov %rax, (%rdi)
+  lea 168(%rsp), %rax
+  mov 0(%rsp), %rdi
+  mov 184(%rsp), %rax
+  mov (%rdi,%rax,8), %rax
+  add %rax, 168(%rsp)
+  lea 184(%rsp), %rax
+  mov (%rax), %rcx
+  addq $1, (%rax)
+  mov %rcx, %rax
+  mov 0(%rsp), %rdi
+  mov 184(%rsp), %rax
+  lea (%rdi,%rax,8), %rax
+  push %rax
+  mov 192(%rsp), %rax
+  push %rax
+  pop %rdi
+  imul %rdi, %rax
+  pop %rdi
+  mov %rax, (%rdi)
+  lea 168(%rsp), %rax
+  mov 0(%rsp), %rdi
+  mov 184(%rsp), %rax
+  mov (%rdi,%rax,8), %rax
+  add %rax, 168(%rsp)
+  lea 184(%rsp), %rax
+  mov (%rax), %rcx
+  addq $1, (%rax)
+  mov %rcx, %rax
+  jmp .L.unroll.2
+.align 16
+.L.start.2:
+  mov 184(%rsp), %rax
+  cmp 176(%rsp), %rax
+  setl %al
+  movzb %al, %rax
+  test %rax, %rax
+  je .L.end.2
+  mov 0(%rsp), %rdi
+  mov 184(%rsp), %rax
+  lea (%rdi,%rax,8), %rax
+  push %rax
+  mov 192(%rsp), %rax
+  push %rax
+  pop %rdi
+  imul %rdi, %rax
+  pop %rdi
+  mov %rax, (%rdi)
+  lea 168(%rsp), %rax
+  mov 0(%rsp), %rdi
+  mov 184(%rsp), %rax
+  mov (%rdi,%rax,8), %rax
+  add %rax, 168(%rsp)
+  lea 184(%rsp), %rax
+  mov (%rax), %rcx
+  addq $1, (%rax)
+  mov %rcx, %rax
+  jmp .L.start.2
+.L.end.2:
+  lea .string.0(%rip), %rax
+  push %rax
+  mov 176(%rsp), %rax
+  push %rax
+  mov 200(%rsp), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  call printf
+  xor %rax, %rax
+  mov %rax, 184(%rsp)
+.align 16
+.L.unroll.3:
+  mov 184(%rsp), %rax
+  add $2, %rax
+  mov $8, %rdi
+  cmp %rdi, %rax
+  jg .L.start.3
+  mov 184(%rsp), %rax
+  sub %rax, 168(%rsp)
+  lea 184(%rsp), %rax
+  mov (%rax), %rcx
+  addq $1, (%rax)
+  mov 184(%rsp), %rax
+  sub %rax, 168(%rsp)
+  lea 184(%rsp), %rax
+  mov (%rax), %rcx
+  addq $1, (%rax)
+  mov 184(%rsp), %rax
+  sub %rax, 168(%rsp)
+  lea 184(%rsp), %rax
+  mov (%rax), %rcx
+  addq $1, (%rax)
+  mov %rcx, %rax
+  jmp .L.unroll.3
+.align 16
+.L.start.3:
+  mov 184(%rsp), %rax
+  cmp $8, %rax
+  setle %al
+  movzb %al, %rax
+  test %rax, %rax
+  je .L.end.3
+  mov 184(%rsp), %rax
+  sub %rax, 168(%rsp)
+  lea 184(%rsp), %rax
+  mov (%rax), %rcx
+  addq $1, (%rax)
+  mov %rcx, %rax
+  jmp .L.start.3
+.L.end.3:
+  lea .string.1(%rip), %rax
+  push %rax
+  mov 176(%rsp), %rax
+  push %rax
+  mov 200(%rsp), %rax
+  push %rax
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  call printf
+  add $192, %rsp
+  xor %rax, %rax
+  add $16, %rsp
+  ret
+.section .rodata
+.string.0:
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 10
+  .byte 0
+.string.1:
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 10
+  .byte 0
@@ -0,0 +1,75 @@
+.globl n
+.data
+.type n, @object
+.align 4
+n:
+  .long 10
+.globl main
+.section .text.sorted.00001,"ax",@progbits
+.align 16
+.type main, @function
+main:
+  sub $8, %rsp
+  sub $4, %rsp
+  lea .string.0(%rip), %rax
+  push %rax
+  movslq n(%rip), %rax
+  push %rax
+  pop %rdi
+  call fib
+  movslq %eax, %rax
+  push %rax
+  pop %rsi
+  pop %rdi
+  call printf
+  movslq %eax, %rax
+  xor %rax, %rax
+  add $12, %rsp
+  ret
+.globl fib
+.section .text.sorted.00002,"ax",@progbits
+.align 16
+.type fib, @function
+fib:
+  mov %edi, -16(%rsp)
+  mov $1, %rax
+  mov %eax, -24(%rsp)
+  xor %rax, %rax
+  mov %eax, -32(%rsp)
+.align 16
+.L.start.1:
+  lea -32(%rsp), %rax
+  movslq (%rax), %rcx
+  addl $1, (%rax)
+  mov %rcx, %rax
+  mov %rax, -52(%rsp)
+  movslq -16(%rsp), %rax
+  mov -52(%rsp), %rdi
+  cmp %rax, %rdi
+  setl %al
+  movzb %al, %rax
+  test %rax, %rax
+  je .L.end.1
+  lea -28(%rsp), %rax
+  movslq -20(%rsp), %rax
+  mov %rax, -52(%rsp)
+  movslq -24(%rsp), %rax
+  mov -52(%rsp), %rdi
+  add %rdi, %rax
+  mov %eax, -28(%rsp)
+  lea -20(%rsp), %rax
+  movslq -24(%rsp), %rax
+  mov %eax, -20(%rsp)
+  lea -24(%rsp), %rax
+  movslq -28(%rsp), %rax
+  mov %eax, -24(%rsp)
+  jmp .L.start.1
+.L.end.1:
+  movslq -20(%rsp), %rax
+  ret
+.section .rodata
+.string.0:
+  .byte 37
+  .byte 100
+  .byte 10
+  .byte 0
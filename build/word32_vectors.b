@@ -0,0 +1,26 @@
+
+        main() {
+            extrn v, g;
+            auto a[10], i, p, x;
+
+            i = 0;
+            while (i < 10) {
+                a[i] = i * i;
+                i++;
+            }
+            printf("%d %d %d*n", a[3], a[9], v[1]);
+            printf("word size %d*n", &v[1] - &v[0]);
+
+            p = &x;
+            *p = -7;
+            x =* 3;
+            printf("%d %d %s %c*n", x, g, "str", 'abcd');
+            ++x;
+            x--;
+            --x;
+            printf("%d*n", x);
+        }
+
+        v[3] 5, 6, 7;
+        g -12;
+    
\ No newline at end of file
@@ -0,0 +1,202 @@
+.globl main
+.section .text.sorted.00001,"ax",@progbits
+.align 16
+.type main, @function
+main:
+  sub $8, %rsp
+  sub $4, %rsp
+  sub $44, %rsp
+  lea 4(%rsp), %rax
+  mov %eax, 0(%rsp)
+  sub $4, %rsp
+  sub $4, %rsp
+  sub $4, %rsp
+  sub $4, %rsp
+  sub $4, %rsp
+  xor %rax, %rax
+  mov %eax, 16(%rsp)
+.align 16
+.L.start.1:
+  movslq 16(%rsp), %rax
+  cmp $10, %rax
+  setl %al
+  movzb %al, %rax
+  test %rax, %rax
+  je .L.end.1
+  movslq 20(%rsp), %rax
+  push %rax
+  movslq 24(%rsp), %rax
+  pop %rdi
+  lea (%rdi,%rax,4), %rax
+  push %rax
+  movslq (%rax), %rax
+  movslq 24(%rsp), %rax
+  push %rax
+  pop %rdi
+  imul %rdi, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  lea 16(%rsp), %rax
+  movslq (%rax), %rcx
+  addl $1, (%rax)
+  mov %rcx, %rax
+  jmp .L.start.1
+.L.end.1:
+  lea .string.0(%rip), %rax
+  push %rax
+  movslq 28(%rsp), %rax
+  push %rax
+  mov $3, %rax
+  pop %rdi
+  movslq (%rdi,%rax,4), %rax
+  push %rax
+  mov %rdi, %rax
+  push %rax
+  mov $9, %rax
+  pop %rdi
+  movslq (%rdi,%rax,4), %rax
+  push %rax
+  mov $1, %rax
+  lea v+4(%rip), %rdi
+  movslq (%rdi,%rax,4), %rax
+  push %rax
+  pop %rcx
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  call printf
+  movslq %eax, %rax
+  lea .string.1(%rip), %rax
+  push %rax
+  mov $1, %rax
+  lea v+4(%rip), %rdi
+  lea (%rdi,%rax,4), %rax
+  push %rax
+  xor %rax, %rax
+  lea (%rdi,%rax,4), %rax
+  mov %rax, %rdi
+  pop %rax
+  sub %rdi, %rax
+  push %rax
+  pop %rsi
+  pop %rdi
+  call printf
+  movslq %eax, %rax
+  lea 8(%rsp), %rax
+  mov %eax, 12(%rsp)
+  movslq 12(%rsp), %rax
+  push %rax
+  mov $7, %rax
+  neg %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  lea 8(%rsp), %rax
+  push %rax
+  movslq (%rax), %rax
+  imul $3, %rax
+  pop %rdi
+  mov %eax, (%rdi)
+  lea .string.2(%rip), %rax
+  push %rax
+  movslq 16(%rsp), %rax
+  push %rax
+  movslq g(%rip), %rax
+  push %rax
+  lea .string.3(%rip), %rax
+  push %rax
+  mov $1684234849, %rax
+  push %rax
+  pop %r8
+  pop %rcx
+  pop %rdx
+  pop %rsi
+  pop %rdi
+  call printf
+  movslq %eax, %rax
+  lea 8(%rsp), %rax
+  movslq (%rax), %rdi
+  add $1, %rdi
+  mov %edi, (%rax)
+  movslq (%rax), %rcx
+  subl $1, (%rax)
+  movslq (%rax), %rdi
+  sub $1, %rdi
+  mov %edi, (%rax)
+  lea .string.4(%rip), %rax
+  push %rax
+  movslq 16(%rsp), %rax
+  push %rax
+  pop %rsi
+  pop %rdi
+  call printf
+  movslq %eax, %rax
+  add $64, %rsp
+  xor %rax, %rax
+  add $12, %rsp
+  ret
+.globl v
+.data
+.type v, @object
+.align 4
+v:
+  .long .+4
+  .long 5
+  .long 6
+  .long 7
+.globl g
+.data
+.type g, @object
+.align 4
+g:
+  .long -12
+.section .rodata
+.string.0:
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 10
+  .byte 0
+.string.1:
+  .byte 119
+  .byte 111
+  .byte 114
+  .byte 100
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 10
+  .byte 0
+.string.2:
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 37
+  .byte 100
+  .byte 32
+  .byte 37
+  .byte 115
+  .byte 32
+  .byte 37
+  .byte 99
+  .byte 10
+  .byte 0
+.string.3:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 0
+.string.4:
+  .byte 37
+  .byte 100
+  .byte 10
+  .byte 0
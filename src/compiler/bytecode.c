@@ -0,0 +1,976 @@
+#define _XOPEN_SOURCE 700
+#include <stdio.h>
+#undef _XOPEN_SOURCE
+
+#include "bytecode.h"
+#include "compiler.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <errno.h>
+
+#define MAX_OPERANDS 2
+
+static const char *register_names[BC_ZERO] = {
+    "rax", "rcx", "rdx", "rbx", "rsp", "rbp", "rsi", "rdi",
+    "r8", "r9", "r10", "r11", "r12", "r13", "r14", "r15",
+};
+
+/* low bytes of the registers, as used by setcc, movzb and shifts */
+static const char *byte_register_names[] = {
+    "al", "cl", "dl", "bl",
+};
+
+static const struct {
+    const char *suffix;
+    enum bc_condition cond;
+} condition_names[] = {
+    { "e",  BC_COND_E },  { "z",  BC_COND_E },
+    { "ne", BC_COND_NE }, { "nz", BC_COND_NE },
+    { "l",  BC_COND_L },  { "le", BC_COND_LE },
+    { "g",  BC_COND_G },  { "ge", BC_COND_GE },
+    { "b",  BC_COND_B },  { "c",  BC_COND_B },
+    { "be", BC_COND_BE }, { "a",  BC_COND_A },
+    { "ae", BC_COND_AE }, { "nc", BC_COND_AE },
+};
+
+//
+// Arithmetic instructions with all operand forms.
+//
+static const struct {
+    const char *mnemonic;
+    enum bc_opcode rr, ri, rm, mr, mi;
+} alu_forms[] = {
+    { "add", BC_ADD_RR, BC_ADD_RI, BC_ADD_RM, BC_ADD_MR, BC_ADD_MI },
+    { "sub", BC_SUB_RR, BC_SUB_RI, BC_SUB_RM, BC_SUB_MR, BC_SUB_MI },
+    { "and", BC_AND_RR, BC_AND_RI, BC_AND_RM, BC_AND_MR, BC_AND_MI },
+    { "or",  BC_OR_RR,  BC_OR_RI,  BC_OR_RM,  BC_OR_MR,  BC_OR_MI },
+    { "xor", BC_XOR_RR, BC_XOR_RI, BC_XOR_RM, BC_XOR_MR, BC_XOR_MI },
+    { "cmp", BC_CMP_RR, BC_CMP_RI, BC_CMP_RM, BC_CMP_MR, BC_CMP_MI },
+};
+
+static const struct {
+    const char *mnemonic;
+    enum bc_opcode ri, rc;
+} shift_forms[] = {
+    { "shl", BC_SHL_RI, BC_SHL_RC },
+    { "sal", BC_SHL_RI, BC_SHL_RC },
+    { "sar", BC_SAR_RI, BC_SAR_RC },
+    { "shr", BC_SHR_RI, BC_SHR_RC },
+    { "rol", BC_ROL_RI, BC_ROL_RC },
+};
+
+//
+// Instructions with a register source and destination of which
+// the source is the only operand.
+//
+static const struct {
+    const char *mnemonic;
+    enum bc_opcode op;
+} unary_forms[] = {
+    { "popcnt", BC_POPCNT },
+    { "lzcnt",  BC_LZCNT },
+    { "tzcnt",  BC_TZCNT },
+    { "bsr",    BC_BSR },
+    { "bsf",    BC_BSF },
+};
+
+enum operand_kind {
+    OPERAND_REG,        /* %rax */
+    OPERAND_BYTE_REG,   /* %al */
+    OPERAND_IMM,        /* $5 */
+    OPERAND_MEM,        /* -8(%rbp), name(%rip), (%rdi,%rax,8) */
+    OPERAND_SYM,        /* name, the target of a jump or call */
+    OPERAND_INDIRECT,   /* *%r10 */
+};
+
+struct operand {
+    enum operand_kind kind;
+    uint8_t reg;
+    uint8_t base, index, scale;
+    int64_t value;      /* immediate or displacement */
+    int32_t sym;
+};
+
+//
+// State of the assembler: the program being built, the current
+// section and a hash table of the symbols.
+//
+struct assembler {
+    struct compiler_args *args;
+    struct bc_program *prog;
+    enum bc_section section;
+    int32_t *table;
+    size_t table_size;
+    const char *line;
+};
+
+//
+// Hash a symbol name.
+//
+static size_t hash(const char *name, size_t len)
+{
+    size_t h = 2166136261u;
+
+    while (len--)
+        h = (h ^ (unsigned char) *name++) * 16777619u;
+    return h;
+}
+
+//
+// Double the hash table of symbols.
+//
+static void grow_table(struct assembler *as)
+{
+    size_t i, j, size = as->table_size ? as->table_size * 2 : 1024;
+    struct bc_symbol *sym;
+
+    free(as->table);
+    as->table = malloc(size * sizeof(int32_t));
+    as->table_size = size;
+    memset(as->table, -1, size * sizeof(int32_t));
+    for (i = 0; i < as->prog->symbols.size; i++) {
+        sym = as->prog->symbols.data[i];
+        j = hash(sym->name, strlen(sym->name)) & (size - 1);
+        while (as->table[j] >= 0)
+            j = (j + 1) & (size - 1);
+        as->table[j] = i;
+    }
+}
+
+//
+// Find a symbol by name, adding an undefined one when it is new.
+//
+static int32_t symbol(struct assembler *as, const char *name, size_t len)
+{
+    struct list *symbols = &as->prog->symbols;
+    struct bc_symbol *sym;
+    size_t i;
+
+    if (2 * (symbols->size + 1) > as->table_size)
+        grow_table(as);
+
+    i = hash(name, len) & (as->table_size - 1);
+    for (; as->table[i] >= 0; i = (i + 1) & (as->table_size - 1)) {
+        sym = symbols->data[as->table[i]];
+        if (strncmp(sym->name, name, len) == 0 && sym->name[len] == '\0')
+            return as->table[i];
+    }
+
+    sym = calloc(1, sizeof(struct bc_symbol));
+    sym->name = strndup(name, len);
+    sym->section = BC_UNDEF;
+    as->table[i] = symbols->size;
+    list_push(symbols, sym);
+    return symbols->size - 1;
+}
+
+static int error(struct assembler *as, const char *what)
+{
+    eprintf(as->args->arg0, "cannot translate to bytecode: %s " QUOTE_FMT("%s") "\n", what, as->line);
+    return 1;
+}
+
+//
+// Append bytes to the data image.
+//
+static void emit_data(struct bc_program *prog, const void *bytes, size_t len)
+{
+    if (prog->data_len + len > prog->data_alloc) {
+        prog->data_alloc = prog->data_alloc ? prog->data_alloc * 2 : 4096;
+        if (prog->data_alloc < prog->data_len + len)
+            prog->data_alloc = prog->data_len + len;
+        prog->data = realloc(prog->data, prog->data_alloc);
+    }
+    if (bytes)
+        memcpy(prog->data + prog->data_len, bytes, len);
+    else
+        memset(prog->data + prog->data_len, 0, len);
+    prog->data_len += len;
+}
+
+//
+// Append an instruction to the code.
+//
+static void emit_insn(struct bc_program *prog, const struct bc_insn *insn)
+{
+    if (prog->code_len == prog->code_alloc) {
+        prog->code_alloc = prog->code_alloc ? prog->code_alloc * 2 : 1024;
+        prog->code = realloc(prog->code, prog->code_alloc * sizeof(struct bc_insn));
+    }
+    prog->code[prog->code_len++] = *insn;
+}
+
+static size_t name_length(const char *s)
+{
+    size_t len = 0;
+
+    while (isalnum((unsigned char) s[len]) || s[len] == '_' || s[len] == '.')
+        len++;
+    return len;
+}
+
+//
+// Parse a register name after '%'.
+//
+static bool parse_register(const char **s, uint8_t *reg, bool *is_byte)
+{
+    size_t len = 0, i;
+
+    while (isalnum((unsigned char) (*s)[len]))
+        len++;
+    for (i = 0; i < BC_ZERO; i++) {
+        if (strlen(register_names[i]) == len && strncmp(*s, register_names[i], len) == 0) {
+            *reg = i;
+            *is_byte = false;
+            *s += len;
+            return true;
+        }
+    }
+    for (i = 0; i < sizeof(byte_register_names) / sizeof(byte_register_names[0]); i++) {
+        if (strlen(byte_register_names[i]) == len && strncmp(*s, byte_register_names[i], len) == 0) {
+            *reg = i;
+            *is_byte = true;
+            *s += len;
+            return true;
+        }
+    }
+    if (len == 3 && strncmp(*s, "rip", 3) == 0) {
+        *reg = BC_ZERO;
+        *is_byte = false;
+        *s += len;
+        return true;
+    }
+    return false;
+}
+
+//
+// Parse one operand of an instruction.
+//
+static bool parse_operand(struct assembler *as, const char *s, struct operand *op)
+{
+    bool is_byte;
+    char *end;
+    size_t len;
+
+    memset(op, 0, sizeof(struct operand));
+    op->base = op->index = BC_ZERO;
+    op->scale = 1;
+    op->sym = -1;
+
+    if (*s == '%') {
+        s++;
+        if (!parse_register(&s, &op->reg, &is_byte) || *s)
+            return false;
+        op->kind = is_byte ? OPERAND_BYTE_REG : OPERAND_REG;
+        return true;
+    }
+    if (*s == '*') {
+        if (*++s != '%' || (s++, !parse_register(&s, &op->reg, &is_byte)) || is_byte || *s)
+            return false;
+        op->kind = OPERAND_INDIRECT;
+        return true;
+    }
+    if (*s == '$') {
+        op->kind = OPERAND_IMM;
+        errno = 0;
+        op->value = strtoll(s + 1, &end, 0);
+        if (errno == ERANGE)
+            op->value = strtoull(s + 1, &end, 0);
+        return end != s + 1 && !*end;
+    }
+
+    /* memory operand, or a bare symbol */
+    if (*s == '-' || isdigit((unsigned char) *s)) {
+        op->value = strtoll(s, &end, 0);
+        s = end;
+    }
+    else if ((len = name_length(s)) > 0) {
+        op->sym = symbol(as, s, len);
+        s += len;
+        if (*s == '+' || *s == '-') {
+            op->value = strtoll(s, &end, 0);
+            s = end;
+        }
+        if (!*s) {
+            op->kind = OPERAND_SYM;
+            return true;
+        }
+    }
+    if (*s++ != '(')
+        return false;
+    op->kind = OPERAND_MEM;
+    if (*s == '%' && (s++, !parse_register(&s, &op->base, &is_byte) || is_byte))
+        return false;
+    if (*s == ',') {
+        if (*++s != '%' || (s++, !parse_register(&s, &op->index, &is_byte)) || is_byte)
+            return false;
+        if (*s == ',') {
+            op->scale = strtol(s + 1, &end, 10);
+            s = end;
+        }
+    }
+    return *s++ == ')' && !*s;
+}
+
+//
+// Find the condition named by the suffix of a mnemonic.
+//
+static int condition(const char *suffix)
+{
+    size_t i;
+
+    for (i = 0; i < sizeof(condition_names) / sizeof(condition_names[0]); i++) {
+        if (strcmp(suffix, condition_names[i].suffix) == 0)
+            return condition_names[i].cond;
+    }
+    return -1;
+}
+
+//
+// Put a memory operand into an instruction.
+//
+static void memory(struct bc_insn *insn, const struct operand *op)
+{
+    insn->base = op->base;
+    insn->index = op->index;
+    insn->scale = op->scale;
+    insn->disp = op->value;
+    insn->sym = op->sym;
+}
+
+//
+// Select the bytecode of one instruction from its mnemonic
+// and the kinds of its operands.
+//
+static int instruction(struct assembler *as, char *mnemonic, struct operand *ops, int n)
+{
+    struct bc_insn insn = { 0, 0, BC_ZERO, BC_ZERO, BC_ZERO, BC_ZERO, 1, 0, 0, -1 };
+    /* AT&T order: the source comes first, the destination last */
+    struct operand *src = &ops[0], *dst = &ops[n - 1];
+    size_t i, len = strlen(mnemonic);
+    int cond;
+
+    if (as->section != BC_TEXT)
+        return error(as, "instruction outside of text section");
+
+    /* size suffixes carry no information for 64-bit words */
+    if (len > 3 && mnemonic[len - 1] == 'q' && strcmp(mnemonic, "movslq") != 0 &&
+        strcmp(mnemonic, "cqo") != 0)
+        mnemonic[--len] = '\0';
+
+    /* hints to the cache are left out of bytecode; a store around it is a store */
+    if (strncmp(mnemonic, "prefetch", 8) == 0 || strcmp(mnemonic, "sfence") == 0)
+        return 0;
+    if (n == 2 && strcmp(mnemonic, "movnti") == 0 && src->kind == OPERAND_REG && dst->kind == OPERAND_MEM)
+        insn.op = BC_STORE, insn.src = src->reg, memory(&insn, dst);
+    else if (n == 2 && (strcmp(mnemonic, "mov") == 0 || strcmp(mnemonic, "movabs") == 0)) {
+        if (src->kind == OPERAND_REG && dst->kind == OPERAND_REG)
+            insn.op = BC_MOV_RR, insn.src = src->reg, insn.dst = dst->reg;
+        else if (src->kind == OPERAND_IMM && dst->kind == OPERAND_REG)
+            insn.op = BC_MOV_RI, insn.imm = src->value, insn.dst = dst->reg;
+        else if (src->kind == OPERAND_MEM && dst->kind == OPERAND_REG)
+            insn.op = BC_LOAD, memory(&insn, src), insn.dst = dst->reg;
+        else if (src->kind == OPERAND_REG && dst->kind == OPERAND_MEM)
+            insn.op = BC_STORE, insn.src = src->reg, memory(&insn, dst);
+        else if (src->kind == OPERAND_IMM && dst->kind == OPERAND_MEM)
+            insn.op = BC_STORE_I, insn.imm = src->value, memory(&insn, dst);
+        else
+            return error(as, "unsupported operands of");
+    }
+    else if (n == 2 && strcmp(mnemonic, "movslq") == 0 && src->kind == OPERAND_MEM && dst->kind == OPERAND_REG)
+        insn.op = BC_LOADS32, memory(&insn, src), insn.dst = dst->reg;
+    else if (n == 2 && strcmp(mnemonic, "lea") == 0 && src->kind == OPERAND_MEM && dst->kind == OPERAND_REG)
+        insn.op = BC_LEA, memory(&insn, src), insn.dst = dst->reg;
+    else if (n == 2 && strncmp(mnemonic, "movz", 4) == 0 && src->kind == OPERAND_BYTE_REG && dst->kind == OPERAND_REG)
+        insn.op = BC_MOVZB, insn.src = src->reg, insn.dst = dst->reg;
+    else if (n == 2 && strcmp(mnemonic, "imul") == 0 && dst->kind == OPERAND_REG) {
+        insn.dst = dst->reg;
+        if (src->kind == OPERAND_REG)
+            insn.op = BC_IMUL_RR, insn.src = src->reg;
+        else if (src->kind == OPERAND_IMM)
+            insn.op = BC_IMUL_RI, insn.imm = src->value;
+        else if (src->kind == OPERAND_MEM)
+            insn.op = BC_IMUL_RM, memory(&insn, src);
+        else
+            return error(as, "unsupported operands of");
+    }
+    else if (n == 2 && (strcmp(mnemonic, "test") == 0 || strcmp(mnemonic, "bt") == 0) &&
+             dst->kind == OPERAND_REG && (src->kind == OPERAND_REG || src->kind == OPERAND_IMM)) {
+        if (mnemonic[0] == 't')
+            insn.op = src->kind == OPERAND_REG ? BC_TEST_RR : BC_TEST_RI;
+        else
+            insn.op = src->kind == OPERAND_REG ? BC_BT_RR : BC_BT_RI;
+        insn.dst = dst->reg, insn.src = src->reg, insn.imm = src->value;
+    }
+    else if (n == 1 && mnemonic[0] == 'j' && strcmp(mnemonic, "jmp") != 0) {
+        if ((cond = condition(mnemonic + 1)) < 0 || src->kind != OPERAND_SYM)
+            return error(as, "unsupported instruction");
+        insn.op = BC_JCC, insn.cond = cond, insn.sym = src->sym;
+    }
+    else if (n == 1 && strncmp(mnemonic, "set", 3) == 0) {
+        if ((cond = condition(mnemonic + 3)) < 0 || src->kind != OPERAND_BYTE_REG)
+            return error(as, "unsupported instruction");
+        insn.op = BC_SETCC, insn.cond = cond, insn.dst = src->reg;
+    }
+    else if (n == 2 && strncmp(mnemonic, "cmov", 4) == 0) {
+        if ((cond = condition(mnemonic + 4)) < 0 || src->kind != OPERAND_REG || dst->kind != OPERAND_REG)
+            return error(as, "unsupported instruction");
+        insn.op = BC_CMOVCC, insn.cond = cond, insn.src = src->reg, insn.dst = dst->reg;
+    }
+    else if (n == 1 && strcmp(mnemonic, "jmp") == 0 && src->kind == OPERAND_SYM)
+        insn.op = BC_JMP, insn.sym = src->sym;
+    else if (n == 1 && strcmp(mnemonic, "call") == 0 && src->kind == OPERAND_SYM)
+        insn.op = BC_CALL, insn.sym = src->sym;
+    else if (n == 1 && strcmp(mnemonic, "call") == 0 && src->kind == OPERAND_INDIRECT)
+        insn.op = BC_CALL_R, insn.src = src->reg;
+    else if (n == 0 && strcmp(mnemonic, "ret") == 0)
+        insn.op = BC_RET;
+    else if (n == 0 && strcmp(mnemonic, "cqo") == 0)
+        insn.op = BC_CQO;
+    else if (n == 1 && strcmp(mnemonic, "push") == 0) {
+        if (src->kind == OPERAND_REG)
+            insn.op = BC_PUSH_R, insn.src = src->reg;
+        else if (src->kind == OPERAND_IMM)
+            insn.op = BC_PUSH_I, insn.imm = src->value;
+        else if (src->kind == OPERAND_MEM)
+            insn.op = BC_PUSH_M, memory(&insn, src);
+        else
+            return error(as, "unsupported operands of");
+    }
+    else if (n == 1 && src->kind == OPERAND_REG && strcmp(mnemonic, "pop") == 0)
+        insn.op = BC_POP_R, insn.dst = src->reg;
+    else if (n == 1 && src->kind == OPERAND_REG && strcmp(mnemonic, "neg") == 0)
+        insn.op = BC_NEG, insn.dst = src->reg;
+    else if (n == 1 && src->kind == OPERAND_REG && strcmp(mnemonic, "not") == 0)
+        insn.op = BC_NOT, insn.dst = src->reg;
+    else if (n == 1 && src->kind == OPERAND_REG && strcmp(mnemonic, "imul") == 0)
+        insn.op = BC_IMUL1, insn.src = src->reg;
+    else if (n == 1 && src->kind == OPERAND_REG && strcmp(mnemonic, "mul") == 0)
+        insn.op = BC_MUL1, insn.src = src->reg;
+    else if (n == 1 && src->kind == OPERAND_REG && strcmp(mnemonic, "idiv") == 0)
+        insn.op = BC_IDIV, insn.src = src->reg;
+    else if (n == 1 && src->kind == OPERAND_REG && strcmp(mnemonic, "bswap") == 0)
+        insn.op = BC_BSWAP, insn.dst = src->reg;
+    else if (n == 2) {
+        for (i = 0; i < sizeof(unary_forms) / sizeof(unary_forms[0]); i++) {
+            if (strcmp(mnemonic, unary_forms[i].mnemonic) != 0)
+                continue;
+            if (src->kind != OPERAND_REG || dst->kind != OPERAND_REG)
+                return error(as, "unsupported operands of");
+            insn.op = unary_forms[i].op, insn.src = src->reg, insn.dst = dst->reg;
+            emit_insn(as->prog, &insn);
+            return 0;
+        }
+        for (i = 0; i < sizeof(alu_forms) / sizeof(alu_forms[0]); i++) {
+            if (strcmp(mnemonic, alu_forms[i].mnemonic) != 0)
+                continue;
+            if (src->kind == OPERAND_REG && dst->kind == OPERAND_REG)
+                insn.op = alu_forms[i].rr, insn.src = src->reg, insn.dst = dst->reg;
+            else if (src->kind == OPERAND_IMM && dst->kind == OPERAND_REG)
+                insn.op = alu_forms[i].ri, insn.imm = src->value, insn.dst = dst->reg;
+            else if (src->kind == OPERAND_MEM && dst->kind == OPERAND_REG)
+                insn.op = alu_forms[i].rm, memory(&insn, src), insn.dst = dst->reg;
+            else if (src->kind == OPERAND_REG && dst->kind == OPERAND_MEM)
+                insn.op = alu_forms[i].mr, insn.src = src->reg, memory(&insn, dst);
+            else if (src->kind == OPERAND_IMM && dst->kind == OPERAND_MEM)
+                insn.op = alu_forms[i].mi, insn.imm = src->value, memory(&insn, dst);
+            else
+                return error(as, "unsupported operands of");
+            emit_insn(as->prog, &insn);
+            return 0;
+        }
+        for (i = 0; i < sizeof(shift_forms) / sizeof(shift_forms[0]); i++) {
+            if (strcmp(mnemonic, shift_forms[i].mnemonic) != 0 || dst->kind != OPERAND_REG)
+                continue;
+            if (src->kind == OPERAND_IMM)
+                insn.op = shift_forms[i].ri, insn.imm = src->value, insn.dst = dst->reg;
+            else if (src->kind == OPERAND_BYTE_REG && src->reg == BC_RCX)
+                insn.op = shift_forms[i].rc, insn.dst = dst->reg;
+            else
+                return error(as, "unsupported operands of");
+            emit_insn(as->prog, &insn);
+            return 0;
+        }
+        return error(as, "unsupported instruction");
+    }
+    else
+        return error(as, "unsupported instruction");
+
+    emit_insn(as->prog, &insn);
+    return 0;
+}
+
+//
+// Store a word of data: a number, a symbol with an optional
+// addend, or "." for the location itself.
+//
+static int data_word(struct assembler *as, const char *s)
+{
+    struct bc_program *prog = as->prog;
+    struct bc_reloc *reloc;
+    int64_t value = 0;
+    size_t len;
+    char *end;
+
+    if (*s == '-' || isdigit((unsigned char) *s)) {
+        value = strtoll(s, &end, 0);
+        if (*end)
+            return error(as, "invalid data");
+        emit_data(prog, &value, sizeof(value));
+        return 0;
+    }
+
+    reloc = calloc(1, sizeof(struct bc_reloc));
+    reloc->offset = prog->data_len;
+    if (s[0] == '.' && !isalnum((unsigned char) s[1]) && s[1] != '_' && s[1] != '.') {
+        reloc->sym = -1;
+        reloc->addend = prog->data_len;
+        s++;
+    }
+    else {
+        len = name_length(s);
+        reloc->sym = symbol(as, s, len);
+        s += len;
+    }
+    if (*s) {
+        reloc->addend += strtoll(s, &end, 0);
+        if (*end) {
+            free(reloc);
+            return error(as, "invalid data");
+        }
+    }
+    list_push(&prog->relocs, reloc);
+    emit_data(prog, NULL, sizeof(value));
+    return 0;
+}
+
+//
+// Handle an assembler directive.
+//
+static int directive(struct assembler *as, const char *s)
+{
+    struct bc_program *prog = as->prog;
+    unsigned long n;
+    unsigned char byte;
+    char *end;
+
+    if (strcmp(s, ".text") == 0 || strncmp(s, ".section .text", 14) == 0)
+        as->section = BC_TEXT;
+    else if (strcmp(s, ".data") == 0 || strncmp(s, ".section ", 9) == 0)
+        as->section = BC_DATA;
+    else if (strncmp(s, ".globl ", 7) == 0 || strncmp(s, ".type ", 6) == 0)
+        ;
+    else if (strncmp(s, ".align ", 7) == 0) {
+        n = strtoul(s + 7, &end, 10);
+        if (as->section == BC_DATA && n > 0 && prog->data_len % n)
+            emit_data(prog, NULL, n - prog->data_len % n);
+    }
+    else if (as->section != BC_DATA)
+        return error(as, "data outside of data section");
+    else if (strncmp(s, ".quad ", 6) == 0)
+        return data_word(as, s + 6);
+    else if (strncmp(s, ".byte ", 6) == 0) {
+        byte = strtoul(s + 6, &end, 0);
+        emit_data(prog, &byte, 1);
+    }
+    else if (strncmp(s, ".zero ", 6) == 0)
+        emit_data(prog, NULL, strtoul(s + 6, &end, 0));
+    else
+        return error(as, "unsupported directive");
+    return 0;
+}
+
+//
+// Define a label at the current location.
+//
+static int label(struct assembler *as, const char *name, size_t len)
+{
+    int32_t index = symbol(as, name, len);
+    struct bc_symbol *sym = as->prog->symbols.data[index];
+
+    if (sym->section != BC_UNDEF)
+        return error(as, "symbol redefined");
+    sym->section = as->section;
+    sym->value = as->section == BC_TEXT ? as->prog->code_len : as->prog->data_len;
+    return 0;
+}
+
+//
+// Translate one line of generated assembly code.
+//
+static int assemble_line(struct assembler *as, char *line)
+{
+    char mnemonic[16], *s, *start;
+    struct operand ops[MAX_OPERANDS];
+    size_t len;
+    int n = 0, depth;
+
+    as->line = line;
+    while (*line == ' ')
+        line++;
+    if (!*line)
+        return 0;
+    len = strlen(line);
+    if (line[len - 1] == ':' && name_length(line) == len - 1)
+        return label(as, line, len - 1);
+    if (*line == '.')
+        return directive(as, line);
+
+    for (len = 0; line[len] && line[len] != ' '; len++);
+    if (len >= sizeof(mnemonic))
+        return error(as, "unsupported instruction");
+    memcpy(mnemonic, line, len);
+    mnemonic[len] = '\0';
+
+    /* operands are separated by commas outside of parentheses */
+    for (s = line + len; *s == ' '; s++);
+    while (*s) {
+        if (n == MAX_OPERANDS)
+            return error(as, "too many operands in");
+        for (start = s, depth = 0; *s && (*s != ',' || depth); s++)
+            depth += (*s == '(') - (*s == ')');
+        if (*s)
+            *s++ = '\0';
+        while (*s == ' ')
+            s++;
+        if (!parse_operand(as, start, &ops[n++]))
+            return error(as, "invalid operand in");
+    }
+    return instruction(as, mnemonic, ops, n);
+}
+
+//
+// Translate the assembly code generated for a whole program
+// into bytecode.
+//
+int bytecode_assemble(struct compiler_args *args, const char *text, struct bc_program *prog)
+{
+    struct assembler as = { args, prog, BC_TEXT, NULL, 0, NULL };
+    const char *end;
+    char *line;
+    int status = 0;
+
+    memset(prog, 0, sizeof(struct bc_program));
+    while (*text && !status) {
+        if (!(end = strchr(text, '\n')))
+            end = text + strlen(text);
+        line = strndup(text, end - text);
+        status = assemble_line(&as, line);
+        free(line);
+        text = *end ? end + 1 : end;
+    }
+    free(as.table);
+    return status;
+}
+
+static void put_uleb(FILE *out, uint64_t value)
+{
+    do {
+        fputc((value & 0x7f) | (value > 0x7f ? 0x80 : 0), out);
+        value >>= 7;
+    } while (value);
+}
+
+static void put_sleb(FILE *out, int64_t value)
+{
+    bool more;
+
+    do {
+        more = !((value < 64 && value >= -64));
+        fputc((value & 0x7f) | (more ? 0x80 : 0), out);
+        value >>= 7;
+    } while (more);
+}
+
+//
+// Fields of an instruction present in the file: the rest keep
+// their default values.
+//
+enum {
+    FIELD_COND  = 1 << 0,
+    FIELD_DST   = 1 << 1,
+    FIELD_SRC   = 1 << 2,
+    FIELD_BASE  = 1 << 3,
+    FIELD_INDEX = 1 << 4, /* with the scale */
+    FIELD_IMM   = 1 << 5,
+    FIELD_DISP  = 1 << 6,
+    FIELD_SYM   = 1 << 7,
+};
+
+//
+// Write a program as a bytecode file: the magic, symbols, data image,
+// relocations and instructions. Numbers are LEB128 encoded, and each
+// instruction is its opcode, a mask of the fields present and the fields.
+//
+void bytecode_write(const struct bc_program *prog, FILE *out)
+{
+    const struct bc_symbol *sym;
+    const struct bc_reloc *reloc;
+    const struct bc_insn *insn;
+    unsigned mask;
+    size_t i;
+
+    fputs(BC_MAGIC, out);
+
+    put_uleb(out, prog->symbols.size);
+    for (i = 0; i < prog->symbols.size; i++) {
+        sym = prog->symbols.data[i];
+        put_uleb(out, strlen(sym->name));
+        fputs(sym->name, out);
+        fputc(sym->section, out);
+        put_uleb(out, sym->value);
+    }
+
+    put_uleb(out, prog->data_len);
+    fwrite(prog->data, 1, prog->data_len, out);
+
+    put_uleb(out, prog->relocs.size);
+    for (i = 0; i < prog->relocs.size; i++) {
+        reloc = prog->relocs.data[i];
+        put_uleb(out, reloc->offset);
+        put_sleb(out, reloc->sym);
+        put_sleb(out, reloc->addend);
+    }
+
+    put_uleb(out, prog->code_len);
+    for (i = 0; i < prog->code_len; i++) {
+        insn = &prog->code[i];
+        mask = (insn->cond ? FIELD_COND : 0) |
+               (insn->dst != BC_ZERO ? FIELD_DST : 0) |
+               (insn->src != BC_ZERO ? FIELD_SRC : 0) |
+               (insn->base != BC_ZERO ? FIELD_BASE : 0) |
+               (insn->index != BC_ZERO ? FIELD_INDEX : 0) |
+               (insn->imm ? FIELD_IMM : 0) |
+               (insn->disp ? FIELD_DISP : 0) |
+               (insn->sym >= 0 ? FIELD_SYM : 0);
+        fputc(insn->op, out);
+        fputc(mask, out);
+        if (mask & FIELD_COND)
+            fputc(insn->cond, out);
+        if (mask & FIELD_DST)
+            fputc(insn->dst, out);
+        if (mask & FIELD_SRC)
+            fputc(insn->src, out);
+        if (mask & FIELD_BASE)
+            fputc(insn->base, out);
+        if (mask & FIELD_INDEX) {
+            fputc(insn->index, out);
+            fputc(insn->scale, out);
+        }
+        if (mask & FIELD_IMM)
+            put_sleb(out, insn->imm);
+        if (mask & FIELD_DISP)
+            put_sleb(out, insn->disp);
+        if (mask & FIELD_SYM)
+            put_uleb(out, insn->sym);
+    }
+}
+
+//
+// Contents of a bytecode file being read.
+//
+struct reader {
+    const unsigned char *p, *end;
+    bool bad;
+};
+
+static unsigned get_byte(struct reader *r)
+{
+    if (r->p == r->end) {
+        r->bad = true;
+        return 0;
+    }
+    return *r->p++;
+}
+
+static uint64_t get_uleb(struct reader *r)
+{
+    uint64_t value = 0;
+    unsigned shift = 0, byte;
+
+    do {
+        byte = get_byte(r);
+        if (shift < 64)
+            value |= (uint64_t) (byte & 0x7f) << shift;
+        shift += 7;
+    } while ((byte & 0x80) && !r->bad);
+    return value;
+}
+
+static int64_t get_sleb(struct reader *r)
+{
+    uint64_t value = 0;
+    unsigned shift = 0, byte;
+
+    do {
+        byte = get_byte(r);
+        if (shift < 64)
+            value |= (uint64_t) (byte & 0x7f) << shift;
+        shift += 7;
+    } while ((byte & 0x80) && !r->bad);
+    if (shift < 64 && (byte & 0x40))
+        value |= ~(uint64_t) 0 << shift;
+    return (int64_t) value;
+}
+
+//
+// Read the next count items, checking they fit into the rest of the file.
+//
+static size_t get_count(struct reader *r)
+{
+    uint64_t count = get_uleb(r);
+
+    if (count > (uint64_t) (r->end - r->p)) {
+        r->bad = true;
+        return 0;
+    }
+    return count;
+}
+
+//
+// Decode the contents of a bytecode file.
+//
+static bool decode(struct reader *r, struct bc_program *prog)
+{
+    struct bc_symbol *sym;
+    struct bc_reloc *reloc;
+    struct bc_insn *insn;
+    size_t n, len, i;
+    unsigned mask;
+
+    r->p += strlen(BC_MAGIC);
+
+    n = get_count(r);
+    for (i = 0; i < n && !r->bad; i++) {
+        len = get_count(r);
+        sym = calloc(1, sizeof(struct bc_symbol));
+        sym->name = strndup((const char*) r->p, len);
+        r->p += len;
+        sym->section = get_byte(r);
+        sym->value = get_uleb(r);
+        list_push(&prog->symbols, sym);
+        if (sym->section > BC_UNDEF)
+            return false;
+    }
+
+    prog->data_len = prog->data_alloc = get_count(r);
+    prog->data = malloc(prog->data_len + 1);
+    memcpy(prog->data, r->p, prog->data_len);
+    r->p += prog->data_len;
+
+    n = get_count(r);
+    for (i = 0; i < n && !r->bad; i++) {
+        reloc = calloc(1, sizeof(struct bc_reloc));
+        list_push(&prog->relocs, reloc);
+        reloc->offset = get_uleb(r);
+        reloc->sym = get_sleb(r);
+        reloc->addend = get_sleb(r);
+        if (reloc->offset + 8 > prog->data_len || reloc->offset + 8 < reloc->offset ||
+            reloc->sym < -1 || reloc->sym >= (int64_t) prog->symbols.size)
+            return false;
+    }
+
+    prog->code_len = prog->code_alloc = get_count(r);
+    prog->code = calloc(prog->code_len + 1, sizeof(struct bc_insn));
+    for (i = 0; i < prog->code_len && !r->bad; i++) {
+        insn = &prog->code[i];
+        insn->op = get_byte(r);
+        mask = get_byte(r);
+        insn->cond = mask & FIELD_COND ? get_byte(r) : 0;
+        insn->dst = mask & FIELD_DST ? get_byte(r) : BC_ZERO;
+        insn->src = mask & FIELD_SRC ? get_byte(r) : BC_ZERO;
+        insn->base = mask & FIELD_BASE ? get_byte(r) : BC_ZERO;
+        insn->index = mask & FIELD_INDEX ? get_byte(r) : BC_ZERO;
+        insn->scale = mask & FIELD_INDEX ? get_byte(r) : 1;
+        insn->imm = mask & FIELD_IMM ? get_sleb(r) : 0;
+        insn->disp = mask & FIELD_DISP ? get_sleb(r) : 0;
+        insn->sym = mask & FIELD_SYM ? (int32_t) get_uleb(r) : -1;
+        if (insn->op >= BC_NUM_OPCODES || insn->cond >= BC_NUM_CONDITIONS ||
+            insn->dst >= BC_NUM_REGISTERS || insn->src >= BC_NUM_REGISTERS ||
+            insn->base >= BC_NUM_REGISTERS || insn->index >= BC_NUM_REGISTERS ||
+            insn->sym < -1 || insn->sym >= (int64_t) prog->symbols.size)
+            return false;
+    }
+
+    for (i = 0; i < prog->symbols.size; i++) {
+        sym = prog->symbols.data[i];
+        if (sym->value > (sym->section == BC_TEXT ? prog->code_len : prog->data_len))
+            return false;
+    }
+    return !r->bad && r->p == r->end;
+}
+
+//
+// Read a bytecode file.
+//
+int bytecode_read(struct compiler_args *args, const char *filename, struct bc_program *prog)
+{
+    FILE *in = fopen(filename, "rb");
+    struct reader r;
+    unsigned char *contents;
+    long size;
+    bool ok;
+
+    memset(prog, 0, sizeof(struct bc_program));
+    if (!in) {
+        eprintf(args->arg0, "cannot open file " QUOTE_FMT("%s") " %s.\n", filename, strerror(errno));
+        return 1;
+    }
+    fseek(in, 0, SEEK_END);
+    size = ftell(in);
+    rewind(in);
+    contents = malloc(size + 1);
+    ok = size >= 0 && fread(contents, 1, size, in) == (size_t) size;
+    fclose(in);
+
+    r.p = contents;
+    r.end = contents + (ok ? size : 0);
+    ok = ok && bytecode_file(filename) && decode(&r, prog);
+    free(contents);
+    if (!ok) {
+        eprintf(args->arg0, "invalid bytecode file " QUOTE_FMT("%s") "\n", filename);
+        bytecode_free(prog);
+        return 1;
+    }
+    return 0;
+}
+
+//
+// Check whether a file starts with the bytecode magic.
+//
+bool bytecode_file(const char *filename)
+{
+    char magic[sizeof(BC_MAGIC)] = "";
+    FILE *in = fopen(filename, "rb");
+
+    if (!in)
+        return false;
+    if (fread(magic, 1, strlen(BC_MAGIC), in) != strlen(BC_MAGIC))
+        magic[0] = '\0';
+    fclose(in);
+    return strncmp(magic, BC_MAGIC, strlen(BC_MAGIC)) == 0;
+}
+
+//
+// Deallocate a program.
+//
+void bytecode_free(struct bc_program *prog)
+{
+    struct bc_symbol *sym;
+    size_t i;
+
+    for (i = 0; i < prog->symbols.size; i++) {
+        sym = prog->symbols.data[i];
+        free(sym->name);
+        free(sym);
+    }
+    for (i = 0; i < prog->relocs.size; i++)
+        free(prog->relocs.data[i]);
+    list_free(&prog->symbols);
+    list_free(&prog->relocs);
+    free(prog->code);
+    free(prog->data);
+    memset(prog, 0, sizeof(struct bc_program));
+}
@@ -0,0 +1,155 @@
+#ifndef BCAUSE_BYTECODE_H
+#define BCAUSE_BYTECODE_H
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "list.h"
+
+struct compiler_args;
+
+#define BC_MAGIC "BCB2"
+
+//
+// Registers of the bytecode machine, numbered as in the x86-64
+// instruction encoding. BC_ZERO always reads as 0: it stands for
+// a missing base or index of a memory operand, and for %rip, since
+// addresses of symbols are absolute once a program is loaded.
+//
+enum bc_register {
+    BC_RAX, BC_RCX, BC_RDX, BC_RBX, BC_RSP, BC_RBP, BC_RSI, BC_RDI,
+    BC_R8, BC_R9, BC_R10, BC_R11, BC_R12, BC_R13, BC_R14, BC_R15,
+    BC_ZERO,
+    BC_NUM_REGISTERS,
+};
+
+//
+// Conditions of jumps, set and move instructions. Flags are kept
+// as the two operands of the last cmp, test or bt instruction,
+// and a condition compares them. Bsr and bsf keep their source
+// and 0, for the zero flag.
+//
+#define BC_CONDITIONS(X) \
+    X(E,  int64_t,  ==) \
+    X(NE, int64_t,  !=) \
+    X(L,  int64_t,  <)  \
+    X(LE, int64_t,  <=) \
+    X(G,  int64_t,  >)  \
+    X(GE, int64_t,  >=) \
+    X(B,  uint64_t, <)  \
+    X(BE, uint64_t, <=) \
+    X(A,  uint64_t, >)  \
+    X(AE, uint64_t, >=)
+
+#define BC_COND_ENUM(name, type, op) BC_COND_##name,
+enum bc_condition {
+    BC_CONDITIONS(BC_COND_ENUM)
+    BC_NUM_CONDITIONS,
+};
+#undef BC_COND_ENUM
+
+//
+// Operations. Suffixes give the operand forms: R register, I immediate,
+// M memory, C the shift count in %cl. The first letter is the destination,
+// as in "dst op= src"; the destination register is dst, the source
+// register is src and the memory operand is base + index * scale + disp.
+//
+#define BC_OPCODES(X) \
+    X(MOV_RR)   X(MOV_RI)   X(LOAD)     X(LOADS32)  X(STORE)    X(STORE_I)  \
+    X(LEA)      X(MOVZB)                                                    \
+    X(ADD_RR)   X(ADD_RI)   X(ADD_RM)   X(ADD_MR)   X(ADD_MI)               \
+    X(SUB_RR)   X(SUB_RI)   X(SUB_RM)   X(SUB_MR)   X(SUB_MI)               \
+    X(AND_RR)   X(AND_RI)   X(AND_RM)   X(AND_MR)   X(AND_MI)               \
+    X(OR_RR)    X(OR_RI)    X(OR_RM)    X(OR_MR)    X(OR_MI)                \
+    X(XOR_RR)   X(XOR_RI)   X(XOR_RM)   X(XOR_MR)   X(XOR_MI)               \
+    X(IMUL_RR)  X(IMUL_RI)  X(IMUL_RM)                                      \
+    X(CMP_RR)   X(CMP_RI)   X(CMP_RM)   X(CMP_MR)   X(CMP_MI)               \
+    X(TEST_RR)  X(TEST_RI)  X(BT_RR)    X(BT_RI)                            \
+    X(SHL_RI)   X(SHL_RC)   X(SAR_RI)   X(SAR_RC)   X(SHR_RI)   X(SHR_RC)   \
+    X(ROL_RI)   X(ROL_RC)                                                   \
+    X(NEG)      X(NOT)      X(IMUL1)    X(MUL1)     X(IDIV)     X(CQO)      \
+    X(POPCNT)   X(LZCNT)    X(TZCNT)    X(BSR)      X(BSF)      X(BSWAP)    \
+    X(PUSH_R)   X(PUSH_I)   X(PUSH_M)   X(POP_R)                            \
+    X(JMP)      X(CALL)     X(CALL_R)   X(RET)
+
+#define BC_OP_ENUM(name) BC_##name,
+enum bc_opcode {
+    BC_OPCODES(BC_OP_ENUM)
+    BC_SETCC,   /* low byte of dst = condition */
+    BC_CMOVCC,  /* dst = src if condition */
+    BC_JCC,     /* jump to sym if condition */
+    BC_NUM_OPCODES,
+};
+#undef BC_OP_ENUM
+
+//
+// One instruction. Jumps and calls name their target with sym;
+// a memory operand with a symbol adds its address to disp.
+//
+struct bc_insn {
+    uint8_t op;         /* enum bc_opcode */
+    uint8_t cond;       /* enum bc_condition of SETCC, CMOVCC and JCC */
+    uint8_t dst, src;   /* registers */
+    uint8_t base, index, scale; /* memory operand */
+    int64_t imm;        /* immediate operand */
+    int64_t disp;       /* displacement of the memory operand */
+    int32_t sym;        /* symbol index, or -1 */
+};
+
+enum bc_section {
+    BC_TEXT,    /* value is an instruction index */
+    BC_DATA,    /* value is an offset in the data image */
+    BC_UNDEF,   /* a function of the B library */
+};
+
+struct bc_symbol {
+    char *name;
+    enum bc_section section;
+    uint64_t value;
+};
+
+//
+// A word of the data image holding the address of a symbol
+// plus addend, or of the data image itself when sym is -1.
+//
+struct bc_reloc {
+    uint64_t offset;
+    int32_t sym;
+    int64_t addend;
+};
+
+//
+// A whole B program in bytecode form.
+//
+struct bc_program {
+    struct bc_insn *code;
+    size_t code_len, code_alloc;
+    unsigned char *data;
+    size_t data_len, data_alloc;
+    struct list symbols;    /* struct bc_symbol* */
+    struct list relocs;     /* struct bc_reloc* */
+};
+
+//
+// A function of the B library the interpreter can call. It gets the
+// six argument registers; unused ones are ignored.
+//
+typedef int64_t (*bc_native_fn)(int64_t, int64_t, int64_t, int64_t, int64_t, int64_t);
+
+struct bc_native {
+    const char *name;
+    bc_native_fn fn;
+};
+
+extern const struct bc_native bc_natives[];
+extern const size_t bc_num_natives;
+
+int bytecode_assemble(struct compiler_args *args, const char *text, struct bc_program *prog);
+void bytecode_write(const struct bc_program *prog, FILE *out);
+int bytecode_read(struct compiler_args *args, const char *filename, struct bc_program *prog);
+bool bytecode_file(const char *filename);
+void bytecode_free(struct bc_program *prog);
+
+int interpret(struct compiler_args *args, const struct bc_program *prog);
+
+#endif /* BCAUSE_BYTECODE_H */
@@ -0,0 +1,265 @@
+//
+// Cache of the code generated for function definitions. A definition
+// is keyed by its tokens, the options and, with the whole program at
+// hand, the facts about the globals it references; an unchanged one
+// takes its code from the cache instead of being compiled again.
+//
+#define _XOPEN_SOURCE 700
+#include <stdio.h>
+#undef _XOPEN_SOURCE
+
+#include "cache.h"
+#include "compiler.h"
+
+#include <ctype.h>
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/* version of the entries, part of every key: bump it with any change
+   to the compiler that alters the code or the facts generated for the
+   same input, so that entries of older compilers never match */
+#define CACHE_VERSION "bcause-cache-4"
+
+//
+// Labels numbered by the counters of struct cache_base.
+//
+static const struct {
+    const char *prefix;
+    size_t offset;
+} numbered_labels[] = {
+    { ".L.cond.else.", offsetof(struct cache_base, conds) },
+    { ".L.cond.end.",  offsetof(struct cache_base, conds) },
+    { ".L.else.",      offsetof(struct cache_base, stmts) },
+    { ".L.end.",       offsetof(struct cache_base, stmts) },
+    { ".L.start.",     offsetof(struct cache_base, stmts) },
+    { ".L.cmp.",       offsetof(struct cache_base, stmts) },
+    { ".L.stmts.",     offsetof(struct cache_base, stmts) },
+    { ".L.case.",      offsetof(struct cache_base, stmts) },
+    { ".L.unroll.",    offsetof(struct cache_base, stmts) },
+    { ".L.cold.",      offsetof(struct cache_base, stmts) },
+    { ".string.",      offsetof(struct cache_base, strings) },
+};
+
+//
+// Add bytes to a key (64-bit FNV-1a).
+//
+void cache_hash(uint64_t *key, const void *data, size_t size)
+{
+    const unsigned char *p = data;
+
+    while (size--)
+        *key = (*key ^ *p++) * 0x100000001b3ull;
+}
+
+void cache_hash_string(uint64_t *key, const char *str)
+{
+    cache_hash(key, str, strlen(str) + 1);
+}
+
+void cache_hash_number(uint64_t *key, uint64_t number)
+{
+    cache_hash(key, &number, sizeof(number));
+}
+
+//
+// Add the options changing the generated code to a key.
+//
+void cache_hash_options(uint64_t *key, const struct compiler_args *args)
+{
+    cache_hash_string(key, CACHE_VERSION);
+    cache_hash_number(key, args->word_size);
+    cache_hash_number(key, args->popcnt);
+    cache_hash_number(key, args->lzcnt);
+    cache_hash_number(key, args->bmi);
+    cache_hash_number(key, args->opt_level);
+    cache_hash_number(key, args->omit_frame_pointer);
+    cache_hash_number(key, args->unroll_loops);
+    cache_hash_number(key, args->unroll_factor);
+    cache_hash_number(key, args->max_unrolled_insns);
+    cache_hash_number(key, args->specialize);
+    cache_hash_number(key, args->max_specializations);
+    cache_hash_number(key, args->specialize_min_calls);
+    cache_hash_number(key, args->max_specialize_insns);
+    cache_hash_number(key, args->internal_calls);
+    cache_hash_number(key, args->reorder_functions);
+    cache_hash_number(key, args->align_functions);
+    cache_hash_number(key, args->align_loops);
+    cache_hash_number(key, args->whole_program);
+    cache_hash_number(key, args->analyzing);
+}
+
+//
+// Check whether the cache is in use. The passes report remarks and
+// dumps while they run, so these need every function compiled.
+//
+bool cache_enabled(const struct compiler_args *args)
+{
+    return args->cache_dir && !reports_requested(args);
+}
+
+static void skip_comment(FILE *in)
+{
+    int c, prev = 0;
+
+    while ((c = fgetc(in)) != EOF && !(prev == '*' && c == '/'))
+        prev = c;
+}
+
+//
+// Find the end of a function definition starting after its '(' and add
+// its tokens to a key: the text without comments, with white space
+// reduced to one blank. Only bodies in braces are found; the file
+// position is left at the start.
+//
+bool cache_scan_function(FILE *in, long pos, long *end, uint64_t *key)
+{
+    int c, quote = 0, depth = 0;
+    bool space = false, params = true, found = false;
+    unsigned char blank = ' ';
+
+    if (fseek(in, pos, SEEK_SET) != 0)
+        return false;
+    while (!found && (c = fgetc(in)) != EOF) {
+        unsigned char byte = c;
+
+        if (quote) {
+            cache_hash(key, &byte, 1);
+            if (c == '*' && (c = fgetc(in)) != EOF) {
+                byte = c;
+                cache_hash(key, &byte, 1);
+            }
+            else if (c == quote)
+                quote = 0;
+            continue;
+        }
+        if (c == '/') {
+            if ((c = fgetc(in)) == '*') {
+                skip_comment(in);
+                space = true;
+                continue;
+            }
+            ungetc(c, in);
+            c = '/';
+        }
+        if (isspace(c)) {
+            space = true;
+            continue;
+        }
+        if (space)
+            cache_hash(key, &blank, 1);
+        space = false;
+        cache_hash(key, &byte, 1);
+
+        if (params) {
+            /* after the parameters, the body has to be a block */
+            if (c == ')')
+                params = false;
+            else if (!isalnum(c) && c != '_' && c != ',')
+                break;
+        }
+        else if (depth == 0 && c != '{')
+            break;
+        else if (c == '"' || c == '\'')
+            quote = c;
+        else if (c == '{')
+            depth++;
+        else if (c == '}' && --depth == 0) {
+            *end = ftell(in);
+            found = true;
+        }
+    }
+    fseek(in, pos, SEEK_SET);
+    return found;
+}
+
+//
+// Shift the numbered labels and strings of cached code by the
+// counters in base: add them, or subtract them to store the code.
+//
+char *cache_relabel(const char *text, const struct cache_base *base, bool add)
+{
+    char *result, *end;
+    size_t result_len, i, len;
+    unsigned long number, offset;
+    FILE *out = open_memstream(&result, &result_len);
+
+    while (*text) {
+        if (*text != '.') {
+            fputc(*text++, out);
+            continue;
+        }
+        for (i = 0; i < sizeof(numbered_labels) / sizeof(numbered_labels[0]); i++) {
+            len = strlen(numbered_labels[i].prefix);
+            if (strncmp(text, numbered_labels[i].prefix, len) == 0 && isdigit((unsigned char) text[len]))
+                break;
+        }
+        if (i == sizeof(numbered_labels) / sizeof(numbered_labels[0])) {
+            fputc(*text++, out);
+            continue;
+        }
+        number = strtoul(text + len, &end, 10);
+        offset = *(const unsigned long*) ((const char*) base + numbered_labels[i].offset);
+        fprintf(out, "%s%lu", numbered_labels[i].prefix, add ? number + offset : number - offset);
+        text = end;
+    }
+    fclose(out);
+    return result;
+}
+
+static void entry_path(const struct compiler_args *args, uint64_t key, char *path, size_t size)
+{
+    snprintf(path, size, "%s/%016llx", args->cache_dir, (unsigned long long) key);
+}
+
+//
+// Read the entry of a key, or return NULL when there is none.
+//
+char *cache_read(const struct compiler_args *args, uint64_t key, size_t *size)
+{
+    char path[BUFSIZ], *data;
+    long len;
+    FILE *in;
+
+    entry_path(args, key, path, sizeof(path));
+    if (!(in = fopen(path, "rb")))
+        return NULL;
+    if (fseek(in, 0, SEEK_END) != 0 || (len = ftell(in)) < 0 || fseek(in, 0, SEEK_SET) != 0) {
+        fclose(in);
+        return NULL;
+    }
+    data = malloc(len + 1);
+    if (fread(data, 1, len, in) != (size_t) len) {
+        free(data);
+        fclose(in);
+        return NULL;
+    }
+    fclose(in);
+    data[len] = '\0';
+    *size = len;
+    return data;
+}
+
+//
+// Store the entry of a key. The entry is written aside and renamed,
+// so that compilers sharing the cache never see half of it. Failures
+// only leave the entry out.
+//
+void cache_write(const struct compiler_args *args, uint64_t key, const char *data, size_t size)
+{
+    char path[BUFSIZ], temp[BUFSIZ + 32];
+    FILE *out;
+    bool ok;
+
+    if (mkdir(args->cache_dir, 0777) != 0 && errno != EEXIST)
+        return;
+    entry_path(args, key, path, sizeof(path));
+    snprintf(temp, sizeof(temp), "%s.%ld", path, (long) getpid());
+    if (!(out = fopen(temp, "wb")))
+        return;
+    ok = fwrite(data, 1, size, out) == size;
+    if (fclose(out) != 0 || !ok || rename(temp, path) != 0)
+        remove(temp);
+}
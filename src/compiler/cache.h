@@ -0,0 +1,37 @@
+#ifndef BCAUSE_CACHE_H
+#define BCAUSE_CACHE_H
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "list.h"
+
+/* initial value of a key */
+#define CACHE_KEY_INIT 0xcbf29ce484222325ull
+
+struct compiler_args;
+
+//
+// Numbers of the labels and strings a definition takes, so that its
+// cached code can be moved to where the same counters stand later.
+//
+struct cache_base {
+    unsigned long stmts;
+    unsigned long conds;
+    unsigned long strings;
+    unsigned long builtins; /* builtins compiled as such, a bit each */
+};
+
+void cache_hash(uint64_t *key, const void *data, size_t size);
+void cache_hash_string(uint64_t *key, const char *str);
+void cache_hash_number(uint64_t *key, uint64_t number);
+void cache_hash_options(uint64_t *key, const struct compiler_args *args);
+
+bool cache_enabled(const struct compiler_args *args);
+bool cache_scan_function(FILE *in, long pos, long *end, uint64_t *key);
+char *cache_relabel(const char *text, const struct cache_base *base, bool add);
+
+char *cache_read(const struct compiler_args *args, uint64_t key, size_t *size);
+void cache_write(const struct compiler_args *args, uint64_t key, const char *data, size_t size);
+
+#endif /* BCAUSE_CACHE_H */
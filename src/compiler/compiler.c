@@ -1,10 +1,14 @@
-#include "compiler.h"
-#include "list.h"
-
 #define _XOPEN_SOURCE 700
 #include <stdio.h>
 #undef _XOPEN_SOURCE
 
+#include "compiler.h"
+#include "list.h"
+#include "optimize.h"
+#include "bytecode.h"
+#include "cache.h"
+#include "stack.h"
+
 #include <stdint.h>
 #include <stddef.h>
 #include <stdlib.h>
@@ -24,6 +28,22 @@
 
 #define MAX_FN_CALL_ARGS 6
 
+/* longest branch of a conditional expression lowered to cmov */
+#define CMOV_MAX_ARM_INSNS 6
+
+/* fewest values of a set tested with a bit mask */
+#define BIT_TEST_MIN_VALUES 3
+
+/* size of the huge pages libb backs the program with */
+#define HUGE_PAGE_SIZE "0x200000"
+
+/* estimated iterations of a loop, and the deepest loops counted */
+#define LOOP_WEIGHT    8
+#define MAX_LOOP_DEPTH 4
+
+/* line standing for a function until the optimizer threads finish it */
+#define JOB_PLACEHOLDER "#job "
+
 static const char* arg_registers[MAX_FN_CALL_ARGS] = {
     "%rdi",
     "%rsi",
@@ -33,6 +53,15 @@ static const char* arg_registers[MAX_FN_CALL_ARGS] = {
     "%r9"
 };
 
+static const char* arg_registers32[MAX_FN_CALL_ARGS] = {
+    "%edi",
+    "%esi",
+    "%edx",
+    "%ecx",
+    "%r8d",
+    "%r9d"
+};
+
 enum cmp_operator {
     CMP_LT = 0, /* less-than operator */
     CMP_LE, /* less-than-equal operator */
@@ -100,6 +129,24 @@ const char* binary_code[BIN_OR + 1] = {
                 "  or %rdi, %rax\n",
 };
 
+//
+// Properties of the code generated for an expression.
+//
+enum expr_flag {
+    EXPR_SIDE_EFFECTS = 1 << 0, /* calls, assignments, increments */
+    EXPR_MAY_TRAP     = 1 << 1, /* loads through computed addresses, division */
+    EXPR_BRANCHES     = 1 << 2, /* conditional control flow */
+};
+
+//
+// A case of a switch statement. Consecutive cases jump
+// to the label of the first one.
+//
+struct switch_case {
+    uintptr_t value;
+    uintptr_t label;
+};
+
 struct stack_var {
     char* name;
     unsigned long offset;
@@ -125,9 +172,586 @@ static void free_stack_var(struct stack_var* ptr)
     free(ptr);
 }
 
+//
+// Whole-program facts about a global name, collected by the analysis
+// pass over all input files before any code is generated.
+//
+struct global_sym {
+    char *name;
+    bool is_vector; /* defined as a global vector */
+    bool modified;  /* assigned, incremented or its address taken */
+    bool defined;   /* defined in one of the input files */
+    bool referenced; /* reachable from main */
+    struct list refs; /* globals referenced by this definition */
+    bool is_function; /* defined as a function */
+    bool frame_escapes; /* the function takes the address of a local */
+    unsigned num_params; /* parameters of the function */
+    unsigned modified_params; /* bit mask of parameters assigned in the body */
+    size_t insns;   /* size of the generated body */
+    struct list calls; /* constant arguments of direct calls */
+    struct list specs; /* clones of the function to generate */
+    bool internal;  /* called with arguments left on the stack */
+    struct list edges; /* functions called by this one */
+    unsigned order; /* place in the layout of the functions, 0 for none */
+};
+
+//
+// Calls of one function from another, weighted by the loops around
+// the call sites: an estimate of how often they run.
+//
+struct call_edge {
+    struct global_sym *callee;
+    unsigned long weight;
+};
+
+//
+// Literal arguments of a direct call. Also describes a clone of the
+// callee, generated with those parameters replaced by constants.
+//
+struct specialization {
+    unsigned mask;  /* bit mask of arguments with a known value */
+    intptr_t values[MAX_FN_CALL_ARGS];
+    unsigned count; /* number of call sites */
+    char *label;    /* name of the clone */
+};
+
+//
+// Find a global name in the whole-program symbol table.
+// Optionally create a new entry when it's not found.
+//
+static struct global_sym *find_global(struct compiler_args *args, const char *name, bool create)
+{
+    size_t i;
+    struct global_sym *sym;
+
+    for (i = 0; i < args->globals.size; i++) {
+        sym = (struct global_sym*) args->globals.data[i];
+        if (strcmp(name, sym->name) == 0)
+            return sym;
+    }
+
+    if (!create)
+        return NULL;
+
+    sym = (struct global_sym*) calloc(1, sizeof(struct global_sym));
+    sym->name = strdup(name);
+    list_push(&args->globals, sym);
+    return sym;
+}
+
+//
+// Deallocate the whole-program symbol table.
+//
+static void free_globals(struct compiler_args *args)
+{
+    size_t i, j;
+    struct global_sym *sym;
+
+    for (i = 0; i < args->globals.size; i++) {
+        sym = (struct global_sym*) args->globals.data[i];
+        for (j = 0; j < sym->calls.size; j++)
+            free(sym->calls.data[j]);
+        for (j = 0; j < sym->specs.size; j++) {
+            free(((struct specialization*) sym->specs.data[j])->label);
+            free(sym->specs.data[j]);
+        }
+        for (j = 0; j < sym->edges.size; j++)
+            free(sym->edges.data[j]);
+        list_free(&sym->calls);
+        list_free(&sym->specs);
+        list_free(&sym->edges);
+        list_free(&sym->refs);
+        free(sym->name);
+        free(sym);
+    }
+    list_free(&args->globals);
+}
+
+//
+// Record a reference to a global from the definition being analyzed.
+//
+static void reference_global(struct compiler_args *args, struct global_sym *sym)
+{
+    if (args->analyzing && args->current_def && sym) {
+        list_push(&args->current_def->refs, sym);
+        if (args->cache_record)
+            fprintf(args->cache_record, "r %s\n", sym->name);
+    }
+}
+
+//
+// Mark a global and everything it references, recursively.
+//
+static void mark_referenced(struct global_sym *sym)
+{
+    size_t i;
+
+    if (sym->referenced)
+        return;
+    sym->referenced = true;
+    for (i = 0; i < sym->refs.size; i++)
+        mark_referenced((struct global_sym*) sym->refs.data[i]);
+}
+
+//
+// Find the definitions reachable from main.
+// Without main nothing is known to be unused.
+//
+static void find_referenced(struct compiler_args *args)
+{
+    size_t i;
+    struct global_sym *sym = find_global(args, "main", false);
+
+    if (sym && sym->defined) {
+        mark_referenced(sym);
+        return;
+    }
+    for (i = 0; i < args->globals.size; i++)
+        ((struct global_sym*) args->globals.data[i])->referenced = true;
+}
+
+//
+// Check whether code has to be generated for a top-level definition.
+// With the whole program at hand, definitions never referenced from
+// main are dropped.
+//
+static bool definition_used(struct compiler_args *args, const char *name)
+{
+    struct global_sym *sym;
+
+    if (!args->whole_program)
+        return true;
+    sym = find_global(args, name, false);
+    return !sym || sym->referenced;
+}
+
+//
+// Note that the global lvalue in %rax gets written or escapes.
+//
+static void lvalue_modified(struct compiler_args *args)
+{
+    unsigned long index = args->lvalue_slot / args->word_size - 2;
+
+    if (args->analyzing && args->lvalue_sym) {
+        args->lvalue_sym->modified = true;
+        if (args->cache_record)
+            fprintf(args->cache_record, "m %s\n", args->lvalue_sym->name);
+    }
+    if (args->analyzing && args->current_def && args->lvalue_slot && index < args->num_params)
+        args->current_def->modified_params |= 1u << index;
+}
+
+//
+// Check whether two sets of call arguments agree on the given ones.
+//
+static bool same_arguments(const struct specialization *a, const struct specialization *b, unsigned mask)
+{
+    int i;
+
+    for (i = 0; i < MAX_FN_CALL_ARGS; i++)
+        if ((mask & (1u << i)) && a->values[i] != b->values[i])
+            return false;
+    return true;
+}
+
+//
+// Count a call site passing literal arguments to a function.
+//
+static void record_call(struct list *calls, const struct specialization *site, unsigned count)
+{
+    size_t i;
+    struct specialization *call;
+
+    for (i = 0; i < calls->size; i++) {
+        call = (struct specialization*) calls->data[i];
+        if (call->mask == site->mask && same_arguments(call, site, site->mask)) {
+            call->count += count;
+            return;
+        }
+    }
+    call = (struct specialization*) malloc(sizeof(struct specialization));
+    *call = *site;
+    call->count = count;
+    list_push(calls, call);
+}
+
+//
+// Add the weight of a call site to the edge of the call graph from a
+// function to another.
+//
+static void record_edge(struct global_sym *caller, struct global_sym *callee, unsigned long weight)
+{
+    size_t i;
+    struct call_edge *edge;
+
+    for (i = 0; i < caller->edges.size; i++) {
+        edge = (struct call_edge*) caller->edges.data[i];
+        if (edge->callee == callee) {
+            edge->weight += weight;
+            return;
+        }
+    }
+    edge = (struct call_edge*) malloc(sizeof(struct call_edge));
+    edge->callee = callee;
+    edge->weight = weight;
+    list_push(&caller->edges, edge);
+}
+
+//
+// Choose the clones to generate: for every small function, the sets of
+// constant arguments passed by the most call sites. Only parameters
+// never assigned in the body are replaced.
+//
+static void select_specializations(struct compiler_args *args)
+{
+    size_t i, j;
+    unsigned eligible;
+    struct global_sym *sym;
+    struct specialization site, *call, *best;
+    struct list merged;
+
+    for (i = 0; i < args->globals.size; i++) {
+        sym = (struct global_sym*) args->globals.data[i];
+        if (!sym->is_function || !sym->referenced || sym->frame_escapes ||
+            sym->insns > args->max_specialize_insns)
+            continue;
+
+        eligible = ((1u << sym->num_params) - 1) & ~sym->modified_params;
+        memset(&merged, 0, sizeof(merged));
+        for (j = 0; j < sym->calls.size; j++) {
+            site = *(struct specialization*) sym->calls.data[j];
+            if ((site.mask &= eligible))
+                record_call(&merged, &site, site.count);
+        }
+
+        while (sym->specs.size < args->max_specializations) {
+            best = NULL;
+            for (j = 0; j < merged.size; j++) {
+                call = (struct specialization*) merged.data[j];
+                if (call->count >= args->specialize_min_calls && !call->label &&
+                    (!best || call->count > best->count))
+                    best = call;
+            }
+            if (!best)
+                break;
+            best->label = malloc(strlen(sym->name) + 32);
+            sprintf(best->label, "%s.spec.%lu", sym->name, sym->specs.size);
+            list_push(&sym->specs, best);
+        }
+
+        for (j = 0; j < merged.size; j++) {
+            call = (struct specialization*) merged.data[j];
+            if (!call->label)
+                free(call);
+        }
+        list_free(&merged);
+    }
+}
+
+//
+// Find a clone of the function matching the literal arguments of a call.
+//
+static struct specialization *find_specialization(struct global_sym *sym, const struct specialization *site)
+{
+    size_t i;
+    struct specialization *spec;
+
+    for (i = 0; i < sym->specs.size; i++) {
+        spec = (struct specialization*) sym->specs.data[i];
+        if ((site->mask & spec->mask) == spec->mask && same_arguments(site, spec, spec->mask))
+            return spec;
+    }
+    return NULL;
+}
+
+//
+// Choose the functions called with the internal convention: the caller
+// leaves the arguments on the stack, where they become the parameter
+// slots of the callee, so they are not moved through registers on either
+// side. Calls through a pointer or from the library enter by a stub
+// with the usual convention.
+//
+static void select_conventions(struct compiler_args *args)
+{
+    size_t i;
+    struct global_sym *sym;
+
+    for (i = 0; i < args->globals.size; i++) {
+        sym = (struct global_sym*) args->globals.data[i];
+        sym->internal = sym->is_function && sym->num_params > 0 &&
+                        args->word_size == 8 && strcmp(sym->name, "main") != 0;
+    }
+}
+
+//
+// Edge of the call graph between two functions, in either direction.
+//
+struct affinity {
+    struct global_sym *a, *b;
+    unsigned long weight;
+    size_t index;   /* keeps equal weights in a fixed order */
+};
+
+//
+// A chain of functions laid out together.
+//
+struct chain {
+    struct list syms;
+    unsigned long weight; /* heaviest edge joined into the chain */
+    size_t index;
+};
+
+static int compare_affinities(const void *p, const void *q)
+{
+    const struct affinity *x = *(const struct affinity* const*) p;
+    const struct affinity *y = *(const struct affinity* const*) q;
+
+    if (x->weight != y->weight)
+        return x->weight < y->weight ? 1 : -1;
+    return x->index < y->index ? -1 : x->index > y->index;
+}
+
+static int compare_chains(const void *p, const void *q)
+{
+    const struct chain *x = p, *y = q;
+
+    if (x->weight != y->weight)
+        return x->weight < y->weight ? 1 : -1;
+    return x->index < y->index ? -1 : x->index > y->index;
+}
+
+static size_t chain_position(const struct chain *chain, const struct global_sym *sym)
+{
+    size_t i;
+
+    for (i = 0; chain->syms.data[i] != sym; i++)
+        ;
+    return i;
+}
+
+static void reverse_chain(struct chain *chain)
+{
+    size_t i, n = chain->syms.size;
+    void *sym;
+
+    for (i = 0; i < n / 2; i++) {
+        sym = chain->syms.data[i];
+        chain->syms.data[i] = chain->syms.data[n - 1 - i];
+        chain->syms.data[n - 1 - i] = sym;
+    }
+}
+
+//
+// Join the chains of the two functions of an edge. Of the four ways
+// to put them one after the other, turning either around, the one
+// bringing the two functions closest is taken.
+//
+static void join_chains(struct chain *a, struct chain *b, const struct affinity *edge, size_t *chain_of)
+{
+    size_t pa = chain_position(a, edge->a), pb = chain_position(b, edge->b);
+    size_t na = a->syms.size, nb = b->syms.size, i;
+    size_t distance[4] = {
+        na - pa + pb,               /* a b */
+        na - pa + nb - 1 - pb,      /* a reversed b */
+        pa + 1 + pb,                /* reversed a, b */
+        pa + 1 + nb - 1 - pb,       /* reversed a, reversed b */
+    };
+    unsigned best = 0, k;
+
+    for (k = 1; k < 4; k++)
+        if (distance[k] < distance[best])
+            best = k;
+    if (best >= 2)
+        reverse_chain(a);
+    if (best & 1)
+        reverse_chain(b);
+
+    for (i = 0; i < nb; i++) {
+        list_push(&a->syms, b->syms.data[i]);
+        chain_of[((struct global_sym*) b->syms.data[i])->order - 1] = a->index;
+    }
+    list_clear(&b->syms);
+    if (a->weight < b->weight)
+        a->weight = b->weight;
+    if (a->weight < edge->weight)
+        a->weight = edge->weight;
+}
+
+//
+// Lay out the functions of the program by call-graph affinity, after
+// Pettis and Hansen: going from the heaviest edge down, the chains of
+// its two functions are joined, so that functions calling each other
+// often share cache lines and pages. Chains with heavier edges come
+// first. The place of a function names the section of its code.
+//
+static void order_functions(struct compiler_args *args)
+{
+    size_t i, j, k, num_funcs = 0, *chain_of;
+    unsigned order = 0;
+    struct global_sym *sym, *callee;
+    struct call_edge *edge;
+    struct affinity *pair;
+    struct list pairs = {0};
+    struct chain *chains;
+
+    // Number the functions to lay out, from 1.
+    for (i = 0; i < args->globals.size; i++) {
+        sym = (struct global_sym*) args->globals.data[i];
+        sym->order = sym->is_function && sym->defined && sym->referenced ? ++num_funcs : 0;
+    }
+    if (num_funcs == 0)
+        return;
+
+    // Sum the calls in both directions between two functions.
+    for (i = 0; i < args->globals.size; i++) {
+        sym = (struct global_sym*) args->globals.data[i];
+        for (j = 0; sym->order && j < sym->edges.size; j++) {
+            edge = (struct call_edge*) sym->edges.data[j];
+            callee = edge->callee;
+            if (!callee->order || callee == sym)
+                continue;
+            for (k = 0; k < pairs.size; k++) {
+                pair = (struct affinity*) pairs.data[k];
+                if ((pair->a == sym && pair->b == callee) || (pair->a == callee && pair->b == sym))
+                    break;
+            }
+            if (k == pairs.size) {
+                pair = (struct affinity*) calloc(1, sizeof(struct affinity));
+                pair->a = sym;
+                pair->b = callee;
+                pair->index = k;
+                list_push(&pairs, pair);
+            }
+            pair->weight += edge->weight;
+        }
+    }
+
+    chains = (struct chain*) calloc(num_funcs, sizeof(struct chain));
+    chain_of = (size_t*) malloc(num_funcs * sizeof(size_t));
+    for (i = 0; i < args->globals.size; i++) {
+        sym = (struct global_sym*) args->globals.data[i];
+        if (sym->order) {
+            chains[sym->order - 1].index = sym->order - 1;
+            list_push(&chains[sym->order - 1].syms, sym);
+            chain_of[sym->order - 1] = sym->order - 1;
+        }
+    }
+
+    qsort(pairs.data, pairs.size, sizeof(void*), compare_affinities);
+    for (k = 0; k < pairs.size; k++) {
+        pair = (struct affinity*) pairs.data[k];
+        i = chain_of[pair->a->order - 1];
+        j = chain_of[pair->b->order - 1];
+        if (i != j)
+            join_chains(&chains[i], &chains[j], pair, chain_of);
+        free(pair);
+    }
+    list_free(&pairs);
+
+    qsort(chains, num_funcs, sizeof(struct chain), compare_chains);
+    for (i = 0; i < num_funcs; i++) {
+        for (j = 0; j < chains[i].syms.size; j++)
+            ((struct global_sym*) chains[i].syms.data[j])->order = ++order;
+        list_free(&chains[i].syms);
+    }
+    free(chains);
+    free(chain_of);
+}
+
+//
+// Start the code of a function. In the layout of the functions it
+// goes to the section of its place, which the linker sorts by name.
+//
+static void function_start(struct compiler_args *args, FILE *out, const struct global_sym *sym,
+                           const char *label, bool align)
+{
+    if (sym && sym->order)
+        fprintf(out, ".section .text.sorted.%05u,\"ax\",@progbits\n", sym->order);
+    else
+        fprintf(out, ".text\n");
+    if (align && args->align_functions > 1)
+        fprintf(out, ".align %u\n", args->align_functions);
+    fprintf(out, ".type %s, @function\n%s:\n", label, label);
+}
+
+//
+// Check whether a global name is followed by a call, when the whole
+// program is known. The call then goes straight to the label.
+//
+static bool called_by_name(struct compiler_args *args, struct global_sym *sym, FILE *in)
+{
+    int c;
+
+    if (!args->whole_program || !sym)
+        return false;
+    c = fgetc(in);
+    ungetc(c, in);
+    return c == '(';
+}
+
+//
+// Check whether a global vector keeps its initial pointer word in
+// the whole program. Such a vector is addressed directly.
+//
+static bool direct_vector(struct compiler_args *args, struct global_sym *sym)
+{
+    return args->whole_program && sym && sym->is_vector && !sym->modified;
+}
+
+//
+// Directive emitting one initialized word of data.
+//
+static const char *word_directive(struct compiler_args *args)
+{
+    return args->word_size == 4 ? ".long" : ".quad";
+}
+
+//
+// Shift count converting a word index into a byte offset.
+//
+static int word_shift(struct compiler_args *args)
+{
+    return args->word_size == 4 ? 2 : 3;
+}
+
+//
+// Name of the part of a 64-bit register holding one word.
+//
+static const char *word_reg(struct compiler_args *args, const char *reg)
+{
+    static const char *names[][2] = {
+        { "%rax", "%eax" },
+        { "%rcx", "%ecx" },
+        { "%rdi", "%edi" },
+    };
+    size_t i;
+
+    if (args->word_size != 4)
+        return reg;
+    for (i = 0; i < sizeof(names) / sizeof(names[0]); i++)
+        if (strcmp(reg, names[i][0]) == 0)
+            return names[i][1];
+    return reg;
+}
+
+//
+// Load the word addressed by %rax into %rax.
+// In 32-bit word mode the value is sign-extended.
+//
+static void fetch(struct compiler_args *args, FILE *out)
+{
+    if (args->word_size == 4)
+        fprintf(out, "  movslq (%%rax), %%rax\n");
+    else
+        fprintf(out, "  mov (%%rax), %%rax\n");
+}
+
 static void expression(struct compiler_args *args, FILE *in, FILE *out, int level);
 static void declarations(struct compiler_args *args, FILE *in, FILE *buffer);
+static void statement(struct compiler_args *args, FILE *in, FILE *out,
+                      char* fn_ident, intptr_t switch_id, struct list *cases);
 static int subprocess(const char *arg0, const char *p_name, char *const *p_arg);
+static int run_bytecode(struct compiler_args *args, char *code);
 
 //
 // Print message with prefix "error:".
@@ -144,6 +768,169 @@ void eprintf(const char *arg0, const char *fmt, ...)
     va_end(ap);
 }
 
+//
+// Find the line and column of an offset in the source file. The offsets
+// of its lines are read once, and searched for every location.
+//
+static void source_location(struct compiler_args *args, long pos, unsigned *line, unsigned *column)
+{
+    FILE *in;
+    size_t alloc = 0, low = 0, high, mid;
+    long offset = 0;
+    int c = 0;
+
+    if (!args->line_starts) {
+        in = fopen(args->source_file, "r");
+        do {
+            if (args->num_lines + 1 >= alloc) {
+                alloc = alloc ? alloc * 2 : 256;
+                args->line_starts = realloc(args->line_starts, alloc * sizeof(long));
+            }
+            args->line_starts[args->num_lines++] = offset;
+            while (in && (c = fgetc(in)) != EOF && (offset++, c != '\n'))
+                ;
+        } while (in && c != EOF);
+        /* the end of the file, where offsets past it stop */
+        args->line_starts[args->num_lines] = offset;
+        if (in)
+            fclose(in);
+    }
+
+    if (pos > args->line_starts[args->num_lines])
+        pos = args->line_starts[args->num_lines];
+    high = args->num_lines;
+    while (high - low > 1) {
+        mid = (low + high) / 2;
+        if (args->line_starts[mid] <= pos)
+            low = mid;
+        else
+            high = mid;
+    }
+    *line = low + 1;
+    *column = pos - args->line_starts[low] + 1;
+}
+
+//
+// Add a remark to the set of those reported. Return false when
+// it is there already.
+//
+static bool remark_add(struct compiler_args *args, char *key)
+{
+    char **old = args->remarks;
+    size_t old_size = args->remarks_size, i, mask;
+    uint64_t hash;
+
+    if (2 * (args->num_remarks + 1) > args->remarks_size) {
+        args->remarks_size = old_size ? old_size * 2 : 64;
+        args->remarks = calloc(args->remarks_size, sizeof(char*));
+        args->num_remarks = 0;
+        for (i = 0; i < old_size; i++)
+            if (old[i])
+                remark_add(args, old[i]);
+        free(old);
+    }
+
+    mask = args->remarks_size - 1;
+    hash = CACHE_KEY_INIT;
+    cache_hash_string(&hash, key);
+    for (i = hash & mask; args->remarks[i]; i = (i + 1) & mask)
+        if (strcmp(args->remarks[i], key) == 0)
+            return false;
+    args->remarks[i] = key;
+    args->num_remarks++;
+    return true;
+}
+
+//
+// Remember where a function is defined, for the stack usage report.
+//
+static void stack_site(struct compiler_args *args, const char *name, long pos)
+{
+    struct stack_site *site = (struct stack_site*) malloc(sizeof(struct stack_site));
+    size_t size = strlen(args->source_file) + 32;
+    unsigned line, column;
+
+    source_location(args, pos, &line, &column);
+    site->name = strdup(name);
+    site->location = malloc(size);
+    snprintf(site->location, size, "%s:%u:%u", args->source_file, line, column);
+    list_push(&args->stack_sites, site);
+}
+
+//
+// Write a string of the optimization record, in single quotes.
+//
+static void yaml_string(FILE *out, const char *str)
+{
+    fputc('\'', out);
+    for (; *str; str++) {
+        if (*str == '\'')
+            fputc('\'', out);
+        fputc(*str, out);
+    }
+    fputc('\'', out);
+}
+
+//
+// Check whether remarks or dumps of the passes are requested. They are
+// reported while the functions are compiled one after another.
+//
+bool reports_requested(const struct compiler_args *args)
+{
+    return args->rpass || args->rpass_missed || args->remarks_out || args->print_after;
+}
+
+//
+// Report an optimization remark at an offset in the input file.
+// It's printed when the pass matches -Rpass or -Rpass-missed, and
+// saved in the optimization record. Code generated more than once
+// (unrolled loops, clones) reports the same remark once.
+//
+#ifdef __GNUC__
+__attribute((format(printf, 6, 7)))
+#endif
+void remark(struct compiler_args *args, long pos, enum remark_kind kind,
+            const char *pass, const char *name, const char *fmt, ...)
+{
+    va_list ap;
+    char message[BUFSIZ], *key;
+    regex_t *filter = kind == REMARK_PASSED ? args->rpass : args->rpass_missed;
+    bool print = filter && regexec(filter, pass, 0, NULL, 0) == 0;
+    const char *function = args->fn_label ? args->fn_label : "";
+    unsigned line, column;
+    size_t size;
+
+    if (args->analyzing || !args->source_file || (!print && !args->remarks_out))
+        return;
+
+    va_start(ap, fmt);
+    vsnprintf(message, sizeof(message), fmt, ap);
+    va_end(ap);
+    source_location(args, pos, &line, &column);
+
+    size = strlen(args->source_file) + strlen(function) + strlen(pass) + strlen(message) + 32;
+    key = malloc(size);
+    snprintf(key, size, "%s:%u:%u:%s:%s:%s", args->source_file, line, column, function, pass, message);
+    if (!remark_add(args, key)) {
+        free(key);
+        return;
+    }
+
+    if (print)
+        fprintf(stderr, COLOR_BOLD_WHITE "%s:%u:%u: " COLOR_BOLD_BLUE "remark: " COLOR_RESET "%s [-Rpass%s=%s]\n",
+            args->source_file, line, column, message, kind == REMARK_PASSED ? "" : "-missed", pass);
+
+    if (args->remarks_out) {
+        fprintf(args->remarks_out, "--- !%s\nPass:            %s\nName:            %s\nDebugLoc:        { File: ",
+            kind == REMARK_PASSED ? "Passed" : "Missed", pass, name);
+        yaml_string(args->remarks_out, args->source_file);
+        fprintf(args->remarks_out, ", Line: %u, Column: %u }\nFunction:        %s\nArgs:\n  - String:          ",
+            line, column, function);
+        yaml_string(args->remarks_out, message);
+        fprintf(args->remarks_out, "\n...\n");
+    }
+}
+
 //
 // Concatenate two strings into a dynamically allocated buffer.
 //
@@ -161,20 +948,13 @@ char *concat(const char *a, const char *b)
 }
 
 //
-// Run compiler with given arguments.
+// Open every provided `.b` file and generate assembly for it.
 //
-int compile(struct compiler_args *args)
+static int translate(struct compiler_args *args, FILE *out)
 {
-    // create a buffer for the assembly code
-    char* buf;
-    char* asm_file = args->do_assembling ? concat(args->output_file, ".s") : args->output_file;
-    char* obj_file = args->do_linking ? concat(args->output_file, ".o") : args->output_file;
-    size_t buf_len, len, i;
-    FILE *buffer = open_memstream(&buf, &buf_len);
-    FILE *out, *in;
-    int exit_code;
+    size_t len, i;
+    FILE *in;
 
-    // open every provided `.b` file and generate assembly for it
     for (i = 0; i < (size_t) args->num_input_files; i++) {
         len = strlen(args->input_files[i]);
         if (len >= 2 && args->input_files[i][len - 1] == 'b' && args->input_files[i][len - 2] == '.') {
@@ -182,13 +962,112 @@ int compile(struct compiler_args *args)
                 eprintf(args->arg0, "%s: %s\ncompilation terminated.\n", args->input_files[i], strerror(errno));
                 return 1;
             }
-            declarations(args, in, buffer);
+            args->source_file = args->input_files[i];
+            declarations(args, in, out);
             fclose(in);
+            args->source_file = NULL;
+            free(args->line_starts);
+            args->line_starts = NULL;
+            args->num_lines = 0;
         }
     }
+    return 0;
+}
+
+//
+// Run compiler with given arguments.
+//
+int compile(struct compiler_args *args)
+{
+    // create a buffer for the assembly code
+    char* buf;
+    char* asm_file = args->do_assembling ? concat(args->output_file, ".s") : args->output_file;
+    char* obj_file = args->do_linking ? concat(args->output_file, ".o") : args->output_file;
+    char *record_file;
+    size_t buf_len, i;
+    FILE *buffer = open_memstream(&buf, &buf_len);
+    FILE *out, *null;
+    struct bc_program prog;
+    struct stack_site *site;
+    int exit_code;
+
+    if (args->interpret && bytecode_file(args->input_files[0])) {
+        if (args->num_input_files > 1) {
+            eprintf(args->arg0, "cannot interpret a bytecode file with other input files\n");
+            return 1;
+        }
+        if ((exit_code = bytecode_read(args, args->input_files[0], &prog)))
+            return exit_code;
+        exit_code = interpret(args, &prog);
+        bytecode_free(&prog);
+        return exit_code;
+    }
+
+    if (args->save_remarks) {
+        record_file = concat(args->output_file, ".opt.yaml");
+        if (!(args->remarks_out = fopen(record_file, "w"))) {
+            eprintf(args->arg0, "cannot open file " QUOTE_FMT("%s") " %s.", record_file, strerror(errno));
+            return 1;
+        }
+        free(record_file);
+    }
+
+    // when linking, all B files of the program are known:
+    // analyze them first, discarding the generated code
+    if (args->do_linking && args->opt_level >= 1) {
+        if (!(null = fopen("/dev/null", "w"))) {
+            eprintf(args->arg0, "cannot open file " QUOTE_FMT("/dev/null") " %s.", strerror(errno));
+            return 1;
+        }
+        args->analyzing = true;
+        exit_code = translate(args, null);
+        args->analyzing = false;
+        fclose(null);
+        if (exit_code)
+            return exit_code;
+        find_referenced(args);
+        if (args->specialize)
+            select_specializations(args);
+        if (args->internal_calls)
+            select_conventions(args);
+        if (args->reorder_functions)
+            order_functions(args);
+        args->whole_program = true;
+    }
+
+    if ((exit_code = translate(args, buffer)))
+        return exit_code;
+    free_globals(args);
+
+    for (i = 0; i < args->remarks_size; i++)
+        free(args->remarks[i]);
+    free(args->remarks);
+    if (args->remarks_out)
+        fclose(args->remarks_out);
 
-    // write the buffer to an assembly file
     fclose(buffer);
+    if (args->stack_usage) {
+        record_file = concat(args->output_file, ".su");
+        if (!(out = fopen(record_file, "w"))) {
+            eprintf(args->arg0, "cannot open file " QUOTE_FMT("%s") " %s.", record_file, strerror(errno));
+            return 1;
+        }
+        stack_usage_report(args, buf, out);
+        fclose(out);
+        free(record_file);
+
+        for (i = 0; i < args->stack_sites.size; i++) {
+            site = (struct stack_site*) args->stack_sites.data[i];
+            free(site->name);
+            free(site->location);
+            free(site);
+        }
+        list_free(&args->stack_sites);
+    }
+    if (args->emit_bytecode || args->interpret)
+        return run_bytecode(args, buf);
+
+    // write the buffer to an assembly file
     if (!(out = fopen(asm_file, "w"))) {
         eprintf(args->arg0, "cannot open file " QUOTE_FMT("%s") " %s.", A_S, strerror(errno));
         return 1;
@@ -213,16 +1092,34 @@ int compile(struct compiler_args *args)
     }
 
     if (args->do_linking) {
-        if ((exit_code = subprocess(args->arg0, "ld", (char *const[]){
-            "ld",
-            "-static", "-nostdlib",
-            obj_file,
-            args->lib_dir, "-L/lib64", "-L/usr/local/lib",
-            "-lb",
-            "-o", args->output_file,
-            "-z", "noexecstack",
-            0
-        }))) {
+        char *ld_args[32];
+        size_t n = 0;
+
+        ld_args[n++] = "ld";
+        ld_args[n++] = "-static";
+        ld_args[n++] = "-nostdlib";
+        ld_args[n++] = obj_file;
+        ld_args[n++] = args->lib_dir;
+        ld_args[n++] = "-L/lib64";
+        ld_args[n++] = "-L/usr/local/lib";
+        ld_args[n++] = args->word_size == 4 ? "-lb32" : "-lb";
+        ld_args[n++] = "-o";
+        ld_args[n++] = args->output_file;
+        ld_args[n++] = "-z";
+        ld_args[n++] = "noexecstack";
+        if (args->huge_pages) {
+            /* segments on 2 MB boundaries, and the start of data for libb */
+            ld_args[n++] = "-z";
+            ld_args[n++] = "separate-code";
+            ld_args[n++] = "-z";
+            ld_args[n++] = "max-page-size=" HUGE_PAGE_SIZE;
+            ld_args[n++] = "-z";
+            ld_args[n++] = "common-page-size=" HUGE_PAGE_SIZE;
+            ld_args[n++] = "--defsym=__huge_pages_data=ADDR(.data)";
+        }
+        ld_args[n] = 0;
+
+        if ((exit_code = subprocess(args->arg0, "ld", ld_args))) {
             eprintf(args->arg0, "error running linker (exit code %d)\n", exit_code);
             return 1;
         }
@@ -234,6 +1131,36 @@ int compile(struct compiler_args *args)
     return 0;
 }
 
+//
+// Translate the generated code of the program into bytecode,
+// then write it to the output file or run it.
+//
+static int run_bytecode(struct compiler_args *args, char *code)
+{
+    struct bc_program prog;
+    FILE *out;
+    int exit_code;
+
+    exit_code = bytecode_assemble(args, code, &prog);
+    free(code);
+    if (exit_code == 0 && args->interpret) {
+        fflush(stdout);
+        exit_code = interpret(args, &prog);
+    }
+    else if (exit_code == 0) {
+        if (!(out = fopen(args->output_file, "wb"))) {
+            eprintf(args->arg0, "cannot open file " QUOTE_FMT("%s") " %s.", args->output_file, strerror(errno));
+            exit_code = 1;
+        }
+        else {
+            bytecode_write(&prog, out);
+            fclose(out);
+        }
+    }
+    bytecode_free(&prog);
+    return exit_code;
+}
+
 //
 // Execute a program as a sub-process.
 // Wait for completion.
@@ -485,6 +1412,7 @@ static void ival(struct compiler_args *args, FILE *in, FILE *out)
 {
     static char buffer[BUFSIZ];
     intptr_t value;
+    struct global_sym *sym;
     int c = fgetc(in);
 
     if (isalpha(c)) {
@@ -493,25 +1421,31 @@ static void ival(struct compiler_args *args, FILE *in, FILE *out)
             eprintf(args->arg0, "unexpected end of file, expect ival\n");
             exit(1);
         }
-        fprintf(out, "  .quad %s\n", buffer);
+        if (args->analyzing) {
+            /* the address of this name is stored in data */
+            sym = find_global(args, buffer, true);
+            sym->modified = true;
+            reference_global(args, sym);
+        }
+        fprintf(out, "  %s %s\n", word_directive(args), buffer);
     }
     else if (c == '\'') {
         if ((value = character(args, in)) == EOF) {
             eprintf(args->arg0, "unexpected end of file, expect ival\n");
             exit(1);
         }
-        fprintf(out, "  .quad %lu\n", value);
+        fprintf(out, "  %s %lu\n", word_directive(args), value);
     }
     else if (c == '\"') {
         string(args, in);
-        fprintf(out, "  .quad .string.%lu\n", args->strings.size - 1);
+        fprintf(out, "  %s .string.%lu\n", word_directive(args), args->strings.size - 1);
     }
     else if (c == '-') {
         if ((value = number(args, in)) == EOF) {
             eprintf(args->arg0, "unexpected end of file, expect ival\n");
             exit(1);
         }
-        fprintf(out, "  .quad -%lu\n", value);
+        fprintf(out, "  %s -%lu\n", word_directive(args), value);
     }
     else {
         ungetc(c, in);
@@ -519,7 +1453,7 @@ static void ival(struct compiler_args *args, FILE *in, FILE *out)
             eprintf(args->arg0, "unexpected end of file, expect ival\n");
             exit(1);
         }
-        fprintf(out, "  .quad %lu\n", value);
+        fprintf(out, "  %s %lu\n", word_directive(args), value);
     }
 }
 
@@ -580,12 +1514,15 @@ static void vector(struct compiler_args *args, FILE *in, FILE *out, char *identi
         }
     }
 
+    if (args->analyzing)
+        find_global(args, identifier, true)->is_vector = true;
+
     fprintf(out,
         ".data\n.type %s, @object\n"
         ".align %d\n"
         "%s:\n"
-        "  .quad .+8\n",
-        identifier, args->word_size, identifier
+        "  %s .+%d\n",
+        identifier, args->word_size, identifier, word_directive(args), args->word_size
     );
 
     whitespace(args, in);
@@ -637,6 +1574,34 @@ static intptr_t find_identifier(struct compiler_args *args, const char *buffer,
     return -1;
 }
 
+//
+// Parse an argument of a direct call, noting whether it's a literal.
+//
+static void call_argument(struct compiler_args *args, FILE *in, FILE *out, int index, struct specialization *site)
+{
+    char *code;
+    size_t len;
+    intptr_t value;
+    int n = 0;
+    FILE *buffer = open_memstream(&code, &len);
+
+    expression(args, in, buffer, 15);
+    fclose(buffer);
+
+    if (index < MAX_FN_CALL_ARGS) {
+        if (strcmp(code, "  xor %rax, %rax\n") == 0)
+            value = 0;
+        else if (sscanf(code, "  mov $%ld, %%rax%n", &value, &n) != 1 || strcmp(code + n, "\n") != 0)
+            index = -1;
+        if (index >= 0) {
+            site->mask |= 1u << index;
+            site->values[index] = value;
+        }
+    }
+    fputs(code, out);
+    free(code);
+}
+
 //
 // Parse a postfix operation.
 // Return true when result is lvalue (address of the value).
@@ -644,28 +1609,52 @@ static intptr_t find_identifier(struct compiler_args *args, const char *buffer,
 static bool postfix(struct compiler_args *args, FILE *in, FILE *out, bool is_lvalue)
 {
     int c, num_args = 0;
+    struct global_sym *sym = args->lvalue_sym;
+    unsigned long slot = args->lvalue_slot;
+    struct specialization site, *spec = NULL;
+    struct global_sym *callee;
+    bool direct_call, internal;
+    int i;
+    long pos;
 
     switch (c = fgetc(in)) {
     case '[':
         /* index operator */
-        fprintf(out, "  push (%%rax)\n");
+        if (is_lvalue && args->word_size != 4)
+            fprintf(out, "  push (%%rax)\n");
+        else {
+            if (is_lvalue)
+                fetch(args, out);
+            fprintf(out, "  push %%rax\n");
+        }
         expression(args, in, out, 15);
-        fprintf(out, "  pop %%rdi\n  shl $3, %%rax\n  add %%rdi, %%rax\n");
+        fprintf(out, "  pop %%rdi\n  shl $%d, %%rax\n  add %%rdi, %%rax\n", word_shift(args));
 
         if ((c = fgetc(in)) != ']') {
             eprintf(args->arg0, "unexpected token " QUOTE_FMT("%c") ", expect closing " QUOTE_FMT("]") " after index expression\n", c);
             exit(1);
         }
+        args->expr_flags |= EXPR_MAY_TRAP;
+        sym = NULL;
+        slot = 0;
         is_lvalue = true;
         break;
 
     case '(':
         /* function call */
-        fprintf(out, "  push %%rax\n");
+        callee = is_lvalue && sym && args->whole_program ? sym : NULL;
+        pos = callee ? ftell(in) - 1 - (long) strlen(callee->name) : 0;
+        if (!callee)
+            fprintf(out, "  push %%rax\n");
+        direct_call = is_lvalue && sym && args->specialize && (args->analyzing || args->whole_program);
+        memset(&site, 0, sizeof(site));
 
         while ((c = fgetc(in)) != ')') {
             ungetc(c, in);
-            expression(args, in, out, 15);
+            if (direct_call)
+                call_argument(args, in, out, num_args, &site);
+            else
+                expression(args, in, out, 15);
 
             if (++num_args > MAX_FN_CALL_ARGS) {
                 eprintf(args->arg0, "only %d call arguments are currently supported\n", MAX_FN_CALL_ARGS);
@@ -683,10 +1672,59 @@ static bool postfix(struct compiler_args *args, FILE *in, FILE *out, bool is_lva
             exit(1);
         }
 
-        while (num_args > 0)
-            fprintf(out, "  pop %s\n", arg_registers[--num_args]);
+        if (args->analyzing && is_lvalue && sym && args->current_def) {
+            /* every loop around the call makes it LOOP_WEIGHT times as frequent */
+            unsigned long weight = 1;
+
+            for (i = 0; i < (int) args->loop_depth && i < MAX_LOOP_DEPTH; i++)
+                weight *= LOOP_WEIGHT;
+            record_edge(args->current_def, sym, weight);
+            if (args->cache_record)
+                fprintf(args->cache_record, "e %s %lu\n", sym->name, weight);
+        }
 
-        fprintf(out, "  pop %%r10\n  call *%%r10\n");
+        /* the arguments stay on the stack when they match the parameters */
+        internal = callee && callee->internal && (unsigned) num_args == callee->num_params;
+        if (internal)
+            remark(args, pos, REMARK_PASSED, "internal-calls", "InternalCall",
+                "arguments of '%s' left on the stack", callee->name);
+        else if (callee && callee->internal)
+            remark(args, pos, REMARK_MISSED, "internal-calls", "ArgumentCount",
+                "call of '%s' passes %d of %u arguments, so it takes the usual convention",
+                callee->name, num_args, callee->num_params);
+        for (i = num_args; i > 0 && !internal; )
+            fprintf(out, "  pop %s\n", arg_registers[--i]);
+
+        if (direct_call && site.mask) {
+            if (args->analyzing) {
+                record_call(&sym->calls, &site, 1);
+                if (args->cache_record) {
+                    fprintf(args->cache_record, "c %s %u", sym->name, site.mask);
+                    for (i = 0; i < MAX_FN_CALL_ARGS; i++)
+                        fprintf(args->cache_record, " %ld", (long) site.values[i]);
+                    fprintf(args->cache_record, "\n");
+                }
+            }
+            else if (internal || !callee || !callee->internal)
+                spec = find_specialization(sym, &site);
+        }
+        if (!callee)
+            fprintf(out, "  pop %%r10\n  call *%%r10\n");
+        else if (spec)
+            fprintf(out, "  call %s\n", spec->label);
+        else if (internal)
+            fprintf(out, "  call %s.internal\n", callee->name);
+        else
+            fprintf(out, "  call %s\n", callee->name);
+        if (internal)
+            fprintf(out, "  add $%d, %%rsp\n", num_args * 8);
+        if (args->word_size == 4) {
+            /* libb functions return 32-bit words in %eax */
+            fprintf(out, "  movslq %%eax, %%rax\n");
+        }
+        args->expr_flags |= EXPR_SIDE_EFFECTS;
+        sym = NULL;
+        slot = 0;
         is_lvalue = false;
         break;
 
@@ -698,10 +1736,15 @@ static bool postfix(struct compiler_args *args, FILE *in, FILE *out, bool is_lva
         }
 
         /* postfix increment operator */
+        lvalue_modified(args);
+        args->expr_flags |= EXPR_SIDE_EFFECTS;
+        sym = NULL;
+        slot = 0;
         fprintf(out,
-            "  mov (%%rax), %%rcx\n"
-            "  addq $1, (%%rax)\n"
-            "  mov %%rcx, %%rax\n"
+            "  %s (%%rax), %%rcx\n"
+            "  add%c $1, (%%rax)\n"
+            "  mov %%rcx, %%rax\n",
+            args->word_size == 4 ? "movslq" : "mov", args->word_size == 4 ? 'l' : 'q'
         );
         is_lvalue = false;
         break;
@@ -714,10 +1757,15 @@ static bool postfix(struct compiler_args *args, FILE *in, FILE *out, bool is_lva
         }
 
         /* postfix decrement operator */
+        lvalue_modified(args);
+        args->expr_flags |= EXPR_SIDE_EFFECTS;
+        sym = NULL;
+        slot = 0;
         fprintf(out,
-            "  mov (%%rax), %%rcx\n"
-            "  subq $1, (%%rax)\n"
-            "  mov %%rcx, %%rax\n"
+            "  %s (%%rax), %%rcx\n"
+            "  sub%c $1, (%%rax)\n"
+            "  mov %%rcx, %%rax\n",
+            args->word_size == 4 ? "movslq" : "mov", args->word_size == 4 ? 'l' : 'q'
         );
         is_lvalue = false;
         break;
@@ -726,9 +1774,252 @@ static bool postfix(struct compiler_args *args, FILE *in, FILE *out, bool is_lva
         ungetc(c, in);
         break;
     }
+    args->lvalue_sym = sym;
+    args->lvalue_slot = slot;
     return is_lvalue;
 }
 
+//
+// Builtins compiled inline. They take the names of functions nowhere
+// declared: a function of the program with one of these names has to
+// be declared extrn where it is called.
+//
+enum builtin {
+    BUILTIN_POPCNT, /* number of bits set */
+    BUILTIN_CLZ,    /* leading zero bits, the word size for 0 */
+    BUILTIN_CTZ,    /* trailing zero bits, the word size for 0 */
+    BUILTIN_BSWAP,  /* bytes in reverse order */
+    BUILTIN_MULHI,  /* high word of the unsigned product */
+    BUILTIN_ROTL,   /* bits rotated left */
+    BUILTIN_PREFETCH, /* load a cache line ahead of use, the address */
+    BUILTIN_LIKELY, /* the argument, mostly true in a condition */
+    BUILTIN_UNLIKELY, /* the argument, mostly false in a condition */
+    BUILTIN_NTSTORE, /* store a word around the cache, the word */
+    BUILTIN_SFENCE, /* order the stores around the cache before later ones, 0 */
+};
+
+static const struct {
+    const char *name;
+    int num_args;
+    unsigned constants; /* mask of the arguments that have to be literals */
+} builtins[] = {
+    [BUILTIN_POPCNT]   = { "popcnt",   1, 0 },
+    [BUILTIN_CLZ]      = { "clz",      1, 0 },
+    [BUILTIN_CTZ]      = { "ctz",      1, 0 },
+    [BUILTIN_BSWAP]    = { "bswap",    1, 0 },
+    [BUILTIN_MULHI]    = { "mulhi",    2, 0 },
+    [BUILTIN_ROTL]     = { "rotl",     2, 0 },
+    [BUILTIN_PREFETCH] = { "prefetch", 3, 6 },
+    [BUILTIN_LIKELY]   = { "likely",   1, 0 },
+    [BUILTIN_UNLIKELY] = { "unlikely", 1, 0 },
+    [BUILTIN_NTSTORE]  = { "ntstore",  2, 0 },
+    [BUILTIN_SFENCE]   = { "sfence",   0, 0 },
+};
+
+/* prefetch instructions by locality, from none to all cache levels */
+static const char *prefetch_insns[] = { "prefetchnta", "prefetcht2", "prefetcht1", "prefetcht0" };
+
+//
+// Count the bits set in %rax without popcnt: sums of bit pairs,
+// nibbles and bytes, added up by a multiplication.
+//
+static void popcount(FILE *out)
+{
+    fprintf(out,
+        "  mov %%rax, %%rcx\n"
+        "  shr $1, %%rcx\n"
+        "  movabs $%ld, %%rdx\n"
+        "  and %%rdx, %%rcx\n"
+        "  sub %%rcx, %%rax\n"
+        "  movabs $%ld, %%rdx\n"
+        "  mov %%rax, %%rcx\n"
+        "  shr $2, %%rax\n"
+        "  and %%rdx, %%rcx\n"
+        "  and %%rdx, %%rax\n"
+        "  add %%rcx, %%rax\n"
+        "  mov %%rax, %%rcx\n"
+        "  shr $4, %%rcx\n"
+        "  add %%rcx, %%rax\n"
+        "  movabs $%ld, %%rdx\n"
+        "  and %%rdx, %%rax\n"
+        "  movabs $%ld, %%rdx\n"
+        "  imul %%rdx, %%rax\n"
+        "  shr $56, %%rax\n",
+        0x5555555555555555l, 0x3333333333333333l, 0x0f0f0f0f0f0f0f0fl, 0x0101010101010101l);
+}
+
+//
+// Compile a call of a builtin starting at pos, with the '(' next.
+// The arguments but the last one are pushed, the last is in %rax;
+// literal arguments only go to constants. Without popcnt, lzcnt and
+// tzcnt (-mpopcnt, -mlzcnt and -mbmi) the counts are done by a
+// sequence of arithmetic, and by bsr and bsf, which are undefined for 0.
+//
+static void builtin(struct compiler_args *args, FILE *in, FILE *out, enum builtin b, long pos)
+{
+    bool word32 = args->word_size == 4, pushed = false;
+    int c, i, bits = args->word_size * 8;
+    intptr_t constants[MAX_FN_CALL_ARGS] = {0};
+
+    ASSERT_CHAR(args, in, '(', "expect " QUOTE_FMT("(") " after builtin " QUOTE_FMT("%s") "\n", builtins[b].name);
+    whitespace(args, in);
+    if (builtins[b].num_args == 0)
+        ASSERT_CHAR(args, in, ')', "builtin " QUOTE_FMT("%s") " takes no arguments\n", builtins[b].name);
+    for (i = 0; i < builtins[b].num_args; i++) {
+        whitespace(args, in);
+        if (builtins[b].constants & (1u << i)) {
+            if (!isdigit(c = fgetc(in))) {
+                eprintf(args->arg0, "argument %d of builtin " QUOTE_FMT("%s") " has to be a number\n",
+                    i + 1, builtins[b].name);
+                exit(1);
+            }
+            ungetc(c, in);
+            constants[i] = number(args, in);
+        }
+        else {
+            if (pushed)
+                fprintf(out, "  push %%rax\n");
+            expression(args, in, out, 15);
+            pushed = true;
+        }
+        whitespace(args, in);
+        c = fgetc(in);
+        if (c != (i + 1 < builtins[b].num_args ? ',' : ')')) {
+            eprintf(args->arg0, "builtin " QUOTE_FMT("%s") " takes %d argument%s\n",
+                builtins[b].name, builtins[b].num_args, builtins[b].num_args > 1 ? "s" : "");
+            exit(1);
+        }
+    }
+
+    switch (b) {
+    case BUILTIN_POPCNT:
+        if (args->popcnt)
+            fprintf(out, "  popcnt %s, %s\n", word_reg(args, "%rax"), word_reg(args, "%rax"));
+        else {
+            if (word32)
+                fprintf(out, "  mov %%eax, %%eax\n");
+            popcount(out);
+        }
+        break;
+
+    case BUILTIN_CLZ:
+        if (args->lzcnt)
+            fprintf(out, "  lzcnt %s, %s\n", word_reg(args, "%rax"), word_reg(args, "%rax"));
+        else {
+            /* bits - 1 - index of the highest bit set, with -1 for no bit */
+            fprintf(out,
+                "  mov $-1, %%rcx\n"
+                "  bsr %s, %s\n"
+                "  cmovz %%rcx, %%rax\n"
+                "  neg %%rax\n"
+                "  add $%d, %%rax\n",
+                word_reg(args, "%rax"), word_reg(args, "%rax"), bits - 1);
+        }
+        break;
+
+    case BUILTIN_CTZ:
+        if (args->bmi)
+            fprintf(out, "  tzcnt %s, %s\n", word_reg(args, "%rax"), word_reg(args, "%rax"));
+        else {
+            fprintf(out,
+                "  mov $%d, %%rcx\n"
+                "  bsf %s, %s\n"
+                "  cmovz %%rcx, %%rax\n",
+                bits, word_reg(args, "%rax"), word_reg(args, "%rax"));
+        }
+        break;
+
+    case BUILTIN_BSWAP:
+        fprintf(out, "  bswap %s\n", word_reg(args, "%rax"));
+        if (word32)
+            fprintf(out, "  movslq %%eax, %%rax\n");
+        break;
+
+    case BUILTIN_MULHI:
+        if (word32) {
+            fprintf(out,
+                "  pop %%rdi\n"
+                "  mov %%eax, %%eax\n"
+                "  mov %%edi, %%edi\n"
+                "  imul %%rdi, %%rax\n"
+                "  shr $32, %%rax\n"
+                "  movslq %%eax, %%rax\n");
+        }
+        else
+            fprintf(out, "  pop %%rdi\n  mul %%rdi\n  mov %%rdx, %%rax\n");
+        break;
+
+    case BUILTIN_ROTL:
+        fprintf(out, "  mov %%rax, %%rcx\n  pop %%rax\n  rol %%cl, %s\n", word_reg(args, "%rax"));
+        if (word32)
+            fprintf(out, "  movslq %%eax, %%rax\n");
+        break;
+
+    case BUILTIN_PREFETCH:
+        /* a prefetch for writing keeps the line in every level */
+        if (constants[1] > 1 || constants[2] > 3) {
+            eprintf(args->arg0, "builtin " QUOTE_FMT("prefetch") " takes 0 or 1 to read or write, and a locality of 0 to 3\n");
+            exit(1);
+        }
+        fprintf(out, "  %s (%%rax)\n", constants[1] ? "prefetchw" : prefetch_insns[constants[2]]);
+        break;
+
+    case BUILTIN_LIKELY:
+    case BUILTIN_UNLIKELY:
+        /* a condition made of the call alone lays out its statement */
+        args->branch_hint = b == BUILTIN_LIKELY ? 1 : -1;
+        args->hint_start = pos;
+        args->hint_end = ftell(in);
+        break;
+
+    case BUILTIN_NTSTORE:
+        fprintf(out, "  pop %%rdi\n  movnti %s, (%%rdi)\n", word_reg(args, "%rax"));
+        args->expr_flags |= EXPR_SIDE_EFFECTS | EXPR_MAY_TRAP;
+        break;
+
+    case BUILTIN_SFENCE:
+        fprintf(out, "  sfence\n  xor %%rax, %%rax\n");
+        args->expr_flags |= EXPR_SIDE_EFFECTS;
+        break;
+    }
+}
+
+//
+// Return the builtin of a name, or -1.
+//
+static int find_builtin(const char *name)
+{
+    size_t i;
+
+    for (i = 0; i < sizeof(builtins) / sizeof(builtins[0]); i++)
+        if (strcmp(name, builtins[i].name) == 0)
+            return i;
+    return -1;
+}
+
+//
+// Return the builtin to compile for a call of an undeclared name, or -1
+// for a call of the function of the program with that name. When linking,
+// the analysis pass takes every such call as a function call, since the
+// definition may come later, and then all definitions are known. Otherwise
+// only those parsed so far are; one coming after the builtin was used is
+// an error at the definition.
+//
+static int call_builtin(struct compiler_args *args, const char *name)
+{
+    struct global_sym *sym;
+    int b = find_builtin(name);
+
+    if (b < 0 || args->analyzing)
+        return -1;
+    if (args->whole_program)
+        return (sym = find_global(args, name, false)) && sym->defined ? -1 : b;
+    if (args->builtins_defined & 1u << b)
+        return -1;
+    args->builtins_called |= 1u << b;
+    return b;
+}
+
 //
 // Parse a term.
 // It may have only unary operations (no binary ops).
@@ -740,6 +2031,10 @@ static bool term(struct compiler_args *args, FILE *in, FILE *out)
     int c;
     intptr_t value;
     bool is_lvalue = false, is_extrn = false;
+    struct global_sym *sym = NULL;
+    unsigned long slot = 0;
+    char *name;
+    long pos;
 
     whitespace(args, in);
 
@@ -764,7 +2059,7 @@ static bool term(struct compiler_args *args, FILE *in, FILE *out)
     case '!': /* not operator */
         if (term(args, in, out)) {
             /* fetch rvalue */
-            fprintf(out, "  mov (%%rax), %%rax\n");
+            fetch(args, out);
         }
         fprintf(out, "  cmp $0, %%rax\n  sete %%al\n  movzx %%al, %%rax\n");
         break;
@@ -775,14 +2070,17 @@ static bool term(struct compiler_args *args, FILE *in, FILE *out)
                 eprintf(args->arg0, "expected lvalue after " QUOTE_FMT("--") "\n");
                 exit(1);
             }
-            fprintf(out, "  mov (%%rax), %%rdi\n  sub $1, %%rdi\n  mov %%rdi, (%%rax)\n");
+            lvalue_modified(args);
+            args->expr_flags |= EXPR_SIDE_EFFECTS;
+            fprintf(out, "  %s (%%rax), %%rdi\n  sub $1, %%rdi\n  mov %s, (%%rax)\n",
+                args->word_size == 4 ? "movslq" : "mov", word_reg(args, "%rdi"));
             is_lvalue = true;
         }
         else { /* negation operator */
             ungetc(c, in);
             if (term(args, in, out)) {
                 /* fetch rvalue */
-                fprintf(out, "  mov (%%rax), %%rax\n");
+                fetch(args, out);
             }
             fprintf(out, "  neg %%rax\n");
         }
@@ -797,23 +2095,34 @@ static bool term(struct compiler_args *args, FILE *in, FILE *out)
             eprintf(args->arg0, "expected lvalue after " QUOTE_FMT("++") "\n");
             exit(1);
         }
-        fprintf(out, "  mov (%%rax), %%rdi\n  add $1, %%rdi\n  mov %%rdi, (%%rax)\n");
+        lvalue_modified(args);
+        args->expr_flags |= EXPR_SIDE_EFFECTS;
+        fprintf(out, "  %s (%%rax), %%rdi\n  add $1, %%rdi\n  mov %s, (%%rax)\n",
+            args->word_size == 4 ? "movslq" : "mov", word_reg(args, "%rdi"));
         is_lvalue = true;
         break;
 
     case '*': /* indirection operator */
         if (term(args, in, out)) {
             /* fetch rvalue */
-            fprintf(out, "  mov (%%rax), %%rax\n");
+            fetch(args, out);
         }
+        args->expr_flags |= EXPR_MAY_TRAP;
         is_lvalue = true;
         break;
 
     case '&': /* address operator */
+        pos = ftell(in) - 1;
         if (!term(args, in, out)) {
             eprintf(args->arg0, "expected lvalue after " QUOTE_FMT("&") "\n");
             exit(1);
         }
+        lvalue_modified(args);
+        if (args->lvalue_slot) {
+            remark(args, pos, REMARK_MISSED, "local-value-numbering", "AddressTaken",
+                "address of a local is taken: locals stay in memory, and their loads and stores are kept");
+            args->address_taken = true;
+        }
         break;
 
     case EOF:
@@ -832,6 +2141,7 @@ static bool term(struct compiler_args *args, FILE *in, FILE *out)
             is_lvalue = true;
 
             ungetc(c, in);
+            pos = ftell(in);
             identifier(args, in, buffer);
 
             if ((value = find_identifier(args, buffer, &is_extrn)) < 0) {
@@ -839,6 +2149,16 @@ static bool term(struct compiler_args *args, FILE *in, FILE *out)
                 // Unknown identifier.
                 whitespace(args, in);
                 c = fgetc(in);
+                if (c == '(' && (value = call_builtin(args, buffer)) >= 0) {
+                    ungetc(c, in);
+                    builtin(args, in, out, value, pos);
+                    args->lvalue_sym = NULL;
+                    args->lvalue_slot = 0;
+                    is_lvalue = postfix(args, in, out, false);
+                    sym = args->lvalue_sym;
+                    slot = args->lvalue_slot;
+                    break;
+                }
                 if (c == '(') {
                     // When next symbol is '(', add this name to the list of externals.
                     ungetc(c, in);
@@ -850,12 +2170,61 @@ static bool term(struct compiler_args *args, FILE *in, FILE *out)
                 }
             }
 
-            if (is_extrn)
+            if (is_extrn) {
+                sym = find_global(args, buffer, args->analyzing);
+                reference_global(args, sym);
+            }
+            else if (args->spec && (unsigned long) value < args->num_params &&
+                     (args->spec->mask & (1u << value))) {
+                /* the clone is only called with this argument */
+                if (args->spec->values[value])
+                    fprintf(out, "  mov $%ld, %%rax\n", args->spec->values[value]);
+                else
+                    fprintf(out, "  xor %%rax, %%rax\n");
+                args->lvalue_sym = NULL;
+                args->lvalue_slot = 0;
+                is_lvalue = postfix(args, in, out, false);
+                sym = args->lvalue_sym;
+                slot = args->lvalue_slot;
+                break;
+            }
+
+            if (direct_vector(args, sym)) {
+                /* the pointer word of this vector never changes, so use the address of its data */
+                name = strdup(buffer);
+                if ((c = fgetc(in)) == '[') {
+                    expression(args, in, out, 15);
+                    if ((c = fgetc(in)) != ']') {
+                        eprintf(args->arg0, "unexpected token " QUOTE_FMT("%c") ", expect closing " QUOTE_FMT("]") " after index expression\n", c);
+                        exit(1);
+                    }
+                    fprintf(out, "  lea %s+%d(%%rip), %%rdi\n  lea (%%rdi,%%rax,%d), %%rax\n",
+                        name, args->word_size, args->word_size);
+                    args->expr_flags |= EXPR_MAY_TRAP;
+                    is_lvalue = true;
+                }
+                else {
+                    ungetc(c, in);
+                    fprintf(out, "  lea %s+%d(%%rip), %%rax\n", name, args->word_size);
+                    is_lvalue = postfix(args, in, out, false);
+                }
+                free(name);
+                sym = NULL;
+                break;
+            }
+
+            if (!is_extrn) {
+                slot = (value + 2) * args->word_size;
+                fprintf(out, "  lea -%lu(%%rbp), %%rax\n", slot);
+            }
+            else if (!called_by_name(args, sym, in))
                 fprintf(out, "  lea %s(%%rip), %%rax\n", buffer);
-            else
-                fprintf(out, "  lea -%lu(%%rbp), %%rax\n", (value + 2) * args->word_size);
 
+            args->lvalue_sym = sym;
+            args->lvalue_slot = slot;
             is_lvalue = postfix(args, in, out, is_lvalue);
+            sym = args->lvalue_sym;
+            slot = args->lvalue_slot;
         }
         else {
             eprintf(args->arg0, "unexpected character " QUOTE_FMT("%c") ", expect expression\n", c);
@@ -863,9 +2232,25 @@ static bool term(struct compiler_args *args, FILE *in, FILE *out)
         }
     }
 
+    args->lvalue_sym = sym;
+    args->lvalue_slot = slot;
     return is_lvalue;
 }
 
+//
+// Count lines (instructions) in a piece of generated code.
+//
+static size_t count_lines(const char *code)
+{
+    size_t n = 0;
+
+    while ((code = strchr(code, '\n'))) {
+        code++;
+        n++;
+    }
+    return n;
+}
+
 //
 // Generate code for binary operation.
 //
@@ -874,6 +2259,8 @@ static void binary_expr(struct compiler_args *args, FILE *in, FILE *out, enum bi
     fprintf(out, "  push %%rax\n");
     expression(args, in, out, level);
     fputs(binary_code[op], out);
+    if (op == BIN_DIV || op == BIN_MOD)
+        args->expr_flags |= EXPR_MAY_TRAP;
 }
 
 //
@@ -991,15 +2378,179 @@ static void assign_expr(struct compiler_args *args, FILE *in, FILE *out, char c,
     }
 }
 
+//
+// Find the base and the 64-bit mask of a set of values.
+// Fail when there are too few of them or they are too far apart.
+//
+static bool value_mask(const uintptr_t *values, size_t count, uintptr_t *base, uint64_t *mask)
+{
+    size_t i;
+    uintptr_t max = 0;
+
+    if (count < BIT_TEST_MIN_VALUES)
+        return false;
+    *base = values[0];
+    for (i = 0; i < count; i++) {
+        if (values[i] < *base)
+            *base = values[i];
+        if (values[i] > max)
+            max = values[i];
+    }
+    if (max - *base >= 64 || max > INT32_MAX)
+        return false;
+
+    *mask = 0;
+    for (i = 0; i < count; i++)
+        *mask |= (uint64_t) 1 << (values[i] - *base);
+    return true;
+}
+
+//
+// Set the carry flag when the value in %rax is in the set given by
+// a base and a mask. Values out of the range of the mask test against
+// an empty one. %rax is preserved.
+//
+static void bit_test(FILE *out, uintptr_t base, uint64_t mask)
+{
+    if (base)
+        fprintf(out, "  lea -%lu(%%rax), %%rcx\n", base);
+    else
+        fprintf(out, "  mov %%rax, %%rcx\n");
+    fprintf(out,
+        "  %s $%lu, %%rdx\n"
+        "  xor %%rdi, %%rdi\n"
+        "  cmp $63, %%rcx\n"
+        "  cmova %%rdi, %%rdx\n"
+        "  bt %%rcx, %%rdx\n",
+        mask > INT32_MAX ? "movabs" : "mov", mask
+    );
+}
+
+//
+// Recognize a name compared with a set of constants:
+//      c == 'a' | c == 'e' | c == 'i' ...
+// and evaluate it with one bit test. Otherwise consume nothing
+// and return false.
+//
+static bool membership_test(struct compiler_args *args, FILE *in, FILE *out)
+{
+    static char name[BUFSIZ], buffer[BUFSIZ];
+    long start, end, pos;
+    uintptr_t values[64], value, base;
+    uint64_t mask;
+    size_t count = 0, i;
+    int c;
+
+    // The position is only reliable once the name is read:
+    // the statement parser may have pushed it back.
+    if (!identifier(args, in, name))
+        return false;
+    start = end = ftell(in);
+
+    while (count < 64) {
+        if (count && (!identifier(args, in, buffer) || strcmp(buffer, name) != 0))
+            break;
+        whitespace(args, in);
+        if (fgetc(in) != '=' || fgetc(in) != '=' || (c = fgetc(in)) == '=')
+            break;
+        ungetc(c, in);
+
+        whitespace(args, in);
+        if ((c = fgetc(in)) == '\'')
+            value = character(args, in);
+        else if (isdigit(c)) {
+            ungetc(c, in);
+            value = number(args, in);
+        }
+        else
+            break;
+
+        /* nothing binding tighter than | may follow */
+        whitespace(args, in);
+        pos = ftell(in);
+        if ((c = fgetc(in)) == EOF || !strchr("|);,?:]", c))
+            break;
+        values[count++] = value;
+        end = pos;
+        if (c != '|')
+            break;
+    }
+
+    fseek(in, start, SEEK_SET);
+    for (i = strlen(name); i > 0; i--)
+        ungetc(name[i - 1], in);
+    if (!isalpha(name[0]))
+        return false;
+    if (!value_mask(values, count, &base, &mask)) {
+        if (count >= BIT_TEST_MIN_VALUES)
+            remark(args, start - strlen(name), REMARK_MISSED, "bit-test", "TooFarApart",
+                "comparisons of '%s' not tested with a bit mask: the values are 64 or more apart", name);
+        return false;
+    }
+    remark(args, start - strlen(name), REMARK_PASSED, "bit-test", "BitTest",
+        "%zu comparisons of '%s' tested with a bit mask", count, name);
+
+    if (term(args, in, out))
+        fetch(args, out);
+    fseek(in, end, SEEK_SET);
+    bit_test(out, base, mask);
+    fprintf(out, "  setc %%al\n  movzb %%al, %%rax\n");
+    return true;
+}
+
+//
+// Generate the comparisons of a switch statement. Three or more cases
+// sharing a label, with values less than 64 apart, are tested at once.
+//
+static void switch_dispatch(struct compiler_args *args, FILE *out, size_t id, struct list *cases, long pos)
+{
+    size_t i, j, count;
+    uintptr_t values[64], base, label;
+    uint64_t mask;
+    struct switch_case *sc;
+
+    for (i = 0; i < cases->size; i = j) {
+        label = ((struct switch_case*) cases->data[i])->label;
+        for (j = i, count = 0; j < cases->size; j++) {
+            sc = (struct switch_case*) cases->data[j];
+            if (sc->label != label)
+                break;
+            if (count < 64)
+                values[count++] = sc->value;
+        }
+
+        if (args->opt_level >= 1 && j - i == count && value_mask(values, count, &base, &mask)) {
+            remark(args, pos, REMARK_PASSED, "bit-test", "BitTest",
+                "%zu case values tested with a bit mask", count);
+            bit_test(out, base, mask);
+            fprintf(out, "  jc .L.case.%lu.%lu\n", id, label);
+            continue;
+        }
+        for (; i < j; i++) {
+            sc = (struct switch_case*) cases->data[i];
+            fprintf(out, "  cmp $%lu, %%rax\n  je .L.case.%lu.%lu\n", sc->value, id, sc->value);
+        }
+    }
+}
+
 //
 // Parse expression.
 // Allow operations up to the given precedence level.
 //
 static void expression(struct compiler_args *args, FILE *in, FILE *out, int level)
 {
-    bool left_is_lvalue = term(args, in, out);
+    bool left_is_lvalue;
     int c, c2;
-    static size_t conditional = 0;
+    unsigned long slot;
+    unsigned flags, then_flags, else_flags;
+    char *then_buf, *else_buf;
+    size_t then_len, else_len;
+    FILE *then_out, *else_out;
+
+    if (level >= 10 && args->opt_level >= 1 && membership_test(args, in, out))
+        left_is_lvalue = false;
+    else
+        left_is_lvalue = term(args, in, out);
 
     for (;;) {
         whitespace(args, in);
@@ -1007,23 +2558,57 @@ static void expression(struct compiler_args *args, FILE *in, FILE *out, int leve
 
         if (level >= 13 && c == '?') {
             /* ternary operators have the lowest precedence, so they need to be resolved here */
-            size_t this_conditional = conditional++;
+            size_t this_conditional = args->cond_id++;
 
             if (left_is_lvalue) {
                 /* fetch rvalue */
-                fprintf(out, "  mov (%%rax), %%rax\n");
+                fetch(args, out);
                 left_is_lvalue = false;
             }
-            fprintf(out, "  cmp $0, %%rax\n  je .L.cond.else.%ld\n", this_conditional);
-            expression(args, in, out, 12);
+
+            // generate both branches aside to choose between cmov and jumps
+            flags = args->expr_flags;
+            then_out = open_memstream(&then_buf, &then_len);
+            args->expr_flags = 0;
+            expression(args, in, then_out, 12);
+            then_flags = args->expr_flags;
+            fclose(then_out);
+
             whitespace(args, in);
             if ((c2 = fgetc(in)) != ':') {
                 eprintf(args->arg0, "unexpected character " QUOTE_FMT("%c") ", expect " QUOTE_FMT(":") " between conditional branches\n", c2);
                 exit(1);
             }
-            fprintf(out, "  jmp .L.cond.end.%ld\n.L.cond.else.%ld:\n", this_conditional, this_conditional);
-            expression(args, in, out, 13);
-            fprintf(out, ".L.cond.end.%ld:\n", this_conditional);
+
+            else_out = open_memstream(&else_buf, &else_len);
+            args->expr_flags = 0;
+            expression(args, in, else_out, 13);
+            else_flags = args->expr_flags;
+            fclose(else_out);
+
+            args->expr_flags = flags | then_flags | else_flags;
+            if (args->opt_level >= 1 && !then_flags && !else_flags &&
+                    count_lines(then_buf) <= CMOV_MAX_ARM_INSNS &&
+                    count_lines(else_buf) <= CMOV_MAX_ARM_INSNS) {
+                /* both branches are cheap and safe to evaluate unconditionally */
+                fprintf(out, "  push %%rax\n%s  push %%rax\n%s", then_buf, else_buf);
+                fprintf(out,
+                    "  pop %%rdi\n"
+                    "  pop %%rcx\n"
+                    "  cmp $0, %%rcx\n"
+                    "  cmovne %%rdi, %%rax\n"
+                );
+            }
+            else {
+                fprintf(out, "  cmp $0, %%rax\n  je .L.cond.else.%ld\n", this_conditional);
+                fputs(then_buf, out);
+                fprintf(out, "  jmp .L.cond.end.%ld\n.L.cond.else.%ld:\n", this_conditional, this_conditional);
+                fputs(else_buf, out);
+                fprintf(out, ".L.cond.end.%ld:\n", this_conditional);
+                args->expr_flags |= EXPR_BRANCHES;
+            }
+            free(then_buf);
+            free(else_buf);
             return;
         }
 
@@ -1033,7 +2618,7 @@ static void expression(struct compiler_args *args, FILE *in, FILE *out, int leve
         if (level >= 4 && c == '+') {
             /* addition operator */
             if (left_is_lvalue) {
-                fprintf(out, "  mov (%%rax), %%rax\n");
+                fetch(args, out);
                 left_is_lvalue = false;
             }
             binary_expr(args, in, out, BIN_ADD, 3);
@@ -1042,7 +2627,7 @@ static void expression(struct compiler_args *args, FILE *in, FILE *out, int leve
         if (level >= 4 && c == '-') {
             /* subtraction operator */
             if (left_is_lvalue) {
-                fprintf(out, "  mov (%%rax), %%rax\n");
+                fetch(args, out);
                 left_is_lvalue = false;
             }
             binary_expr(args, in, out, BIN_SUB, 3);
@@ -1051,7 +2636,7 @@ static void expression(struct compiler_args *args, FILE *in, FILE *out, int leve
         if (level >= 3 && c == '*') {
             /* multiplication operator */
             if (left_is_lvalue) {
-                fprintf(out, "  mov (%%rax), %%rax\n");
+                fetch(args, out);
                 left_is_lvalue = false;
             }
             binary_expr(args, in, out, BIN_MUL, 2);
@@ -1060,7 +2645,7 @@ static void expression(struct compiler_args *args, FILE *in, FILE *out, int leve
         if (level >= 3 && c == '/') {
             /* division operator */
             if (left_is_lvalue) {
-                fprintf(out, "  mov (%%rax), %%rax\n");
+                fetch(args, out);
                 left_is_lvalue = false;
             }
             binary_expr(args, in, out, BIN_DIV, 2);
@@ -1069,7 +2654,7 @@ static void expression(struct compiler_args *args, FILE *in, FILE *out, int leve
         if (level >= 3 && c == '%') {
             /* modulo operator */
             if (left_is_lvalue) {
-                fprintf(out, "  mov (%%rax), %%rax\n");
+                fetch(args, out);
                 left_is_lvalue = false;
             }
             binary_expr(args, in, out, BIN_MOD, 2);
@@ -1080,7 +2665,7 @@ static void expression(struct compiler_args *args, FILE *in, FILE *out, int leve
             if (level >= 5 && c2 == '<') {
                 /* shift-left operator */
                 if (left_is_lvalue) {
-                    fprintf(out, "  mov (%%rax), %%rax\n");
+                    fetch(args, out);
                     left_is_lvalue = false;
                 }
                 binary_expr(args, in, out, BIN_SHL, 4);
@@ -1089,7 +2674,7 @@ static void expression(struct compiler_args *args, FILE *in, FILE *out, int leve
             if (level >= 6 && c2 == '=') {
                 /* less-than-or-equal operator */
                 if (left_is_lvalue) {
-                    fprintf(out, "  mov (%%rax), %%rax\n");
+                    fetch(args, out);
                     left_is_lvalue = false;
                 }
                 cmp_expr(args, in, out, CMP_LE, 5);
@@ -1099,7 +2684,7 @@ static void expression(struct compiler_args *args, FILE *in, FILE *out, int leve
             if (level >= 6) {
                 /* less-than operator */
                 if (left_is_lvalue) {
-                    fprintf(out, "  mov (%%rax), %%rax\n");
+                    fetch(args, out);
                     left_is_lvalue = false;
                 }
                 cmp_expr(args, in, out, CMP_LT, 5);
@@ -1111,7 +2696,7 @@ static void expression(struct compiler_args *args, FILE *in, FILE *out, int leve
             if (level >= 5 && c2 == '>') {
                 /* shift-right-operator */
                 if (left_is_lvalue) {
-                    fprintf(out, "  mov (%%rax), %%rax\n");
+                    fetch(args, out);
                     left_is_lvalue = false;
                 }
                 binary_expr(args, in, out, BIN_SAR, 4);
@@ -1120,7 +2705,7 @@ static void expression(struct compiler_args *args, FILE *in, FILE *out, int leve
             if (level >= 6 && c2 == '=') {
                 /* greater-than-or-equal operator */
                 if (left_is_lvalue) {
-                    fprintf(out, "  mov (%%rax), %%rax\n");
+                    fetch(args, out);
                     left_is_lvalue = false;
                 }
                 cmp_expr(args, in, out, CMP_GE, 5);
@@ -1130,7 +2715,7 @@ static void expression(struct compiler_args *args, FILE *in, FILE *out, int leve
             if (level >= 6) {
                 /* greater-than operator */
                 if (left_is_lvalue) {
-                    fprintf(out, "  mov (%%rax), %%rax\n");
+                    fetch(args, out);
                     left_is_lvalue = false;
                 }
                 cmp_expr(args, in, out, CMP_GT, 5);
@@ -1144,7 +2729,7 @@ static void expression(struct compiler_args *args, FILE *in, FILE *out, int leve
                 exit(1);
             }
             if (left_is_lvalue) {
-                fprintf(out, "  mov (%%rax), %%rax\n");
+                fetch(args, out);
                 left_is_lvalue = false;
             }
             cmp_expr(args, in, out, CMP_NE, 6);
@@ -1153,7 +2738,7 @@ static void expression(struct compiler_args *args, FILE *in, FILE *out, int leve
         if (level >= 8 && c == '&') {
             /* bitwise and operator */
             if (left_is_lvalue) {
-                fprintf(out, "  mov (%%rax), %%rax\n");
+                fetch(args, out);
                 left_is_lvalue = false;
             }
             binary_expr(args, in, out, BIN_AND, 7);
@@ -1162,7 +2747,7 @@ static void expression(struct compiler_args *args, FILE *in, FILE *out, int leve
         if (level >= 10 && c == '|') {
             /* bitwise or operator */
             if (left_is_lvalue) {
-                fprintf(out, "  mov (%%rax), %%rax\n");
+                fetch(args, out);
                 left_is_lvalue = false;
             }
             binary_expr(args, in, out, BIN_OR, 9);
@@ -1176,7 +2761,7 @@ static void expression(struct compiler_args *args, FILE *in, FILE *out, int leve
                 if (c3 != '=') {
                     /* equality operator */
                     if (left_is_lvalue) {
-                        fprintf(out, "  mov (%%rax), %%rax\n");
+                        fetch(args, out);
                         left_is_lvalue = false;
                     }
                     cmp_expr(args, in, out, CMP_EQ, 6);
@@ -1191,23 +2776,414 @@ static void expression(struct compiler_args *args, FILE *in, FILE *out, int leve
                     eprintf(args->arg0, "left operand of assignment has to be an lvalue");
                     exit(1);
                 }
-                fprintf(out, "  push %%rax\n  mov (%%rax), %%rax\n");
+                lvalue_modified(args);
+                args->expr_flags |= EXPR_SIDE_EFFECTS;
+                slot = args->lvalue_slot;
+                if (args->opt_level >= 1 && slot && !strchr("+*-/%<>!=&|", c2)) {
+                    /* plain assignment to a local: store into its frame slot */
+                    assign_expr(args, in, out, c2, 14);
+                    fprintf(out, "  mov %s, -%lu(%%rbp)\n", word_reg(args, "%rax"), slot);
+                    left_is_lvalue = false;
+                    continue;
+                }
+                if (args->opt_level >= 1 && slot && c2 && strchr("+-&|", c2)) {
+                    /* update a local in place with a memory destination operand */
+                    expression(args, in, out, 14);
+                    fprintf(out, "  %s %s, -%lu(%%rbp)\n  %s -%lu(%%rbp), %%rax\n",
+                        c2 == '+' ? "add" : c2 == '-' ? "sub" : c2 == '&' ? "and" : "or",
+                        word_reg(args, "%rax"), slot, args->word_size == 4 ? "movslq" : "mov", slot);
+                    left_is_lvalue = false;
+                    continue;
+                }
+                fprintf(out, "  push %%rax\n");
+                fetch(args, out);
                 assign_expr(args, in, out, c2, 14);
-                fprintf(out, "  pop %%rdi\n  mov %%rax, (%%rdi)\n");
+                fprintf(out, "  pop %%rdi\n  mov %s, (%%rdi)\n", word_reg(args, "%rax"));
                 left_is_lvalue = false;
                 continue;
             }
             ungetc(c2, in);
         }
 
-        // No more operations at this level.
-        ungetc(c, in);
-        if (left_is_lvalue) {
-            /* fetch rvalue */
-            fprintf(out, "  mov (%%rax), %%rax\n");
+        // No more operations at this level.
+        ungetc(c, in);
+        if (left_is_lvalue) {
+            /* fetch rvalue */
+            fetch(args, out);
+        }
+        return;
+    }
+}
+
+//
+// Split a piece of the input into tokens for loop analysis.
+// Literals become a single placeholder token, comments are skipped.
+//
+static void loop_tokens(FILE *in, long start, long end, struct list *tokens)
+{
+    size_t len = end - start, i = 0, n;
+    char *text = malloc(len + 1);
+    char quote;
+
+    fseek(in, start, SEEK_SET);
+    len = fread(text, 1, len, in);
+    text[len] = '\0';
+
+    while (i < len) {
+        if (isspace(text[i])) {
+            i++;
+        }
+        else if (text[i] == '/' && text[i + 1] == '*') {
+            for (i += 2; i < len && !(text[i] == '*' && text[i + 1] == '/'); i++)
+                ;
+            i += 2;
+        }
+        else if (text[i] == '"' || text[i] == '\'') {
+            for (quote = text[i++]; i < len && text[i] != quote; i++)
+                if (text[i] == '*')
+                    i++;
+            i++;
+            list_push(tokens, strdup("\""));
+        }
+        else if (isalnum(text[i]) || text[i] == '_') {
+            for (n = i; n < len && (isalnum(text[n]) || text[n] == '_'); n++)
+                ;
+            list_push(tokens, strndup(text + i, n - i));
+            i = n;
+        }
+        else {
+            list_push(tokens, strndup(text + i, 1));
+            i++;
+        }
+    }
+    free(text);
+}
+
+//
+// Free the tokens of a loop.
+//
+static void free_tokens(struct list *tokens)
+{
+    size_t i;
+
+    for (i = 0; i < tokens->size; i++)
+        free(tokens->data[i]);
+    list_free(tokens);
+}
+
+//
+// Get a token, or an empty string when out of range.
+//
+static const char *token_at(struct list *tokens, long i)
+{
+    return i >= 0 && (size_t) i < tokens->size ? tokens->data[i] : "";
+}
+
+//
+// Check that a name is not modified or has its address taken
+// in tokens [0, end).
+//
+static bool name_unmodified(struct list *tokens, size_t end, const char *name)
+{
+    size_t i;
+
+    for (i = 0; i < end; i++) {
+        if (strcmp(tokens->data[i], name) != 0)
+            continue;
+        if (strcmp(token_at(tokens, i + 1), "=") == 0 &&
+            (strcmp(token_at(tokens, i + 2), "=") != 0 || strcmp(token_at(tokens, i + 3), "=") == 0))
+            return false; /* assignment */
+        if (strchr("+-", token_at(tokens, i + 1)[0]) && token_at(tokens, i + 1)[0] &&
+            strcmp(token_at(tokens, i + 1), token_at(tokens, i + 2)) == 0)
+            return false; /* postfix increment or decrement */
+        if (strchr("+-", token_at(tokens, i - 1)[0]) && token_at(tokens, i - 1)[0] &&
+            strcmp(token_at(tokens, i - 1), token_at(tokens, i - 2)) == 0)
+            return false; /* prefix increment or decrement */
+        if (strcmp(token_at(tokens, i - 1), "&") == 0)
+            return false;
+    }
+    return true;
+}
+
+//
+// Get the value of a numeric token the way number() reads it.
+//
+static intptr_t token_number(const char *token)
+{
+    intptr_t num = 0;
+    int base = token[0] == '0' ? 8 : 10;
+
+    for (; isdigit(*token); token++)
+        num = num * base + *token - '0';
+    return *token ? -1 : num;
+}
+
+//
+// Recognize a counted loop:
+//      while (i < n) { ...; i++; }
+// where i is a local and n is a local or a number, neither of which
+// is changed by the body except for the final increment.
+// Fill the frame offsets of i and n (0 for a number) and the bound.
+//
+static bool counted_loop(struct compiler_args *args, FILE *in, long cond_pos, long body_pos, long body_end,
+    unsigned long *var, unsigned long *bound_var, intptr_t *bound, bool *inclusive)
+{
+    struct list cond = {0}, body = {0};
+    size_t i, colons = 0, questions = 0, end;
+    long braces = 0, parens = 0;
+    intptr_t offset;
+    bool is_extrn, ok = false;
+    const char *name, *limit;
+
+    loop_tokens(in, cond_pos, body_pos, &cond);
+    loop_tokens(in, body_pos, body_end, &body);
+    fseek(in, body_end, SEEK_SET);
+
+    *inclusive = cond.size == 5 && strcmp(token_at(&cond, 2), "=") == 0;
+    if ((cond.size != 4 && !*inclusive) || strcmp(token_at(&cond, 1), "<") != 0 ||
+        strcmp(token_at(&cond, cond.size - 1), ")") != 0)
+        goto done;
+    name = cond.data[0];
+    limit = cond.data[cond.size - 2];
+
+    if (args->address_taken || (offset = find_identifier(args, name, &is_extrn)) < 0 || is_extrn)
+        goto done;
+    *var = (offset + 2) * args->word_size;
+
+    if (isdigit(limit[0])) {
+        *bound_var = 0;
+        if ((*bound = token_number(limit)) < 0)
+            goto done;
+    }
+    else if ((offset = find_identifier(args, limit, &is_extrn)) >= 0 && !is_extrn)
+        *bound_var = (offset + 2) * args->word_size;
+    else
+        goto done;
+
+    /* a block ending with the increment */
+    end = body.size - 5;
+    if (body.size < 6 || strcmp(body.data[0], "{") != 0 || strcmp(body.data[body.size - 1], "}") != 0 ||
+        strcmp(body.data[end], name) != 0 || strcmp(body.data[end + 1], "+") != 0 ||
+        strcmp(body.data[end + 2], "+") != 0 || strcmp(body.data[end + 3], ";") != 0)
+        goto done;
+
+    /* as a statement of the block itself, not the body of an inner
+       if, else or while */
+    if (strcmp(body.data[end - 1], ")") == 0 || strcmp(body.data[end - 1], "else") == 0)
+        goto done;
+    for (i = 0; i < end; i++) {
+        braces += (strcmp(body.data[i], "{") == 0) - (strcmp(body.data[i], "}") == 0);
+        parens += (strcmp(body.data[i], "(") == 0) - (strcmp(body.data[i], ")") == 0);
+    }
+    if (braces != 1 || parens != 0)
+        goto done;
+
+    /* no declarations or labels to duplicate */
+    for (i = 0; i < body.size; i++) {
+        if (strcmp(body.data[i], "auto") == 0 || strcmp(body.data[i], "extrn") == 0)
+            goto done;
+        colons += strcmp(body.data[i], ":") == 0;
+        questions += strcmp(body.data[i], "?") == 0;
+    }
+    ok = colons <= questions && name_unmodified(&body, end, name) &&
+        (!*bound_var || name_unmodified(&body, body.size, limit));
+
+done:
+    free_tokens(&cond);
+    free_tokens(&body);
+    return ok;
+}
+
+//
+// Drop strings added to the string table since it had the given size.
+//
+static void discard_strings(struct compiler_args *args, size_t size)
+{
+    while (args->strings.size > size)
+        free(args->strings.data[--args->strings.size]);
+}
+
+//
+// Drop cold code added since there was the given number of blocks.
+//
+static void discard_cold_code(struct compiler_args *args, size_t size)
+{
+    while (args->cold_code.size > size)
+        free(args->cold_code.data[--args->cold_code.size]);
+}
+
+//
+// Emit a while loop, unrolled when it counts a local up to a bound.
+// The unrolled part runs while there is room for all copies of the body,
+// the original loop then handles the remaining iterations.
+//
+static void while_loop(struct compiler_args *args, FILE *in, FILE *out, char *fn_ident, size_t id)
+{
+    long cond_pos, body_pos, body_end;
+    unsigned long var, bound_var;
+    intptr_t bound = 0;
+    size_t factor, cond_len, body_len, num_strings, num_cold;
+    char *cond_code, *body_code;
+    FILE *cond_out, *body_out;
+    bool inclusive;
+
+    cond_pos = ftell(in);
+    cond_out = open_memstream(&cond_code, &cond_len);
+    expression(args, in, cond_out, 15);
+    fclose(cond_out);
+    whitespace(args, in);
+    ASSERT_CHAR(args, in, ')', "expect " QUOTE_FMT(")") " after condition\n");
+
+    body_pos = ftell(in);
+    num_strings = args->strings.size;
+    num_cold = args->cold_code.size;
+    body_out = open_memstream(&body_code, &body_len);
+    statement(args, in, body_out, fn_ident, -1, NULL);
+    fclose(body_out);
+    body_end = ftell(in);
+
+    // limit the unrolled code size
+    factor = args->unroll_factor;
+    while (factor > 1 && factor * count_lines(body_code) > args->max_unrolled_insns)
+        factor--;
+
+    if (!counted_loop(args, in, cond_pos, body_pos, body_end, &var, &bound_var, &bound, &inclusive))
+        remark(args, cond_pos, REMARK_MISSED, "unroll", "NotCounted",
+            "loop not unrolled: it does not count a local up by one to a bound the body keeps unchanged");
+    else if (factor <= 1 && args->unroll_factor > 1)
+        remark(args, cond_pos, REMARK_MISSED, "unroll", "TooLarge",
+            "loop not unrolled: two copies of the body exceed max-unrolled-insns=%u", args->max_unrolled_insns);
+    else if (factor > 1) {
+        remark(args, cond_pos, REMARK_PASSED, "unroll", "Unrolled", "loop unrolled %zu times", factor);
+        discard_strings(args, num_strings);
+        discard_cold_code(args, num_cold);
+
+        fprintf(out, ".L.unroll.%lu:\n  %s -%lu(%%rbp), %%rax\n  add $%lu, %%rax\n",
+            id, args->word_size == 4 ? "movslq" : "mov", var, factor - 1);
+        if (bound_var)
+            fprintf(out, "  %s -%lu(%%rbp), %%rdi\n", args->word_size == 4 ? "movslq" : "mov", bound_var);
+        else
+            fprintf(out, "  mov $%ld, %%rdi\n", bound);
+        fprintf(out, "  cmp %%rdi, %%rax\n  %s .L.start.%lu\n", inclusive ? "jg" : "jge", id);
+
+        for (; factor > 0; factor--) {
+            fseek(in, body_pos, SEEK_SET);
+            statement(args, in, out, fn_ident, -1, NULL);
+        }
+        fprintf(out, "  jmp .L.unroll.%lu\n", id);
+
+        // remaining iterations
+        fseek(in, body_pos, SEEK_SET);
+        free(body_code);
+        body_out = open_memstream(&body_code, &body_len);
+        statement(args, in, body_out, fn_ident, -1, NULL);
+        fclose(body_out);
+    }
+
+    fprintf(out, ".L.start.%lu:\n%s", id, cond_code);
+    fprintf(out,
+        "  cmp $0, %%rax\n"
+        "  je .L.end.%lu\n",
+        id
+    );
+    fputs(body_code, out);
+    fprintf(out, "  jmp .L.start.%lu\n.L.end.%lu:\n", id, id);
+
+    free(cond_code);
+    free(body_code);
+}
+
+//
+// Check for the keyword else, and skip it when it is there.
+//
+static bool else_keyword(struct compiler_args *args, FILE *in)
+{
+    char buffer[6] = "";
+    int i;
+
+    whitespace(args, in);
+    if ((buffer[0] = fgetc(in)) == 'e' &&
+       (buffer[1] = fgetc(in)) == 'l' &&
+       (buffer[2] = fgetc(in)) == 's' &&
+       (buffer[3] = fgetc(in)) == 'e' &&
+       !isalnum((buffer[4] = fgetc(in))))
+        return true;
+
+    for (i = 4; i >= 0; i--) {
+        if (buffer[i])
+            ungetc(buffer[i], in);
+    }
+    return false;
+}
+
+//
+// Emit an if statement whose condition is a call of likely() or
+// unlikely(), with the value in %rax. The arm expected to run falls
+// through; the other one goes to the cold code after the function.
+//
+static void hinted_if(struct compiler_args *args, FILE *in, FILE *out, char *fn_ident, size_t id, int hint)
+{
+    char *then_code, *else_code = NULL, *hot, *cold, *cold_code;
+    size_t len;
+    FILE *arm;
+
+    arm = open_memstream(&then_code, &len);
+    statement(args, in, arm, fn_ident, -1, NULL);
+    fclose(arm);
+    if (else_keyword(args, in)) {
+        arm = open_memstream(&else_code, &len);
+        statement(args, in, arm, fn_ident, -1, NULL);
+        fclose(arm);
+    }
+
+    hot = hint > 0 ? then_code : else_code;
+    cold = hint > 0 ? else_code : then_code;
+    if (!cold)
+        fprintf(out, "  cmp $0, %%rax\n  je .L.end.%lu\n", id);
+    else {
+        fprintf(out, "  cmp $0, %%rax\n  %s .L.cold.%lu\n", hint > 0 ? "je" : "jne", id);
+        arm = open_memstream(&cold_code, &len);
+        fprintf(arm, ".L.cold.%lu:\n%s  jmp .L.end.%lu\n", id, cold, id);
+        fclose(arm);
+        list_push(&args->cold_code, cold_code);
+    }
+    fprintf(out, "%s.L.end.%lu:\n", hot ? hot : "", id);
+
+    free(then_code);
+    free(else_code);
+}
+
+//
+// Parse the constant of a case label, and the colon after it.
+//
+static uintptr_t case_constant(struct compiler_args *args, FILE *in)
+{
+    int c;
+    intptr_t value;
+
+    whitespace(args, in);
+    switch (c = fgetc(in)) {
+    case '\'':
+        value = character(args, in);
+        break;
+    default:
+        if (isdigit(c)) {
+            ungetc(c, in);
+            value = number(args, in);
+            break;
         }
-        return;
+
+        eprintf(args->arg0, "unexpected character " QUOTE_FMT("%c") ", expect constant after " QUOTE_FMT("case") "\n", c);
+        exit(1);
+    }
+
+    if (value == EOF) {
+        eprintf(args->arg0, "unexpected end of file, expect constant after " QUOTE_FMT("case") "\n");
+        exit(1);
     }
+    whitespace(args, in);
+    ASSERT_CHAR(args, in, ':', "expect " QUOTE_FMT(":") " after " QUOTE_FMT("case") "\n");
+    return value;
 }
 
 //
@@ -1219,8 +3195,12 @@ static void statement(struct compiler_args *args, FILE *in, FILE *out,
     int c;
     static char buffer[BUFSIZ];
     size_t id;
-    static size_t stmt_id = 0; /* unique id for each statement for generating labels */
     intptr_t i, value = 0;
+    uintptr_t label = 0;
+    long pos;
+    int hint;
+    bool first;
+    struct switch_case *sc;
     struct list switch_case_list;
 
     whitespace(args, in);
@@ -1280,41 +3260,42 @@ static void statement(struct compiler_args *args, FILE *in, FILE *out,
                 return;
             }
             else if (strcmp(buffer, "if") == 0) { /* conditional statement */
-                id = stmt_id++;
+                id = args->stmt_id++;
 
                 ASSERT_CHAR(args, in, '(', "expect " QUOTE_FMT("(") " after " QUOTE_FMT("if") "\n");
+                whitespace(args, in);
+                pos = ftell(in);
+                args->branch_hint = 0;
                 expression(args, in, out, 15);
-                fprintf(out, "  cmp $0, %%rax\n  je .L.else.%lu\n", id);
                 whitespace(args, in);
+                hint = args->branch_hint && args->hint_start == pos && args->hint_end == ftell(in) ?
+                    args->branch_hint : 0;
                 ASSERT_CHAR(args, in, ')', "expect " QUOTE_FMT(")") " after condition\n");
+                if (hint) {
+                    hinted_if(args, in, out, fn_ident, id, hint);
+                    return;
+                }
+                fprintf(out, "  cmp $0, %%rax\n  je .L.else.%lu\n", id);
 
                 statement(args, in, out, fn_ident, -1, NULL);
                 fprintf(out, "  jmp .L.end.%lu\n.L.else.%lu:\n", id, id);
 
-                whitespace(args, in);
-                memset(buffer, 0, 6 * sizeof(char));
-                if ((buffer[0] = fgetc(in)) == 'e' &&
-                   (buffer[1] = fgetc(in)) == 'l' &&
-                   (buffer[2] = fgetc(in)) == 's' &&
-                   (buffer[3] = fgetc(in)) == 'e' &&
-                   !isalnum((buffer[4] = fgetc(in)))) {
+                if (else_keyword(args, in))
                     statement(args, in, out, fn_ident, -1, NULL);
-                }
-                else {
-                    for (i = 4; i >= 0; i--) {
-                        if (buffer[i])
-                            ungetc(buffer[i], in);
-                    }
-                }
 
                 fprintf(out, ".L.end.%lu:\n", id);
                 return;
             }
             else if (strcmp(buffer, "while") == 0) { /* while statement */
-                id = stmt_id++;
+                id = args->stmt_id++;
 
                 ASSERT_CHAR(args, in, '(', "expect " QUOTE_FMT("(") " after " QUOTE_FMT("while") "\n");
+                if (args->unroll_loops && args->opt_level >= 1 && !args->analyzing) {
+                    while_loop(args, in, out, fn_ident, id);
+                    return;
+                }
                 fprintf(out, ".L.start.%lu:\n", id);
+                args->loop_depth++;
                 expression(args, in, out, 15);
                 fprintf(out,
                     "  cmp $0, %%rax\n"
@@ -1325,11 +3306,13 @@ static void statement(struct compiler_args *args, FILE *in, FILE *out,
                 ASSERT_CHAR(args, in, ')', "expect " QUOTE_FMT(")") " after condition\n");
 
                 statement(args, in, out, fn_ident, -1, NULL);
+                args->loop_depth--;
                 fprintf(out, "  jmp .L.start.%lu\n.L.end.%lu:\n", id, id);
                 return;
             }
             else if (strcmp(buffer, "switch") == 0) { /* switch statement */
-                id = stmt_id++;
+                id = args->stmt_id++;
+                pos = ftell(in);
 
                 expression(args, in, out, 15);
                 fprintf(out, "  jmp .L.cmp.%ld\n.L.stmts.%ld:\n", id, id);
@@ -1342,46 +3325,39 @@ static void statement(struct compiler_args *args, FILE *in, FILE *out,
                     id, id
                 );
 
-                for (i = 0; i < (intptr_t) switch_case_list.size; i++)
-                    fprintf(out, "  cmp $%lu, %%rax\n  je .L.case.%lu.%lu\n", (uintptr_t) switch_case_list.data[i], id, (uintptr_t) switch_case_list.data[i]);
-
+                switch_dispatch(args, out, id, &switch_case_list, pos);
                 fprintf(out, ".L.end.%ld:\n", id);
 
+                for (i = 0; i < (intptr_t) switch_case_list.size; i++)
+                    free(switch_case_list.data[i]);
                 list_free(&switch_case_list);
                 return;
             }
             else if (strcmp(buffer, "case") == 0) { /* case statement */
-                id = stmt_id++;
+                id = args->stmt_id++;
 
                 if (switch_id < 0) {
                     eprintf(args->arg0, "unexpected " QUOTE_FMT("case") " outside of " QUOTE_FMT("switch") " statements\n");
                     exit(1);
                 }
 
-                switch (c = fgetc(in)) {
-                case '\'':
-                    value = character(args, in);
-                    break;
-                default:
-                    if (isdigit(c)) {
-                        ungetc(c, in);
-                        value = number(args, in);
-                        break;
-                    }
-
-                    eprintf(args->arg0, "unexpected character " QUOTE_FMT("%c") ", expect constant after " QUOTE_FMT("case") "\n", c);
-                    exit(1);
-                }
-
-                if ((intptr_t) value == EOF) {
-                    eprintf(args->arg0, "unexpected end of file, expect constant after " QUOTE_FMT("case") "\n");
-                    exit(1);
-                }
-                whitespace(args, in);
-                ASSERT_CHAR(args, in, ':', "expect " QUOTE_FMT(":") " after " QUOTE_FMT("case") "\n");
-                list_push(cases, (void*) value);
+                // Consecutive cases share the label of the first one.
+                first = true;
+                do {
+                    value = case_constant(args, in);
+                    if (first)
+                        label = value;
+                    first = false;
+                    sc = (struct switch_case*) malloc(sizeof(struct switch_case));
+                    sc->value = value;
+                    sc->label = label;
+                    list_push(cases, sc);
+
+                    fprintf(out, ".L.case.%ld.%lu:\n", switch_id, value);
+                    pos = ftell(in);
+                } while (identifier(args, in, buffer) && strcmp(buffer, "case") == 0);
+                fseek(in, pos, SEEK_SET);
 
-                fprintf(out, ".L.case.%ld.%lu:\n", switch_id, value);
                 statement(args, in, out, fn_ident, switch_id, cases);
                 return;
             }
@@ -1456,7 +3432,7 @@ static void statement(struct compiler_args *args, FILE *in, FILE *out,
 
                         // Initialize pointer.
                         fprintf(out, "  lea -%lu(%%rbp), %%rax\n", args->stack_offset * args->word_size);
-                        fprintf(out, "  movq %%rax, -%lu(%%rbp)\n", (args->stack_offset + 1) * args->word_size);
+                        fprintf(out, "  mov %s, -%lu(%%rbp)\n", word_reg(args, "%rax"), (args->stack_offset + 1) * args->word_size);
                     }
                 } while ((c) == ',');
 
@@ -1466,7 +3442,7 @@ static void statement(struct compiler_args *args, FILE *in, FILE *out,
                 }
 
                 // align stack to 16 bytes
-                if (args->stack_offset % 2) {
+                while ((args->stack_offset * args->word_size) % 16) {
                     fprintf(out, "  sub $%u, %%rsp\n", args->word_size);
                     args->stack_offset++;
                 }
@@ -1510,8 +3486,9 @@ static void statement(struct compiler_args *args, FILE *in, FILE *out,
 
 //
 // Parse a list of function arguments.
+// With on_stack, they are left in the slots where the caller pushed them.
 //
-static void arguments(struct compiler_args *args, FILE *in, FILE *out)
+static void arguments(struct compiler_args *args, FILE *in, FILE *out, bool on_stack)
 {
     int c;
     int i = 0;
@@ -1523,9 +3500,12 @@ static void arguments(struct compiler_args *args, FILE *in, FILE *out)
             eprintf(args->arg0, "expect " QUOTE_FMT(")") " or identifier after function arguments\n");
             exit(1);
         }
-        fprintf(out, "  sub $%u, %%rsp\n  mov %s, -%lu(%%rbp)\n", args->word_size, arg_registers[i++], (args->stack_offset + 2) * args->word_size);
+        if (!on_stack)
+            fprintf(out, "  sub $%u, %%rsp\n  mov %s, -%lu(%%rbp)\n", args->word_size,
+                (args->word_size == 4 ? arg_registers32 : arg_registers)[i++], (args->stack_offset + 2) * args->word_size);
 
         list_push(&args->locals, init_stack_var(strdup(buffer), args->stack_offset++));
+        args->num_params++;
 
         whitespace(args, in);
         switch (c = fgetc(in)) {
@@ -1540,13 +3520,37 @@ static void arguments(struct compiler_args *args, FILE *in, FILE *out)
     }
 }
 
+//
+// Entry of a function with the internal convention for callers
+// that pass the arguments in registers.
+//
+static void internal_stub(struct compiler_args *args, FILE *out, const struct global_sym *sym,
+                          const char *fn_id, unsigned num_params)
+{
+    unsigned i;
+
+    function_start(args, out, sym, fn_id, false);
+    for (i = 0; i < num_params; i++)
+        fprintf(out, "  push %s\n", arg_registers[i]);
+    fprintf(out, "  call %s.internal\n  add $%u, %%rsp\n  ret\n", fn_id, num_params * 8);
+}
+
 //
 // Parse a function definition.
 //
 static void function(struct compiler_args *args, FILE *in, FILE *out, char *fn_id)
 {
-    size_t i;
+    size_t i, code_len;
     int c;
+    char *code;
+    char *label = args->spec ? args->spec->label : fn_id;
+    char internal_label[BUFSIZ];
+    FILE *body;
+    struct function_code fn;
+    struct optimize_job *job;
+    struct global_sym *sym = args->whole_program ? find_global(args, fn_id, false) : NULL;
+    unsigned frame_base = 0;
+    long pos = ftell(in) - 1 - strlen(fn_id);
 
     // Clear the list of locals.
     for (i = 0; i < args->locals.size; i++)
@@ -1560,34 +3564,467 @@ static void function(struct compiler_args *args, FILE *in, FILE *out, char *fn_i
             free(args->extrns.data[i]);
     list_clear(&args->extrns);
 
+    discard_cold_code(args, 0);
+
     // Add name of the function to externals.
     list_push(&args->extrns, fn_id);
+    args->address_taken = false;
+    args->num_params = 0;
+
+    // Generate the code aside for the optimizer.
+    body = args->opt_level ? open_memstream(&code, &code_len) : out;
+
+    if (sym && sym->internal) {
+        /* the parameters are the pushed arguments above the return address and the saved %rbp */
+        frame_base = (sym->num_params + 3) * 8;
+        if (!args->spec) {
+            internal_stub(args, out, sym, fn_id, sym->num_params);
+            snprintf(internal_label, sizeof(internal_label), "%s.internal", fn_id);
+            label = internal_label;
+        }
+        function_start(args, body, sym, label, true);
+        fprintf(body,
+            "  push %%rbp\n"
+            "  lea %u(%%rsp), %%rbp\n",
+            frame_base
+        );
+    }
+    else {
+        function_start(args, body, sym, label, true);
+        fprintf(body,
+            "  push %%rbp\n"
+            "  mov %%rsp, %%rbp\n"
+            "  sub $%d, %%rsp\n",
+            args->word_size
+        );
+    }
 
-    fprintf(out,
-        ".text\n"
-        ".type %s, @function\n"
-        "%s:\n"
-        "  push %%rbp\n"
-        "  mov %%rsp, %%rbp\n"
-        "  sub $%d, %%rsp\n",
-        fn_id, fn_id, args->word_size
-    );
+    args->fn_label = label;
+    if (args->spec)
+        remark(args, pos, REMARK_PASSED, "specialize", "Cloned",
+            "clone '%s' made for the constant arguments of %u calls", label, args->spec->count);
+    else if (args->specialize && sym && sym->referenced && sym->calls.size && !sym->specs.size) {
+        if (sym->frame_escapes)
+            remark(args, pos, REMARK_MISSED, "specialize", "AddressTaken",
+                "'%s' not cloned: the address of a local is taken", fn_id);
+        else if (sym->insns > args->max_specialize_insns)
+            remark(args, pos, REMARK_MISSED, "specialize", "TooLarge",
+                "'%s' not cloned: %zu instructions exceed max-specialize-insns=%u",
+                fn_id, sym->insns, args->max_specialize_insns);
+        else
+            remark(args, pos, REMARK_MISSED, "specialize", "FewCalls",
+                "'%s' not cloned: no unassigned parameter gets the same literal from %u calls",
+                fn_id, args->specialize_min_calls);
+    }
 
     if ((c = fgetc(in)) != ')') {
         ungetc(c, in);
-        arguments(args, in, out);
+        arguments(args, in, body, frame_base != 0);
+    }
+    if (frame_base) {
+        /* skip the return address and the saved %rbp */
+        args->stack_offset += 2;
     }
 
-    statement(args, in, out, fn_id, -1, NULL);
+    statement(args, in, body, label, -1, NULL);
 
-    fprintf(out,
+    fprintf(body,
         "  xor %%rax, %%rax\n"
-        ".L.return.%s:\n"
-        "  mov %%rbp, %%rsp\n"
+        ".L.return.%s:\n",
+        label
+    );
+    if (frame_base)
+        fprintf(body, "  lea -%u(%%rbp), %%rsp\n", frame_base);
+    else
+        fprintf(body, "  mov %%rbp, %%rsp\n");
+    fprintf(body,
         "  pop %%rbp\n"
-        "  ret\n",
-        fn_id
+        "  ret\n"
     );
+    for (i = 0; i < args->cold_code.size; i++)
+        fputs(args->cold_code.data[i], body);
+    discard_cold_code(args, 0);
+    if (body == out) {
+        args->fn_label = NULL;
+        return;
+    }
+
+    fclose(body);
+    if (args->analyzing) {
+        /* remember what specialization needs to know */
+        args->current_def->is_function = true;
+        args->current_def->frame_escapes = args->address_taken;
+        args->current_def->num_params = args->num_params;
+        args->current_def->insns = count_lines(code);
+        free(code);
+        args->fn_label = NULL;
+        return;
+    }
+    if (!reports_requested(args)) {
+        /* optimized on the thread pool at the end of the file */
+        job = (struct optimize_job*) calloc(1, sizeof(struct optimize_job));
+        function_code_parse(&job->fn, strdup(label), code);
+        job->fn.address_taken = args->address_taken;
+        job->fn.pos = pos;
+        fprintf(out, JOB_PLACEHOLDER "%zu\n", args->jobs.size);
+        list_push(&args->jobs, job);
+        free(code);
+        args->fn_label = NULL;
+        return;
+    }
+    function_code_parse(&fn, label, code);
+    fn.address_taken = args->address_taken;
+    fn.pos = pos;
+    optimize_function(args, &fn);
+    function_code_write(&fn, out);
+    function_code_free(&fn);
+    free(code);
+    args->fn_label = NULL;
+}
+
+//
+// Add a clone, or the literal arguments of calls, to a cache key.
+//
+static void hash_specialization(uint64_t *key, const struct specialization *spec)
+{
+    unsigned i;
+
+    cache_hash_string(key, spec->label ? spec->label : "");
+    cache_hash_number(key, spec->mask);
+    for (i = 0; i < MAX_FN_CALL_ARGS; i++)
+        if (spec->mask & (1u << i))
+            cache_hash_number(key, spec->values[i]);
+}
+
+//
+// Add the whole-program facts about a global that the code of
+// definitions depends on to a cache key.
+//
+static void hash_global(uint64_t *key, const struct global_sym *sym)
+{
+    size_t i;
+
+    cache_hash_string(key, sym->name);
+    cache_hash_number(key, sym->is_vector | sym->modified << 1 | sym->defined << 2 |
+                           sym->referenced << 3 | sym->is_function << 4 | sym->internal << 5);
+    cache_hash_number(key, sym->num_params);
+    cache_hash_number(key, sym->order);
+    cache_hash_number(key, sym->specs.size);
+    for (i = 0; i < sym->specs.size; i++)
+        hash_specialization(key, (const struct specialization*) sym->specs.data[i]);
+}
+
+//
+// Current numbers of the labels and strings.
+//
+static void cache_counters(struct compiler_args *args, struct cache_base *base)
+{
+    base->stmts = args->stmt_id;
+    base->conds = args->cond_id;
+    base->strings = args->strings.size;
+}
+
+//
+// Apply the facts recorded by the analysis of a definition, or only
+// check them when apply is false. Return false on a damaged entry.
+//
+static bool cache_facts(struct compiler_args *args, const char *text, bool apply)
+{
+    char name[BUFSIZ];
+    int frame_escapes, len, n;
+    unsigned num_params, modified_params, i;
+    size_t insns;
+    long value;
+    struct specialization site;
+    struct global_sym *sym;
+
+    if (sscanf(text, "%d %u %u %zu\n%n", &frame_escapes, &num_params, &modified_params, &insns, &len) != 4)
+        return false;
+    if (apply) {
+        args->current_def->is_function = true;
+        args->current_def->frame_escapes = frame_escapes;
+        args->current_def->num_params = num_params;
+        args->current_def->modified_params |= modified_params;
+        args->current_def->insns = insns;
+    }
+
+    // Replay the references, assignments and calls of literals.
+    for (text += len; *text; text += len + 1) {
+        if (sscanf(text + 1, " %1023s%n", name, &len) != 1)
+            return false;
+        len++;
+        switch (*text) {
+        case 'r':
+            if (apply) {
+                sym = find_global(args, name, true);
+                list_push(&args->current_def->refs, sym);
+            }
+            break;
+        case 'm':
+            if (apply)
+                find_global(args, name, true)->modified = true;
+            break;
+        case 'e':
+            if (sscanf(text + len, " %ld%n", &value, &n) != 1)
+                return false;
+            len += n;
+            if (apply)
+                record_edge(args->current_def, find_global(args, name, true), value);
+            break;
+        case 'c':
+            memset(&site, 0, sizeof(site));
+            if (sscanf(text + len, " %u%n", &site.mask, &n) != 1)
+                return false;
+            for (len += n, i = 0; i < MAX_FN_CALL_ARGS; i++, len += n) {
+                if (sscanf(text + len, " %ld%n", &value, &n) != 1)
+                    return false;
+                site.values[i] = value;
+            }
+            if (apply)
+                record_call(&find_global(args, name, true)->calls, &site, 1);
+            break;
+        default:
+            return false;
+        }
+        if (text[len] != '\n')
+            return false;
+    }
+    return true;
+}
+
+//
+// Take the entry of a definition from the cache: add its strings,
+// advance the counters and return the rest, relabeled for where the
+// counters stand. Return NULL when the entry is missing or damaged.
+//
+static char *cache_load(struct compiler_args *args, uint64_t key, const char *kind)
+{
+    char *data, *p, *end, *result;
+    size_t size, i, len, num_strings;
+    struct cache_base base, used;
+    int n;
+
+    if (!(data = cache_read(args, key, &size)))
+        return NULL;
+    p = data;
+    if (strncmp(p, "BCAUSE-CACHE ", 13) != 0 || strncmp(p + 13, kind, strlen(kind)) != 0 ||
+        p[13 + strlen(kind)] != '\n' ||
+        sscanf(p += 14 + strlen(kind), "%lu %lu %zu %lu\n%n",
+               &used.stmts, &used.conds, &num_strings, &used.builtins, &n) != 4) {
+        free(data);
+        return NULL;
+    }
+
+    // Check the strings before adding any.
+    end = p += n;
+    for (i = 0; i < num_strings; i++) {
+        len = strtoul(end, &end, 10);
+        if (*end++ != '\n' || len > size - (end - data) || memchr(end, '\0', len) || end[len] != '\n') {
+            free(data);
+            return NULL;
+        }
+        end += len + 1;
+    }
+
+    // The facts are checked before any of them is applied.
+    if (args->analyzing && !cache_facts(args, p, false)) {
+        free(data);
+        return NULL;
+    }
+
+    cache_counters(args, &base);
+    for (i = 0; i < num_strings; i++) {
+        len = strtoul(p, &p, 10);
+        list_push(&args->strings, strndup(p + 1, len));
+        p += len + 2;
+    }
+    args->stmt_id += used.stmts;
+    args->cond_id += used.conds;
+    args->builtins_called |= used.builtins;
+
+    result = cache_relabel(p, &base, true);
+    free(data);
+    return result;
+}
+
+//
+// Entry of a definition to store when the functions of the file are
+// optimized: the counters and strings it used from base on, and its
+// text, with the functions still to be filled in.
+//
+struct cache_store {
+    uint64_t key;
+    const char *kind;
+    struct cache_base base, used;
+    char *text;
+};
+
+//
+// Store the entry of a definition, with the text relabeled to start
+// from zero.
+//
+static void cache_store(struct compiler_args *args, const struct cache_store *store, const char *text)
+{
+    char *data, *relabeled, *string;
+    size_t size, i;
+    FILE *entry = open_memstream(&data, &size);
+
+    fprintf(entry, "BCAUSE-CACHE %s\n%lu %lu %lu %lu\n", store->kind,
+        store->used.stmts, store->used.conds, store->used.strings, store->used.builtins);
+    for (i = 0; i < store->used.strings; i++) {
+        string = (char*) args->strings.data[store->base.strings + i];
+        fprintf(entry, "%zu\n%s\n", strlen(string), string);
+    }
+    relabeled = cache_relabel(text, &store->base, false);
+    fputs(relabeled, entry);
+    fclose(entry);
+    cache_write(args, store->key, data, size);
+    free(relabeled);
+    free(data);
+}
+
+//
+// Parse a function definition, taking its code from the cache when
+// neither its text nor the facts its code depends on have changed.
+// The analysis pass caches the facts it collects instead.
+//
+static void cached_function(struct compiler_args *args, FILE *in, FILE *out, char *fn_id)
+{
+    uint64_t key = CACHE_KEY_INIT;
+    long pos = ftell(in), end;
+    struct global_sym *sym = args->whole_program ? find_global(args, fn_id, false) : NULL;
+    const char *kind = args->analyzing ? "facts" : "code";
+    struct cache_store *store;
+    char *text, *events;
+    size_t i, size, events_size;
+    unsigned called;
+    FILE *buffer;
+
+    // Unused definitions are discarded, they need no cache.
+    if (!cache_enabled(args) || !definition_used(args, fn_id)) {
+        function(args, in, out, fn_id);
+        return;
+    }
+    cache_hash_options(&key, args);
+    cache_hash_string(&key, fn_id);
+    if (!cache_scan_function(in, pos, &end, &key)) {
+        function(args, in, out, fn_id);
+        return;
+    }
+    if (sym) {
+        hash_global(&key, sym);
+        for (i = 0; i < sym->refs.size; i++)
+            hash_global(&key, (const struct global_sym*) sym->refs.data[i]);
+    }
+    else
+        cache_hash_number(&key, args->builtins_defined);
+    if (args->spec)
+        hash_specialization(&key, args->spec);
+
+    if ((text = cache_load(args, key, kind))) {
+        if (args->analyzing)
+            cache_facts(args, text, true);
+        else
+            fputs(text, out);
+        free(text);
+        fseek(in, end, SEEK_SET);
+        return;
+    }
+
+    // Compile the definition aside, and store what it produced
+    // when its functions are optimized.
+    store = (struct cache_store*) calloc(1, sizeof(struct cache_store));
+    store->key = key;
+    store->kind = kind;
+    cache_counters(args, &store->base);
+    buffer = open_memstream(&text, &size);
+    called = args->builtins_called;
+    args->builtins_called = 0;
+    if (args->analyzing) {
+        args->cache_record = open_memstream(&events, &events_size);
+        function(args, in, out, fn_id);
+        fclose(args->cache_record);
+        args->cache_record = NULL;
+        fprintf(buffer, "%d %u %u %zu\n%s", args->current_def->frame_escapes,
+            args->current_def->num_params, args->current_def->modified_params,
+            args->current_def->insns, events);
+        free(events);
+    }
+    else
+        function(args, in, buffer, fn_id);
+    fclose(buffer);
+
+    cache_counters(args, &store->used);
+    store->used.builtins = args->builtins_called;
+    args->builtins_called |= called;
+    store->used.stmts -= store->base.stmts;
+    store->used.conds -= store->base.conds;
+    store->used.strings -= store->base.strings;
+    store->text = text;
+    list_push(&args->cache_stores, store);
+    if (!args->analyzing)
+        fputs(text, out);
+}
+
+//
+// Write the code of a file, with the optimized functions in place of
+// their placeholders.
+//
+static void write_jobs(struct compiler_args *args, const char *text, FILE *out)
+{
+    const char *end;
+    struct optimize_job *job;
+
+    while (*text) {
+        if (!(end = strchr(text, '\n')))
+            end = text + strlen(text);
+        else
+            end++;
+        if (strncmp(text, JOB_PLACEHOLDER, strlen(JOB_PLACEHOLDER)) == 0) {
+            job = (struct optimize_job*) args->jobs.data[strtoul(text + strlen(JOB_PLACEHOLDER), NULL, 10)];
+            fwrite(job->text, 1, job->text_len, out);
+        }
+        else
+            fwrite(text, 1, end - text, out);
+        text = end;
+    }
+}
+
+//
+// Optimize the functions of a file on the thread pool and write the
+// code of the file, in source order. Then store the cache entries of
+// its definitions, which are complete now.
+//
+static void finish_jobs(struct compiler_args *args, const char *text, FILE *out)
+{
+    size_t i, size;
+    char *code;
+    FILE *buffer;
+    struct cache_store *store;
+    struct optimize_job *job;
+
+    optimize_jobs(args, &args->jobs);
+    write_jobs(args, text, out);
+
+    for (i = 0; i < args->cache_stores.size; i++) {
+        store = (struct cache_store*) args->cache_stores.data[i];
+        buffer = open_memstream(&code, &size);
+        write_jobs(args, store->text, buffer);
+        fclose(buffer);
+        cache_store(args, store, code);
+        free(code);
+        free(store->text);
+        free(store);
+    }
+    list_free(&args->cache_stores);
+
+    for (i = 0; i < args->jobs.size; i++) {
+        job = (struct optimize_job*) args->jobs.data[i];
+        free((char*) job->fn.name);
+        free(job->text);
+        free(job);
+    }
+    list_free(&args->jobs);
 }
 
 //
@@ -1624,19 +4061,59 @@ static void strings(struct compiler_args *args, FILE *out)
 static void declarations(struct compiler_args *args, FILE *in, FILE *out)
 {
     static char buffer[BUFSIZ];
-    int c;
+    int c, b;
     size_t i;
+    long pos;
+    char *text;
+    size_t text_len;
+    FILE *null = NULL, *def_out;
+    FILE *code = open_memstream(&text, &text_len);
+    struct global_sym *sym;
 
     while (identifier(args, in, buffer)) {
-        fprintf(out, ".globl %s\n", buffer);
+        if (args->analyzing) {
+            args->current_def = find_global(args, buffer, true);
+            args->current_def->defined = true;
+        }
+
+        def_out = code;
+        if (!definition_used(args, buffer)) {
+            /* parse the unused definition, but discard its code */
+            if (!null && !(null = fopen("/dev/null", "w"))) {
+                eprintf(args->arg0, "cannot open file " QUOTE_FMT("/dev/null") " %s.", strerror(errno));
+                exit(1);
+            }
+            def_out = null;
+        }
+        fprintf(def_out, ".globl %s\n", buffer);
 
         switch (c = fgetc(in)) {
         case '(':
-            function(args, in, out, buffer);
+            pos = ftell(in);
+            if ((b = find_builtin(buffer)) >= 0 && !args->whole_program && !args->analyzing) {
+                if (args->builtins_called & 1u << b) {
+                    eprintf(args->arg0, "function " QUOTE_FMT("%s") " is defined after calls compiled as the builtin; "
+                        "declare it " QUOTE_FMT("extrn") " where it is called\n", buffer);
+                    exit(1);
+                }
+                args->builtins_defined |= 1u << b;
+            }
+            if (args->stack_usage && !args->analyzing && def_out != null)
+                stack_site(args, buffer, pos - 1 - strlen(buffer));
+            cached_function(args, in, def_out, buffer);
+
+            // Generate the clones from the same source text.
+            sym = args->whole_program ? find_global(args, buffer, false) : NULL;
+            for (i = 0; sym && i < sym->specs.size; i++) {
+                fseek(in, pos, SEEK_SET);
+                args->spec = (struct specialization*) sym->specs.data[i];
+                cached_function(args, in, def_out, buffer);
+            }
+            args->spec = NULL;
             break;
 
         case '[':
-            vector(args, in, out, buffer);
+            vector(args, in, def_out, buffer);
             break;
 
         case EOF:
@@ -1645,15 +4122,21 @@ static void declarations(struct compiler_args *args, FILE *in, FILE *out)
 
         default:
             ungetc(c, in);
-            global(args, in, out, buffer);
+            global(args, in, def_out, buffer);
         }
     }
+    args->current_def = NULL;
+    if (null)
+        fclose(null);
 
     if (fgetc(in) != EOF) {
         eprintf(args->arg0, "expect identifier at top level\n");
         exit(1);
     }
 
+    fclose(code);
+    finish_jobs(args, text, out);
+    free(text);
     strings(args, out);
 
     // Clear the list of locals.
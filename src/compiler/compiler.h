@@ -1,7 +1,9 @@
 #ifndef BCAUSE_COMPILER_H
 #define BCAUSE_COMPILER_H
 
+#include <stdio.h>
 #include <stdbool.h>
+#include <regex.h>
 #include "list.h"
 
 #define A_OUT "a.out"
@@ -11,10 +13,20 @@
 #define COLOR_RESET      "\033[0m"
 #define COLOR_BOLD_RED   "\033[1m\033[31m"
 #define COLOR_BOLD_WHITE "\033[1m\033[37m"
+#define COLOR_BOLD_BLUE  "\033[1m\033[34m"
 
 #define QUOTE_FMT(str) COLOR_BOLD_WHITE "‘" str "’" COLOR_RESET
 
 #define X86_64_WORD_SIZE sizeof(intptr_t)
+#define X86_64_WORD32_SIZE 4 /* 32-bit words, addresses kept below 2 GB */
+
+struct global_sym;
+struct specialization;
+
+enum remark_kind {
+    REMARK_PASSED,  /* an optimization was done */
+    REMARK_MISSED,  /* an optimization was not done, with the reason */
+};
 
 struct compiler_args {
     const char *arg0; /* name of the executable */
@@ -24,16 +36,78 @@ struct compiler_args {
     int num_input_files; /* number of input files */
 
     unsigned char word_size; /* size of the B data type */
+    bool popcnt;        /* the processor has popcnt */
+    bool lzcnt;         /* the processor has lzcnt */
+    bool bmi;           /* the processor has tzcnt */
 
     bool do_linking;    /* should the compiler link? */
     bool do_assembling; /* should the compiler assemble? */
     bool save_temps;    /* should temporary files get deleted? */
+    bool emit_bytecode; /* write bytecode instead of assembling */
+    bool interpret;     /* run the program with the bytecode interpreter */
+    bool jit;           /* compile hot functions to native code while interpreting */
+    unsigned jit_threshold; /* calls and loop iterations making a function hot */
+
+    int opt_level;      /* optimization level, 0 to 2 */
+    const char *print_after; /* dump the code after this optimization pass */
+    bool omit_frame_pointer; /* address locals from %rsp */
+    bool unroll_loops;  /* unroll counted while loops */
+    unsigned unroll_factor; /* copies of an unrolled loop body */
+    unsigned max_unrolled_insns; /* size limit of an unrolled loop */
+    bool specialize;    /* clone functions for constant call arguments */
+    unsigned max_specializations; /* clones per function */
+    unsigned specialize_min_calls; /* call sites needed to create a clone */
+    unsigned max_specialize_insns; /* size limit of a cloned function */
+    bool internal_calls; /* leave arguments on the stack for functions of the program */
+    bool reorder_functions; /* lay out the functions of the program by call-graph affinity */
+    unsigned align_functions; /* alignment of function entries in bytes, 0 for none */
+    unsigned align_loops; /* alignment of loop heads in bytes, 0 for none */
+    bool huge_pages;    /* back the text and big data of the program by huge pages */
+    unsigned threads;   /* threads optimizing the functions of a file, 0 for one per processor */
+    struct list jobs;   /* functions of the file waiting for the optimizer */
+    regex_t *rpass;     /* print remarks of optimizations done by matching passes */
+    regex_t *rpass_missed; /* print remarks of optimizations missed by matching passes */
+    bool save_remarks;  /* write all remarks to <output>.opt.yaml */
+    FILE *remarks_out;  /* the optimization record */
+    char **remarks;     /* remarks reported so far, a hash set */
+    size_t remarks_size, num_remarks; /* slots of the set, and the remarks in it */
+    bool stack_usage;   /* write the stack usage of every function to <output>.su */
+    struct list stack_sites; /* definitions of the functions, for the stack usage report */
+    bool stack_bound;   /* combine stack usage reports along the call graph */
+    const char *source_file; /* input file being translated */
+    long *line_starts;  /* offsets of its lines, read when a location is first needed */
+    size_t num_lines;
+    const char *fn_label; /* function being generated */
 
     struct list locals; /* local variables */
     unsigned long stack_offset; /* local variable offset */
     struct list extrns; /* extrn variables */
 
     struct list strings; /* string table */
+    size_t stmt_id;     /* labels of statements numbered so far */
+    size_t cond_id;     /* labels of conditional expressions numbered so far */
+    unsigned expr_flags; /* properties of the expression being generated */
+    int branch_hint;    /* 1 after likely(), -1 after unlikely(), else 0 */
+    long hint_start, hint_end; /* source range of the last likely() or unlikely() */
+    struct list cold_code; /* rarely run blocks, placed after the function */
+    unsigned builtins_called; /* builtins compiled so far, a bit each */
+    unsigned builtins_defined; /* builtins whose name a function of the program has */
+
+    bool analyzing;     /* is this the whole-program analysis pass? */
+    bool whole_program; /* are whole-program facts available? */
+    struct list globals; /* whole-program symbol table */
+    struct global_sym *lvalue_sym; /* global whose address is in %rax */
+    struct global_sym *current_def; /* global being defined */
+
+    unsigned long lvalue_slot; /* frame offset of the local whose address is in %rax */
+    bool address_taken; /* has the address of a local escaped in this function? */
+    unsigned num_params; /* parameters of the function being generated */
+    unsigned loop_depth; /* loops around the code being parsed */
+    struct specialization *spec; /* clone being generated, or NULL */
+
+    const char *cache_dir; /* reuse the code of unchanged functions from this directory */
+    FILE *cache_record; /* facts of the definition being analyzed, for the cache */
+    struct list cache_stores; /* entries stored once the functions of the file are optimized */
 };
 
 #ifdef __GNUC__
@@ -41,6 +115,13 @@ __attribute((format(printf, 2, 3)))
 #endif
 void eprintf(const char *arg0, const char *fmt, ...);
 
+#ifdef __GNUC__
+__attribute((format(printf, 6, 7)))
+#endif
+void remark(struct compiler_args *args, long pos, enum remark_kind kind,
+            const char *pass, const char *name, const char *fmt, ...);
+
+bool reports_requested(const struct compiler_args *args);
 int compile(struct compiler_args *args);
 
 #endif
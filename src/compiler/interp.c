@@ -0,0 +1,698 @@
+#define _DEFAULT_SOURCE
+#include "interp.h"
+#include "compiler.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+
+#ifndef __GNUC__
+    #error "the interpreter needs labels as values (GNU C)"
+#endif
+
+/* size of the stack interpreted programs run on */
+#define STACK_SIZE (8L << 20)
+
+/* space kept free below the stack pointer at each call */
+#define STACK_RESERVE 4096
+
+/* unmapped page below the stack, stopping native code running out of it */
+#define GUARD_SIZE 4096
+
+__extension__ typedef __int128 int128_t;
+__extension__ typedef unsigned __int128 uint128_t;
+
+//
+// Handlers of superinstructions: two or three instructions frequent
+// in generated code, executed with one dispatch. The instructions keep
+// their places after the first one, so jumps into the middle of a
+// superinstruction still work.
+//
+#define SUPERINSTRUCTIONS(X) \
+    X(LOAD_PUSH,     BC_LOAD,    BC_PUSH_R) \
+    X(MOVI_PUSH,     BC_MOV_RI,  BC_PUSH_R) \
+    X(LEA_PUSH,      BC_LEA,     BC_PUSH_R) \
+    X(POP_ADD,       BC_POP_R,   BC_ADD_RR) \
+    X(POP_CMP,       BC_POP_R,   BC_CMP_RR) \
+    X(POP_STORE,     BC_POP_R,   BC_STORE)  \
+    X(PUSH_LOAD,     BC_PUSH_R,  BC_LOAD)   \
+    X(MOVI_POP,      BC_MOV_RI,  BC_POP_R)  \
+    X(LOAD_LOAD,     BC_LOAD,    BC_LOAD)
+
+#define CONDITIONAL_SUPERINSTRUCTIONS(X) \
+    X(CMPI_J,  BC_CMP_RI,  BC_JCC) \
+    X(CMP_J,   BC_CMP_RR,  BC_JCC) \
+    X(TEST_J,  BC_TEST_RR, BC_JCC) \
+    X(SET_MOVZB, BC_SETCC, BC_MOVZB)
+
+enum handler {
+#define HANDLER_ENUM(name) H_##name,
+    BC_OPCODES(HANDLER_ENUM)
+#undef HANDLER_ENUM
+    H_CALL_NATIVE,
+    H_HALT,
+    H_FALL_OFF,
+    H_LOAD_ADD_STORE,
+    H_CALL_COUNT,
+    H_CALL_R_COUNT,
+    H_JMP_BACK,
+    H_ENTER_NATIVE,
+#define SUPER_ENUM(name, first, second) H_##name,
+    SUPERINSTRUCTIONS(SUPER_ENUM)
+#undef SUPER_ENUM
+#define COND_ENUM(cond, type, op) H_J##cond, H_J##cond##_BACK, H_SET##cond, H_CMOV##cond, \
+    H_CMPI_J##cond, H_CMP_J##cond, H_TEST_J##cond, H_SET_MOVZB##cond,
+    BC_CONDITIONS(COND_ENUM)
+#undef COND_ENUM
+    NUM_HANDLERS,
+};
+
+static const struct {
+    enum bc_opcode first, second;
+    enum handler handler;
+} superinstructions[] = {
+#define SUPER_PAIR(name, first, second) { first, second, H_##name },
+    SUPERINSTRUCTIONS(SUPER_PAIR)
+#undef SUPER_PAIR
+};
+
+static const struct {
+    enum bc_opcode first, second;
+    enum handler handlers[BC_NUM_CONDITIONS];
+} conditional_superinstructions[] = {
+#define COND_HANDLER_CMPI_J(cond, type, op) H_CMPI_J##cond,
+#define COND_HANDLER_CMP_J(cond, type, op) H_CMP_J##cond,
+#define COND_HANDLER_TEST_J(cond, type, op) H_TEST_J##cond,
+#define COND_HANDLER_SET_MOVZB(cond, type, op) H_SET_MOVZB##cond,
+#define COND_SUPER_PAIR(name, first, second) \
+    { first, second, { BC_CONDITIONS(COND_HANDLER_##name) } },
+    CONDITIONAL_SUPERINSTRUCTIONS(COND_SUPER_PAIR)
+#undef COND_SUPER_PAIR
+};
+
+static const enum handler jcc_handlers[] = {
+#define COND_HANDLER_J(cond, type, op) H_J##cond,
+    BC_CONDITIONS(COND_HANDLER_J)
+};
+
+static const enum handler jcc_back_handlers[] = {
+#define COND_HANDLER_J_BACK(cond, type, op) H_J##cond##_BACK,
+    BC_CONDITIONS(COND_HANDLER_J_BACK)
+};
+
+static const enum handler setcc_handlers[] = {
+#define COND_HANDLER_SET(cond, type, op) H_SET##cond,
+    BC_CONDITIONS(COND_HANDLER_SET)
+};
+
+static const enum handler cmovcc_handlers[] = {
+#define COND_HANDLER_CMOV(cond, type, op) H_CMOV##cond,
+    BC_CONDITIONS(COND_HANDLER_CMOV)
+};
+
+#define REG(r)      R[BC_##r]
+#define EA(i)       (R[(i)->base] + R[(i)->index] * (i)->scale + (i)->disp)
+#define MEM(i)      (*(uint64_t*) (uintptr_t) EA(i))
+#define PUSH(value) (REG(RSP) -= 8, *(uint64_t*) (uintptr_t) REG(RSP) = (value))
+#define POP()       (REG(RSP) += 8, *(uint64_t*) (uintptr_t) (REG(RSP) - 8))
+#define DISPATCH()  __extension__ ({ goto *p->handler; })
+#define NEXT(n)     do { p += (n); DISPATCH(); } while (0)
+
+/* count a call or loop iteration of a function, queue it once hot */
+#define COUNT(f) do { \
+        if (++m->functions[f].count == m->args->jit_threshold) \
+            jit_hot(m, f); \
+    } while (0)
+
+//
+// Execute a program from the given instruction up to a halt, with
+// the registers passed in and out through regs. Runtime errors end
+// the process. Called without a machine, return the table of handlers.
+//
+static void execute(struct machine *m, struct insn *p, uint64_t *regs, const void *const **table)
+{
+    static const void *const handlers[NUM_HANDLERS] = {
+#define HANDLER_ADDRESS(name) [H_##name] = __extension__ &&op_##name,
+        BC_OPCODES(HANDLER_ADDRESS)
+        HANDLER_ADDRESS(CALL_NATIVE)
+        HANDLER_ADDRESS(HALT)
+        HANDLER_ADDRESS(FALL_OFF)
+        HANDLER_ADDRESS(LOAD_ADD_STORE)
+        HANDLER_ADDRESS(CALL_COUNT)
+        HANDLER_ADDRESS(CALL_R_COUNT)
+        HANDLER_ADDRESS(JMP_BACK)
+        HANDLER_ADDRESS(ENTER_NATIVE)
+#define SUPER_ADDRESS(name, first, second) HANDLER_ADDRESS(name)
+        SUPERINSTRUCTIONS(SUPER_ADDRESS)
+#undef SUPER_ADDRESS
+#define COND_ADDRESS(cond, type, op) \
+        HANDLER_ADDRESS(J##cond) HANDLER_ADDRESS(J##cond##_BACK) HANDLER_ADDRESS(SET##cond) HANDLER_ADDRESS(CMOV##cond) \
+        HANDLER_ADDRESS(CMPI_J##cond) HANDLER_ADDRESS(CMP_J##cond) \
+        HANDLER_ADDRESS(TEST_J##cond) HANDLER_ADDRESS(SET_MOVZB##cond)
+        BC_CONDITIONS(COND_ADDRESS)
+#undef COND_ADDRESS
+#undef HANDLER_ADDRESS
+    };
+    uint64_t R[BC_NUM_REGISTERS], saved[BC_NUM_REGISTERS];
+    uint64_t fa = 0, fb = 0, value; /* flags: operands of the last comparison */
+    const struct bc_native *native;
+    int128_t dividend;
+    int64_t divisor;
+    uint64_t stack_limit;
+
+    if (!m) {
+        *table = handlers;
+        return;
+    }
+    memcpy(R, regs, sizeof(R));
+    stack_limit = (uintptr_t) m->stack + STACK_RESERVE;
+    DISPATCH();
+
+op_MOV_RR:  R[p->dst] = R[p->src];                  NEXT(1);
+op_MOV_RI:  R[p->dst] = p->imm;                     NEXT(1);
+op_LOAD:    R[p->dst] = MEM(p);                     NEXT(1);
+op_LOADS32: R[p->dst] = *(int32_t*) (uintptr_t) EA(p); NEXT(1);
+op_STORE:   MEM(p) = R[p->src];                     NEXT(1);
+op_STORE_I: MEM(p) = p->imm;                        NEXT(1);
+op_LEA:     R[p->dst] = EA(p);                      NEXT(1);
+op_MOVZB:   R[p->dst] = R[p->src] & 0xff;           NEXT(1);
+
+#define ALU(name, op) \
+op_##name##_RR: R[p->dst] op R[p->src];             NEXT(1); \
+op_##name##_RI: R[p->dst] op p->imm;                NEXT(1); \
+op_##name##_RM: R[p->dst] op MEM(p);                NEXT(1);
+#define ALU_MEM(name, op) \
+op_##name##_MR: MEM(p) op R[p->src];                NEXT(1); \
+op_##name##_MI: MEM(p) op p->imm;                   NEXT(1);
+    ALU(ADD, +=)  ALU_MEM(ADD, +=)
+    ALU(SUB, -=)  ALU_MEM(SUB, -=)
+    ALU(AND, &=)  ALU_MEM(AND, &=)
+    ALU(OR, |=)   ALU_MEM(OR, |=)
+    ALU(XOR, ^=)  ALU_MEM(XOR, ^=)
+    ALU(IMUL, *=)
+#undef ALU
+#undef ALU_MEM
+
+op_CMP_RR:  fa = R[p->dst]; fb = R[p->src];         NEXT(1);
+op_CMP_RI:  fa = R[p->dst]; fb = p->imm;            NEXT(1);
+op_CMP_RM:  fa = R[p->dst]; fb = MEM(p);            NEXT(1);
+op_CMP_MR:  fa = MEM(p); fb = R[p->src];            NEXT(1);
+op_CMP_MI:  fa = MEM(p); fb = p->imm;               NEXT(1);
+op_TEST_RR: fa = R[p->dst] & R[p->src]; fb = 0;     NEXT(1);
+op_TEST_RI: fa = R[p->dst] & p->imm; fb = 0;        NEXT(1);
+op_BT_RR:   fa = 0; fb = R[p->dst] >> (R[p->src] & 63) & 1; NEXT(1);
+op_BT_RI:   fa = 0; fb = R[p->dst] >> (p->imm & 63) & 1;    NEXT(1);
+
+op_SHL_RI:  R[p->dst] <<= p->imm & 63;              NEXT(1);
+op_SHL_RC:  R[p->dst] <<= REG(RCX) & 63;            NEXT(1);
+op_SAR_RI:  R[p->dst] = (int64_t) R[p->dst] >> (p->imm & 63); NEXT(1);
+op_SAR_RC:  R[p->dst] = (int64_t) R[p->dst] >> (REG(RCX) & 63); NEXT(1);
+op_SHR_RI:  R[p->dst] >>= p->imm & 63;              NEXT(1);
+op_SHR_RC:  R[p->dst] >>= REG(RCX) & 63;            NEXT(1);
+op_ROL_RI:  value = p->imm & 63; R[p->dst] = R[p->dst] << value | R[p->dst] >> (-value & 63); NEXT(1);
+op_ROL_RC:  value = REG(RCX) & 63; R[p->dst] = R[p->dst] << value | R[p->dst] >> (-value & 63); NEXT(1);
+op_NEG:     R[p->dst] = -R[p->dst];                 NEXT(1);
+op_NOT:     R[p->dst] = ~R[p->dst];                 NEXT(1);
+op_POPCNT:  R[p->dst] = __builtin_popcountll(R[p->src]); NEXT(1);
+op_LZCNT:   R[p->dst] = R[p->src] ? __builtin_clzll(R[p->src]) : 64; NEXT(1);
+op_TZCNT:   R[p->dst] = R[p->src] ? __builtin_ctzll(R[p->src]) : 64; NEXT(1);
+op_BSR:     fa = R[p->src]; fb = 0; if (fa) R[p->dst] = 63 - __builtin_clzll(fa); NEXT(1);
+op_BSF:     fa = R[p->src]; fb = 0; if (fa) R[p->dst] = __builtin_ctzll(fa); NEXT(1);
+op_BSWAP:   R[p->dst] = __builtin_bswap64(R[p->dst]); NEXT(1);
+op_CQO:     REG(RDX) = (int64_t) REG(RAX) < 0 ? ~(uint64_t) 0 : 0; NEXT(1);
+
+op_IMUL1:
+    dividend = (int128_t) (int64_t) REG(RAX) * (int64_t) R[p->src];
+    REG(RAX) = (uint64_t) dividend;
+    REG(RDX) = (uint64_t) (dividend >> 64);
+    NEXT(1);
+
+op_MUL1:
+    value = REG(RAX);
+    REG(RAX) = value * R[p->src];
+    REG(RDX) = (uint64_t) ((uint128_t) value * R[p->src] >> 64);
+    NEXT(1);
+
+op_IDIV:
+    divisor = R[p->src];
+    if (REG(RDX) == (uint64_t) ((int64_t) REG(RAX) >> 63)) {
+        /* the dividend fits into %rax */
+        if (divisor == 0 || (divisor == -1 && REG(RAX) == (uint64_t) INT64_MIN))
+            goto divide_error;
+        value = (int64_t) REG(RAX) / divisor;
+        REG(RDX) = (int64_t) REG(RAX) % divisor;
+        REG(RAX) = value;
+        NEXT(1);
+    }
+    dividend = (int128_t) ((uint128_t) REG(RDX) << 64 | REG(RAX));
+    if (divisor == 0 || dividend / divisor > INT64_MAX || dividend / divisor < INT64_MIN)
+        goto divide_error;
+    REG(RAX) = (uint64_t) (dividend / divisor);
+    REG(RDX) = (uint64_t) (dividend % divisor);
+    NEXT(1);
+
+op_PUSH_R:  value = R[p->src]; PUSH(value);         NEXT(1);
+op_PUSH_I:  PUSH(p->imm);                           NEXT(1);
+op_PUSH_M:  value = MEM(p); PUSH(value);            NEXT(1);
+op_POP_R:   value = POP(); R[p->dst] = value;       NEXT(1);
+
+op_JMP:
+    p = p->target;
+    DISPATCH();
+
+op_CALL:
+    if (REG(RSP) < stack_limit)
+        goto stack_overflow;
+    PUSH((uintptr_t) (p + 1));
+    p = p->target;
+    DISPATCH();
+
+op_CALL_R:
+    value = R[p->src];
+    if (value >= (uintptr_t) m->code && value < (uintptr_t) (m->code + m->code_len) &&
+        (value - (uintptr_t) m->code) % sizeof(struct insn) == 0) {
+        if (REG(RSP) < stack_limit)
+            goto stack_overflow;
+        PUSH((uintptr_t) (p + 1));
+        p = (struct insn*) (uintptr_t) value;
+        DISPATCH();
+    }
+    native = (const struct bc_native*) (uintptr_t) value;
+    if (native < bc_natives || native >= bc_natives + bc_num_natives ||
+        (value - (uintptr_t) bc_natives) % sizeof(struct bc_native) != 0) {
+        eprintf(m->args->arg0, "call of an invalid address 0x%lx\n", (unsigned long) value);
+        exit(1);
+    }
+    REG(RAX) = native->fn(REG(RDI), REG(RSI), REG(RDX), REG(RCX), REG(R8), REG(R9));
+    NEXT(1);
+
+op_CALL_NATIVE:
+    REG(RAX) = bc_natives[p->imm].fn(REG(RDI), REG(RSI), REG(RDX), REG(RCX), REG(R8), REG(R9));
+    NEXT(1);
+
+op_RET:
+    p = (struct insn*) (uintptr_t) POP();
+    DISPATCH();
+
+op_HALT:
+    memcpy(regs, R, sizeof(R));
+    return;
+
+op_FALL_OFF:
+    eprintf(m->args->arg0, "execution ran past the end of the program\n");
+    exit(1);
+
+op_CALL_COUNT:
+    COUNT(p->target->function);
+    goto op_CALL;
+
+op_CALL_R_COUNT:
+    value = R[p->src];
+    if (value >= (uintptr_t) m->code && value < (uintptr_t) (m->code + m->code_len) &&
+        (value - (uintptr_t) m->code) % sizeof(struct insn) == 0)
+        COUNT(((struct insn*) (uintptr_t) value)->function);
+    goto op_CALL_R;
+
+op_JMP_BACK:
+    COUNT(p->function);
+    p = p->target;
+    DISPATCH();
+
+op_ENTER_NATIVE:
+    /* the native code returns to jit_call, and the interpreter goes on at the caller */
+    value = POP();
+    memcpy(saved, R, sizeof(R));
+    jit_call(m, p->function, saved);
+    memcpy(R, saved, sizeof(R));
+    p = (struct insn*) (uintptr_t) value;
+    DISPATCH();
+
+#define COND_HANDLERS(cond, type, op) \
+op_J##cond: \
+    p = (type) fa op (type) fb ? p->target : p + 1; \
+    DISPATCH(); \
+op_J##cond##_BACK: \
+    if (!((type) fa op (type) fb)) \
+        NEXT(1); \
+    COUNT(p->function); \
+    p = p->target; \
+    DISPATCH(); \
+op_SET##cond: \
+    R[p->dst] = (R[p->dst] & ~(uint64_t) 0xff) | ((type) fa op (type) fb); \
+    NEXT(1); \
+op_CMOV##cond: \
+    if ((type) fa op (type) fb) \
+        R[p->dst] = R[p->src]; \
+    NEXT(1); \
+op_CMPI_J##cond: \
+    fa = R[p->dst]; fb = p->imm; \
+    p = (type) fa op (type) fb ? p[1].target : p + 2; \
+    DISPATCH(); \
+op_CMP_J##cond: \
+    fa = R[p->dst]; fb = R[p->src]; \
+    p = (type) fa op (type) fb ? p[1].target : p + 2; \
+    DISPATCH(); \
+op_TEST_J##cond: \
+    fa = R[p->dst] & R[p->src]; fb = 0; \
+    p = (type) fa op (type) fb ? p[1].target : p + 2; \
+    DISPATCH(); \
+op_SET_MOVZB##cond: \
+    R[p->dst] = (R[p->dst] & ~(uint64_t) 0xff) | ((type) fa op (type) fb); \
+    R[p[1].dst] = R[p[1].src] & 0xff; \
+    NEXT(2);
+    BC_CONDITIONS(COND_HANDLERS)
+#undef COND_HANDLERS
+
+op_LOAD_PUSH:
+    R[p->dst] = MEM(p);
+    value = R[p[1].src]; PUSH(value);
+    NEXT(2);
+op_MOVI_PUSH:
+    R[p->dst] = p->imm;
+    value = R[p[1].src]; PUSH(value);
+    NEXT(2);
+op_LEA_PUSH:
+    R[p->dst] = EA(p);
+    value = R[p[1].src]; PUSH(value);
+    NEXT(2);
+op_POP_ADD:
+    value = POP(); R[p->dst] = value;
+    R[p[1].dst] += R[p[1].src];
+    NEXT(2);
+op_POP_CMP:
+    value = POP(); R[p->dst] = value;
+    fa = R[p[1].dst]; fb = R[p[1].src];
+    NEXT(2);
+op_POP_STORE:
+    value = POP(); R[p->dst] = value;
+    MEM(&p[1]) = R[p[1].src];
+    NEXT(2);
+op_PUSH_LOAD:
+    value = R[p->src]; PUSH(value);
+    R[p[1].dst] = MEM(&p[1]);
+    NEXT(2);
+op_MOVI_POP:
+    R[p->dst] = p->imm;
+    value = POP(); R[p[1].dst] = value;
+    NEXT(2);
+op_LOAD_LOAD:
+    R[p->dst] = MEM(p);
+    R[p[1].dst] = MEM(&p[1]);
+    NEXT(2);
+op_LOAD_ADD_STORE:
+    R[p->dst] = MEM(p);
+    R[p[1].dst] += p[1].imm;
+    MEM(&p[2]) = R[p[2].src];
+    NEXT(3);
+
+divide_error:
+    eprintf(m->args->arg0, "division error\n");
+    exit(1);
+
+stack_overflow:
+    eprintf(m->args->arg0, "stack overflow\n");
+    exit(1);
+}
+
+//
+// Run code of a loaded program up to a halt. The JIT calls this
+// for functions not compiled yet.
+//
+void interp_run(struct machine *m, struct insn *entry, uint64_t *regs)
+{
+    execute(m, entry, regs, NULL);
+}
+
+//
+// Find the native function of an undefined symbol.
+//
+static const struct bc_native *find_native(const char *name)
+{
+    size_t i;
+
+    for (i = 0; i < bc_num_natives; i++) {
+        if (strcmp(bc_natives[i].name, name) == 0)
+            return &bc_natives[i];
+    }
+    return NULL;
+}
+
+//
+// Get the address of a symbol in the loaded program.
+//
+static bool address(struct machine *m, const struct bc_program *prog, int32_t index, uint64_t *addr)
+{
+    const struct bc_symbol *sym = prog->symbols.data[index];
+    const struct bc_native *native;
+
+    switch (sym->section) {
+    case BC_TEXT:
+        *addr = (uintptr_t) &m->code[sym->value];
+        return true;
+    case BC_DATA:
+        *addr = (uintptr_t) (m->data + sym->value);
+        return true;
+    default:
+        if ((native = find_native(sym->name))) {
+            *addr = (uintptr_t) native;
+            return true;
+        }
+        eprintf(m->args->arg0, "undefined reference to " QUOTE_FMT("%s") "\n", sym->name);
+        return false;
+    }
+}
+
+//
+// Choose the handler of an instruction.
+//
+static enum handler handler(const struct bc_insn *insn)
+{
+    switch (insn->op) {
+    case BC_JCC:
+        return jcc_handlers[insn->cond];
+    case BC_SETCC:
+        return setcc_handlers[insn->cond];
+    case BC_CMOVCC:
+        return cmovcc_handlers[insn->cond];
+    default:
+        return (enum handler) insn->op;
+    }
+}
+
+//
+// Replace the handlers of instruction sequences having
+// a superinstruction.
+//
+static void combine(struct machine *m, const struct bc_program *prog, const void *const *handlers)
+{
+    const struct bc_insn *a, *b, *c;
+    size_t i, j;
+
+    for (i = 0; i + 1 < prog->code_len; i++) {
+        a = &prog->code[i];
+        b = &prog->code[i + 1];
+
+        /* load, add and store back: x =+ n */
+        if (i + 2 < prog->code_len && a->op == BC_LOAD && b->op == BC_ADD_RI) {
+            c = &prog->code[i + 2];
+            if (c->op == BC_STORE && c->src == b->dst && b->dst == a->dst &&
+                c->base == a->base && c->index == a->index && c->scale == a->scale &&
+                c->disp == a->disp && c->sym == a->sym) {
+                m->code[i].handler = handlers[H_LOAD_ADD_STORE];
+                continue;
+            }
+        }
+
+        for (j = 0; j < sizeof(superinstructions) / sizeof(superinstructions[0]); j++) {
+            if (a->op == superinstructions[j].first && b->op == superinstructions[j].second) {
+                m->code[i].handler = handlers[superinstructions[j].handler];
+                break;
+            }
+        }
+        /* keep the count of loop iterations in tiered execution */
+        if (m->args->jit && b->op == BC_JCC && m->code[i + 1].target <= &m->code[i + 1])
+            continue;
+        for (j = 0; j < sizeof(conditional_superinstructions) / sizeof(conditional_superinstructions[0]); j++) {
+            if (a->op == conditional_superinstructions[j].first &&
+                b->op == conditional_superinstructions[j].second) {
+                m->code[i].handler = handlers[conditional_superinstructions[j].handlers[
+                    a->op == BC_SETCC ? a->cond : b->cond]];
+                break;
+            }
+        }
+    }
+}
+
+static int compare_functions(const void *a, const void *b)
+{
+    const struct interp_function *fa = a, *fb = b;
+
+    return fa->entry < fb->entry ? -1 : fa->entry > fb->entry;
+}
+
+//
+// Split the code into functions at the labels not local to a function,
+// and mark each instruction with its function. Code before the first
+// function stays in a function of its own that is never compiled.
+//
+static void find_functions(struct machine *m, const struct bc_program *prog)
+{
+    const struct bc_symbol *sym;
+    size_t i, j, n = 1;
+
+    m->functions = calloc(prog->symbols.size + 1, sizeof(struct interp_function));
+    m->functions[0].tier = TIER_FAILED;
+    for (i = 0; i < prog->symbols.size; i++) {
+        sym = prog->symbols.data[i];
+        if (sym->section == BC_TEXT && strncmp(sym->name, ".L", 2) != 0 && sym->value < prog->code_len) {
+            m->functions[n].name = sym->name;
+            m->functions[n].entry = sym->value;
+            n++;
+        }
+    }
+    qsort(m->functions + 1, n - 1, sizeof(struct interp_function), compare_functions);
+
+    /* drop the empty ones, and the first if the code starts with a function */
+    for (i = n > 1 && m->functions[1].entry == 0, j = 0; i < n; i++) {
+        if (j == 0 || m->functions[i].entry > m->functions[j - 1].entry)
+            m->functions[j++] = m->functions[i];
+    }
+    m->num_functions = j;
+
+    for (i = 0; i < m->num_functions; i++) {
+        m->functions[i].end = i + 1 < m->num_functions ? m->functions[i + 1].entry : prog->code_len;
+        for (j = m->functions[i].entry; j < m->functions[i].end; j++)
+            m->code[j].function = i;
+    }
+}
+
+//
+// Prepare a program for execution: lay out the data image,
+// resolve symbols and select the handlers.
+//
+static int load(struct machine *m, const struct bc_program *prog, const void *const *handlers)
+{
+    const struct bc_reloc *reloc;
+    const struct bc_insn *insn;
+    struct insn *code;
+    uint64_t addr;
+    int32_t main_sym = -1;
+    size_t i;
+
+    m->code_len = prog->code_len + 3;
+    m->code = calloc(m->code_len, sizeof(struct insn));
+    m->data = malloc(prog->data_len + 1);
+    memcpy(m->data, prog->data, prog->data_len);
+
+    for (i = 0; i < prog->relocs.size; i++) {
+        reloc = prog->relocs.data[i];
+        if (reloc->sym < 0)
+            addr = (uintptr_t) m->data;
+        else if (!address(m, prog, reloc->sym, &addr))
+            return 1;
+        addr += reloc->addend;
+        memcpy(m->data + reloc->offset, &addr, sizeof(addr));
+    }
+
+    if (m->args->jit)
+        find_functions(m, prog);
+
+    for (i = 0; i < prog->code_len; i++) {
+        insn = &prog->code[i];
+        code = &m->code[i];
+        code->handler = handlers[handler(insn)];
+        code->imm = insn->imm;
+        code->disp = insn->disp;
+        code->dst = insn->dst;
+        code->src = insn->src;
+        code->base = insn->base;
+        code->index = insn->index;
+        code->scale = insn->scale;
+        if (insn->op == BC_CALL_R && m->args->jit)
+            code->handler = handlers[H_CALL_R_COUNT];
+        if (insn->sym < 0)
+            continue;
+        if (!address(m, prog, insn->sym, &addr))
+            return 1;
+        if (insn->op == BC_JMP || insn->op == BC_JCC || insn->op == BC_CALL) {
+            if (((const struct bc_symbol*) prog->symbols.data[insn->sym])->section == BC_TEXT) {
+                code->target = (struct insn*) (uintptr_t) addr;
+                if (!m->args->jit)
+                    continue;
+                /* count calls and loop iterations for tiered execution */
+                if (insn->op == BC_CALL)
+                    code->handler = handlers[H_CALL_COUNT];
+                else if (code->target <= code && insn->op == BC_JMP)
+                    code->handler = handlers[H_JMP_BACK];
+                else if (code->target <= code)
+                    code->handler = handlers[jcc_back_handlers[insn->cond]];
+            }
+            else if (insn->op == BC_CALL) {
+                code->handler = handlers[H_CALL_NATIVE];
+                code->imm = (const struct bc_native*) (uintptr_t) addr - bc_natives;
+            }
+            else {
+                eprintf(m->args->arg0, "jump to data " QUOTE_FMT("%s") "\n",
+                        ((const struct bc_symbol*) prog->symbols.data[insn->sym])->name);
+                return 1;
+            }
+        }
+        else
+            code->disp += addr;
+    }
+    combine(m, prog, handlers);
+
+    for (i = 0; i < prog->symbols.size; i++) {
+        const struct bc_symbol *sym = prog->symbols.data[i];
+        if (sym->section == BC_TEXT && strcmp(sym->name, "main") == 0)
+            main_sym = i;
+    }
+    if (main_sym < 0) {
+        eprintf(m->args->arg0, "undefined reference to " QUOTE_FMT("main") "\n");
+        return 1;
+    }
+
+    code = &m->code[prog->code_len];
+    code[0].handler = handlers[H_FALL_OFF];
+    code[1].handler = handlers[m->args->jit ? H_CALL_COUNT : H_CALL];
+    code[1].target = &m->code[((const struct bc_symbol*) prog->symbols.data[main_sym])->value];
+    code[2].handler = handlers[H_HALT];
+    return 0;
+}
+
+//
+// Run a program in bytecode form. Return the value of main,
+// as the exit status of the process.
+//
+int interpret(struct compiler_args *args, const struct bc_program *prog)
+{
+    struct machine m = { args, prog, NULL, 0, NULL, NULL, NULL, 0, NULL, NULL };
+    uint64_t regs[BC_NUM_REGISTERS] = { 0 };
+    const void *const *handlers;
+    void *stack;
+    int status;
+
+    execute(NULL, NULL, NULL, &handlers);
+    m.enter_native = handlers[H_ENTER_NATIVE];
+    if ((status = load(&m, prog, handlers)) == 0 && (!args->jit || (status = jit_start(&m)) == 0)) {
+        stack = mmap(NULL, GUARD_SIZE + STACK_SIZE, PROT_READ | PROT_WRITE,
+                     MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (stack == MAP_FAILED || mprotect(stack, GUARD_SIZE, PROT_NONE) != 0) {
+            eprintf(args->arg0, "cannot allocate the stack\n");
+            status = 1;
+        }
+        else {
+            m.stack = (unsigned char*) stack + GUARD_SIZE;
+            regs[BC_RSP] = (uintptr_t) m.stack + STACK_SIZE;
+            execute(&m, &m.code[prog->code_len + 1], regs, NULL);
+            status = (int) regs[BC_RAX];
+            munmap(stack, GUARD_SIZE + STACK_SIZE);
+        }
+    }
+    if (args->jit)
+        jit_stop(&m);
+    free(m.functions);
+    free(m.data);
+    free(m.code);
+    return status;
+}
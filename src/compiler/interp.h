@@ -0,0 +1,65 @@
+#ifndef BCAUSE_INTERP_H
+#define BCAUSE_INTERP_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "bytecode.h"
+
+struct jit;
+
+//
+// An instruction prepared for execution: the address of its handler,
+// with jump targets and symbol addresses resolved.
+//
+struct insn {
+    const void *handler;
+    struct insn *target;    /* jump or call target */
+    int64_t imm;            /* immediate, or index of a native function */
+    int64_t disp;           /* displacement, with the address of the symbol */
+    uint32_t function;      /* function containing the instruction */
+    uint8_t dst, src, base, index, scale;
+};
+
+enum tier {
+    TIER_INTERPRETED,   /* runs in the interpreter */
+    TIER_QUEUED,        /* waits to be compiled */
+    TIER_NATIVE,        /* compiled, the entry runs native code */
+    TIER_FAILED,        /* cannot be compiled, stays interpreted */
+};
+
+//
+// A function of the loaded program: the instructions from its
+// label up to the next function.
+//
+struct interp_function {
+    const char *name;
+    size_t entry, end;
+    unsigned count;     /* calls and loop iterations so far */
+    enum tier tier;
+};
+
+//
+// A loaded program: the code followed by three instructions of its
+// own: a trap for running past the end, the call of main and a halt.
+//
+struct machine {
+    struct compiler_args *args;
+    const struct bc_program *prog;
+    struct insn *code;
+    size_t code_len;
+    unsigned char *data;
+    unsigned char *stack;
+    struct interp_function *functions;
+    size_t num_functions;
+    const void *enter_native;   /* handler of entries compiled to native code */
+    struct jit *jit;
+};
+
+void interp_run(struct machine *m, struct insn *entry, uint64_t *regs);
+
+int jit_start(struct machine *m);
+void jit_hot(struct machine *m, uint32_t function);
+void jit_call(struct machine *m, uint32_t function, uint64_t *regs);
+void jit_stop(struct machine *m);
+
+#endif /* BCAUSE_INTERP_H */
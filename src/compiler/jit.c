@@ -0,0 +1,754 @@
+//
+// Tiered execution: functions start in the interpreter, and those
+// called or looping often are compiled to native code by a worker
+// thread. A compiled function is written back from its bytecode
+// as assembly, put through the system assembler and mapped
+// executable; then its entry is patched to run the native code.
+//
+// Native code calls other functions through a cell per function,
+// holding either its native code or a stub that goes back to the
+// interpreter. Both tiers keep the registers in jit_regs when
+// passing control to each other.
+//
+#define _DEFAULT_SOURCE
+#include "interp.h"
+#include "compiler.h"
+
+#include <elf.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <spawn.h>
+#include <stdarg.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#if !defined(__x86_64__) || !defined(__GNUC__)
+    #error "the JIT needs an x86-64 host and GNU C"
+#endif
+
+#define NUM_REGS    16      /* registers of the machine, without BC_ZERO */
+#define STUB_SIZE   32      /* bytes of the stub of a function */
+
+extern char **environ;
+
+//
+// A mapping of compiled code.
+//
+struct jit_code {
+    void *addr;
+    size_t size;
+};
+
+struct jit {
+    void **cells;           /* entry of each function: stub or native code */
+    unsigned char *stubs;   /* stubs calling the interpreter */
+    size_t stubs_size;
+    struct list code;       /* struct jit_code*, added by the worker */
+
+    uint32_t *queue;        /* functions to compile, each queued once */
+    size_t head, tail;
+    bool running, stop;
+    pthread_mutex_t lock;
+    pthread_cond_t wake;
+    pthread_t worker;
+};
+
+//
+// Registers passed between the tiers, in the order of enum bc_register,
+// and the C stack pointer while native code runs.
+//
+__attribute__((visibility("hidden"))) uint64_t jit_regs[NUM_REGS];
+__attribute__((visibility("hidden"))) void *jit_c_sp;
+
+/* the machine being run; calls of the glue code below come from its thread */
+static struct machine *jit_machine;
+
+void jit_enter(void *entry);
+void jit_gate(void);
+void jit_indirect(void);
+void jit_native(void);
+void jit_interpret(uint32_t function);
+int jit_resolve(uint64_t addr);
+
+//
+// Glue code between the tiers.
+//
+// jit_enter(entry) runs native code with the registers of jit_regs,
+// up to its return; the C stack is left in jit_c_sp meanwhile.
+// jit_gate is reached from the stub of a function not compiled, with
+// the function in %eax: it runs the function in the interpreter.
+// jit_indirect calls the function whose address is in %r11, an
+// instruction of the program or a native function of the library.
+// jit_native calls the library function in %r11, on an aligned stack.
+// The generated code never uses %r11, so it is free for the glue.
+//
+__asm__(
+    ".macro jit_save_regs\n"
+    "    mov %rax, jit_regs+0(%rip)\n"
+    "    mov %rcx, jit_regs+8(%rip)\n"
+    "    mov %rdx, jit_regs+16(%rip)\n"
+    "    mov %rbx, jit_regs+24(%rip)\n"
+    "    mov %rsp, jit_regs+32(%rip)\n"
+    "    mov %rbp, jit_regs+40(%rip)\n"
+    "    mov %rsi, jit_regs+48(%rip)\n"
+    "    mov %rdi, jit_regs+56(%rip)\n"
+    "    mov %r8, jit_regs+64(%rip)\n"
+    "    mov %r9, jit_regs+72(%rip)\n"
+    "    mov %r10, jit_regs+80(%rip)\n"
+    "    mov %r12, jit_regs+96(%rip)\n"
+    "    mov %r13, jit_regs+104(%rip)\n"
+    "    mov %r14, jit_regs+112(%rip)\n"
+    "    mov %r15, jit_regs+120(%rip)\n"
+    ".endm\n"
+    ".macro jit_load_regs\n"
+    "    mov jit_regs+0(%rip), %rax\n"
+    "    mov jit_regs+8(%rip), %rcx\n"
+    "    mov jit_regs+16(%rip), %rdx\n"
+    "    mov jit_regs+24(%rip), %rbx\n"
+    "    mov jit_regs+40(%rip), %rbp\n"
+    "    mov jit_regs+48(%rip), %rsi\n"
+    "    mov jit_regs+56(%rip), %rdi\n"
+    "    mov jit_regs+64(%rip), %r8\n"
+    "    mov jit_regs+72(%rip), %r9\n"
+    "    mov jit_regs+80(%rip), %r10\n"
+    "    mov jit_regs+96(%rip), %r12\n"
+    "    mov jit_regs+104(%rip), %r13\n"
+    "    mov jit_regs+112(%rip), %r14\n"
+    "    mov jit_regs+120(%rip), %r15\n"
+    ".endm\n"
+    "    .text\n"
+    "    .globl jit_enter\n"
+    "    .type jit_enter, @function\n"
+    "jit_enter:\n"
+    "    push %rbx\n"
+    "    push %rbp\n"
+    "    push %r12\n"
+    "    push %r13\n"
+    "    push %r14\n"
+    "    push %r15\n"
+    "    push jit_c_sp(%rip)\n"
+    "    mov %rsp, jit_c_sp(%rip)\n"
+    "    mov %rdi, %r11\n"
+    "    mov jit_regs+32(%rip), %rsp\n"
+    "    lea jit_exit(%rip), %rax\n"
+    "    push %rax\n"
+    "    jit_load_regs\n"
+    "    jmp *%r11\n"
+    "jit_exit:\n"
+    "    jit_save_regs\n"
+    "    mov jit_c_sp(%rip), %rsp\n"
+    "    pop jit_c_sp(%rip)\n"
+    "    pop %r15\n"
+    "    pop %r14\n"
+    "    pop %r13\n"
+    "    pop %r12\n"
+    "    pop %rbp\n"
+    "    pop %rbx\n"
+    "    ret\n"
+    "\n"
+    "    .globl jit_gate\n"
+    "    .type jit_gate, @function\n"
+    "jit_gate:\n"
+    "    jit_save_regs\n"
+    "    pop %rsi\n"
+    "    mov %rsp, jit_regs+32(%rip)\n"
+    "    mov %eax, %edi\n"
+    "    mov jit_c_sp(%rip), %rsp\n"
+    "    and $-16, %rsp\n"
+    "    push %rsi\n"
+    "    push %rsi\n"
+    "    call jit_interpret\n"
+    "    pop %rsi\n"
+    "    pop %rsi\n"
+    "    mov jit_regs+32(%rip), %rsp\n"
+    "    push %rsi\n"
+    "    jit_load_regs\n"
+    "    ret\n"
+    "\n"
+    "    .globl jit_indirect\n"
+    "    .type jit_indirect, @function\n"
+    "jit_indirect:\n"
+    "    jit_save_regs\n"
+    "    mov %r11, %rdi\n"
+    "    mov jit_c_sp(%rip), %rsp\n"
+    "    and $-16, %rsp\n"
+    "    call jit_resolve\n"
+    "    mov jit_regs+88(%rip), %r11\n"
+    "    mov jit_regs+32(%rip), %rsp\n"
+    "    test %eax, %eax\n"
+    "    jit_load_regs\n"
+    "    jnz jit_native\n"
+    "    jmp *%r11\n"
+    "\n"
+    "    .globl jit_native\n"
+    "    .type jit_native, @function\n"
+    "jit_native:\n"
+    "    push %rbp\n"
+    "    mov %rsp, %rbp\n"
+    "    and $-16, %rsp\n"
+    "    call *%r11\n"
+    "    leave\n"
+    "    ret\n"
+);
+
+//
+// Called through jit_gate: run a function not compiled yet
+// in the interpreter, up to the halt after the program.
+//
+void jit_interpret(uint32_t function)
+{
+    struct machine *m = jit_machine;
+    uint64_t regs[BC_NUM_REGISTERS];
+
+    if (++m->functions[function].count == m->args->jit_threshold)
+        jit_hot(m, function);
+    memcpy(regs, jit_regs, sizeof(jit_regs));
+    regs[BC_ZERO] = 0;
+    regs[BC_RSP] -= 8;
+    *(uint64_t*) (uintptr_t) regs[BC_RSP] = (uintptr_t) &m->code[m->code_len - 1];
+    interp_run(m, &m->code[m->functions[function].entry], regs);
+    memcpy(jit_regs, regs, sizeof(jit_regs));
+}
+
+//
+// Called through jit_indirect: find the code called at an address
+// and leave it in the slot of %r11. Return 1 for a library function.
+//
+int jit_resolve(uint64_t addr)
+{
+    struct machine *m = jit_machine;
+    const struct bc_native *native = (const struct bc_native*) (uintptr_t) addr;
+    const struct insn *insn = (const struct insn*) (uintptr_t) addr;
+    uint32_t function;
+
+    if (addr >= (uintptr_t) m->code && addr < (uintptr_t) (m->code + m->code_len) &&
+        (addr - (uintptr_t) m->code) % sizeof(struct insn) == 0) {
+        function = insn->function;
+        if (insn == &m->code[m->functions[function].entry]) {
+            jit_regs[BC_R11] = (uintptr_t) __atomic_load_n(&m->jit->cells[function], __ATOMIC_ACQUIRE);
+            return 0;
+        }
+    }
+    else if (native >= bc_natives && native < bc_natives + bc_num_natives &&
+             (addr - (uintptr_t) bc_natives) % sizeof(struct bc_native) == 0) {
+        jit_regs[BC_R11] = (uintptr_t) native->fn;
+        return 1;
+    }
+    eprintf(m->args->arg0, "call of an invalid address 0x%lx\n", (unsigned long) addr);
+    exit(1);
+}
+
+//
+// Run a compiled function with the given registers, up to its return.
+//
+void jit_call(struct machine *m, uint32_t function, uint64_t *regs)
+{
+    memcpy(jit_regs, regs, sizeof(jit_regs));
+    jit_enter(__atomic_load_n(&m->jit->cells[function], __ATOMIC_ACQUIRE));
+    memcpy(regs, jit_regs, sizeof(jit_regs));
+}
+
+//
+// Report a function compiled, or left in the interpreter,
+// for -Rpass=jit and -Rpass-missed=jit.
+//
+static void jit_remark(struct machine *m, bool passed, const char *fmt, ...)
+{
+    regex_t *filter = passed ? m->args->rpass : m->args->rpass_missed;
+    char message[BUFSIZ];
+    va_list ap;
+
+    if (!filter || regexec(filter, "jit", 0, NULL, 0) != 0)
+        return;
+    va_start(ap, fmt);
+    vsnprintf(message, sizeof(message), fmt, ap);
+    va_end(ap);
+    fprintf(stderr, COLOR_BOLD_WHITE "%s: " COLOR_BOLD_BLUE "remark: " COLOR_RESET "%s [-Rpass%s=jit]\n",
+            m->args->arg0, message, passed ? "" : "-missed");
+}
+
+static bool fits_int32(int64_t value)
+{
+    return value >= INT32_MIN && value <= INT32_MAX;
+}
+
+static const char *const reg_names[NUM_REGS] = {
+    "%rax", "%rcx", "%rdx", "%rbx", "%rsp", "%rbp", "%rsi", "%rdi",
+    "%r8", "%r9", "%r10", "%r11", "%r12", "%r13", "%r14", "%r15",
+};
+
+static const char *const byte_reg_names[NUM_REGS] = {
+    "%al", "%cl", "%dl", "%bl", "%spl", "%bpl", "%sil", "%dil",
+    "%r8b", "%r9b", "%r10b", "%r11b", "%r12b", "%r13b", "%r14b", "%r15b",
+};
+
+static const char *const condition_names[BC_NUM_CONDITIONS] = {
+#define CONDITION_NAME(name, type, op) #name,
+    BC_CONDITIONS(CONDITION_NAME)
+#undef CONDITION_NAME
+};
+
+//
+// Write the memory operand of an instruction into buf. An absolute
+// address, as of a symbol, goes through %r11 when it does not fit
+// into a displacement; lea keeps the flags for a following jump.
+//
+static void memory_operand(FILE *out, const struct insn *insn, char *buf, size_t size)
+{
+    char index[32] = "";
+
+    if (insn->index != BC_ZERO)
+        snprintf(index, sizeof(index), ",%s,%u", reg_names[insn->index], insn->scale);
+    if (fits_int32(insn->disp) && insn->base == BC_ZERO && insn->index == BC_ZERO) {
+        snprintf(buf, size, "%ld", (long) insn->disp);
+        return;
+    }
+    if (fits_int32(insn->disp)) {
+        snprintf(buf, size, "%ld(%s%s)", (long) insn->disp,
+                 insn->base == BC_ZERO ? "" : reg_names[insn->base], index);
+        return;
+    }
+    fprintf(out, "\tmovabs $%ld, %%r11\n", (long) insn->disp);
+    if (insn->base != BC_ZERO)
+        fprintf(out, "\tlea (%%r11,%s), %%r11\n", reg_names[insn->base]);
+    snprintf(buf, size, "(%%r11%s)", index);
+}
+
+//
+// Write the instructions of a function as assembly for the host.
+// Return NULL, or why the function cannot be compiled.
+//
+static const char *function_assembly(struct machine *m, const struct interp_function *f, FILE *out)
+{
+    static const char *const alu_names[] = { "add", "sub", "and", "or", "xor" };
+    const struct bc_insn *bc;
+    const struct insn *insn;
+    const struct bc_symbol *sym;
+    const char *d, *s;
+    char mem[96];
+    size_t i, target;
+    uint32_t callee;
+    unsigned alu;
+
+    fprintf(out, "\t.text\n");
+    for (i = f->entry; i < f->end; i++) {
+        bc = &m->prog->code[i];
+        insn = &m->code[i];
+        if (bc->dst == BC_R11 || bc->src == BC_R11 || bc->base == BC_R11 || bc->index == BC_R11)
+            return "it uses %r11";
+        if (bc->op != BC_MOV_RI && bc->op != BC_CALL && !fits_int32(bc->imm))
+            return "an immediate does not fit into 32 bits";
+
+        d = reg_names[bc->dst & (NUM_REGS - 1)];
+        s = reg_names[bc->src & (NUM_REGS - 1)];
+        mem[0] = '\0';
+        switch (bc->op) {
+        case BC_LOAD: case BC_LOADS32: case BC_STORE: case BC_STORE_I: case BC_LEA:
+        case BC_ADD_RM: case BC_ADD_MR: case BC_ADD_MI: case BC_SUB_RM: case BC_SUB_MR: case BC_SUB_MI:
+        case BC_AND_RM: case BC_AND_MR: case BC_AND_MI: case BC_OR_RM: case BC_OR_MR: case BC_OR_MI:
+        case BC_XOR_RM: case BC_XOR_MR: case BC_XOR_MI: case BC_IMUL_RM:
+        case BC_CMP_RM: case BC_CMP_MR: case BC_CMP_MI: case BC_PUSH_M:
+            fprintf(out, ".L%zu:\n", i);
+            memory_operand(out, insn, mem, sizeof(mem));
+            break;
+        default:
+            fprintf(out, ".L%zu:\n", i);
+        }
+
+        switch (bc->op) {
+        case BC_MOV_RR:  fprintf(out, "\tmov %s, %s\n", s, d); break;
+        case BC_MOV_RI:  fprintf(out, "\tmovabs $%ld, %s\n", (long) bc->imm, d); break;
+        case BC_LOAD:    fprintf(out, "\tmov %s, %s\n", mem, d); break;
+        case BC_LOADS32: fprintf(out, "\tmovslq %s, %s\n", mem, d); break;
+        case BC_STORE:   fprintf(out, "\tmov %s, %s\n", s, mem); break;
+        case BC_STORE_I: fprintf(out, "\tmovq $%ld, %s\n", (long) bc->imm, mem); break;
+        case BC_LEA:     fprintf(out, "\tlea %s, %s\n", mem, d); break;
+        case BC_MOVZB:   fprintf(out, "\tmovzbq %s, %s\n", byte_reg_names[bc->src], d); break;
+
+        case BC_ADD_RR: case BC_SUB_RR: case BC_AND_RR: case BC_OR_RR: case BC_XOR_RR:
+            alu = (bc->op - BC_ADD_RR) / (BC_SUB_RR - BC_ADD_RR);
+            fprintf(out, "\t%s %s, %s\n", alu_names[alu], s, d);
+            break;
+        case BC_ADD_RI: case BC_SUB_RI: case BC_AND_RI: case BC_OR_RI: case BC_XOR_RI:
+            alu = (bc->op - BC_ADD_RI) / (BC_SUB_RI - BC_ADD_RI);
+            fprintf(out, "\t%s $%ld, %s\n", alu_names[alu], (long) bc->imm, d);
+            break;
+        case BC_ADD_RM: case BC_SUB_RM: case BC_AND_RM: case BC_OR_RM: case BC_XOR_RM:
+            alu = (bc->op - BC_ADD_RM) / (BC_SUB_RM - BC_ADD_RM);
+            fprintf(out, "\t%s %s, %s\n", alu_names[alu], mem, d);
+            break;
+        case BC_ADD_MR: case BC_SUB_MR: case BC_AND_MR: case BC_OR_MR: case BC_XOR_MR:
+            alu = (bc->op - BC_ADD_MR) / (BC_SUB_MR - BC_ADD_MR);
+            fprintf(out, "\t%s %s, %s\n", alu_names[alu], s, mem);
+            break;
+        case BC_ADD_MI: case BC_SUB_MI: case BC_AND_MI: case BC_OR_MI: case BC_XOR_MI:
+            alu = (bc->op - BC_ADD_MI) / (BC_SUB_MI - BC_ADD_MI);
+            fprintf(out, "\t%sq $%ld, %s\n", alu_names[alu], (long) bc->imm, mem);
+            break;
+        case BC_IMUL_RR: fprintf(out, "\timul %s, %s\n", s, d); break;
+        case BC_IMUL_RI: fprintf(out, "\timul $%ld, %s\n", (long) bc->imm, d); break;
+        case BC_IMUL_RM: fprintf(out, "\timul %s, %s\n", mem, d); break;
+
+        case BC_CMP_RR:  fprintf(out, "\tcmp %s, %s\n", s, d); break;
+        case BC_CMP_RI:  fprintf(out, "\tcmp $%ld, %s\n", (long) bc->imm, d); break;
+        case BC_CMP_RM:  fprintf(out, "\tcmp %s, %s\n", mem, d); break;
+        case BC_CMP_MR:  fprintf(out, "\tcmp %s, %s\n", s, mem); break;
+        case BC_CMP_MI:  fprintf(out, "\tcmpq $%ld, %s\n", (long) bc->imm, mem); break;
+        case BC_TEST_RR: fprintf(out, "\ttest %s, %s\n", s, d); break;
+        case BC_TEST_RI: fprintf(out, "\ttest $%ld, %s\n", (long) bc->imm, d); break;
+        case BC_BT_RR:   fprintf(out, "\tbt %s, %s\n", s, d); break;
+        case BC_BT_RI:   fprintf(out, "\tbt $%ld, %s\n", (long) (bc->imm & 63), d); break;
+
+        case BC_SHL_RI:  fprintf(out, "\tshl $%ld, %s\n", (long) (bc->imm & 63), d); break;
+        case BC_SHL_RC:  fprintf(out, "\tshl %%cl, %s\n", d); break;
+        case BC_SAR_RI:  fprintf(out, "\tsar $%ld, %s\n", (long) (bc->imm & 63), d); break;
+        case BC_SAR_RC:  fprintf(out, "\tsar %%cl, %s\n", d); break;
+        case BC_SHR_RI:  fprintf(out, "\tshr $%ld, %s\n", (long) (bc->imm & 63), d); break;
+        case BC_SHR_RC:  fprintf(out, "\tshr %%cl, %s\n", d); break;
+        case BC_ROL_RI:  fprintf(out, "\trol $%ld, %s\n", (long) (bc->imm & 63), d); break;
+        case BC_ROL_RC:  fprintf(out, "\trol %%cl, %s\n", d); break;
+        case BC_NEG:     fprintf(out, "\tneg %s\n", d); break;
+        case BC_NOT:     fprintf(out, "\tnot %s\n", d); break;
+        case BC_IMUL1:   fprintf(out, "\timul %s\n", s); break;
+        case BC_MUL1:    fprintf(out, "\tmul %s\n", s); break;
+        case BC_IDIV:    fprintf(out, "\tidiv %s\n", s); break;
+        case BC_CQO:     fprintf(out, "\tcqo\n"); break;
+        case BC_POPCNT:  fprintf(out, "\tpopcnt %s, %s\n", s, d); break;
+        case BC_LZCNT:   fprintf(out, "\tlzcnt %s, %s\n", s, d); break;
+        case BC_TZCNT:   fprintf(out, "\ttzcnt %s, %s\n", s, d); break;
+        case BC_BSR:     fprintf(out, "\tbsr %s, %s\n", s, d); break;
+        case BC_BSF:     fprintf(out, "\tbsf %s, %s\n", s, d); break;
+        case BC_BSWAP:   fprintf(out, "\tbswap %s\n", d); break;
+
+        case BC_PUSH_R:  fprintf(out, "\tpush %s\n", s); break;
+        case BC_PUSH_I:  fprintf(out, "\tpushq $%ld\n", (long) bc->imm); break;
+        case BC_PUSH_M:  fprintf(out, "\tpushq %s\n", mem); break;
+        case BC_POP_R:   fprintf(out, "\tpop %s\n", d); break;
+
+        case BC_JMP:
+        case BC_JCC:
+            target = insn->target - m->code;
+            if (target < f->entry || target >= f->end)
+                return "it jumps out of its code";
+            if (bc->op == BC_JMP)
+                fprintf(out, "\tjmp .L%zu\n", target);
+            else
+                fprintf(out, "\tj%s .L%zu\n", condition_names[bc->cond], target);
+            break;
+        case BC_CALL:
+            sym = m->prog->symbols.data[bc->sym];
+            if (sym->section != BC_TEXT) {
+                fprintf(out, "\tmovabs $%lu, %%r11\n", (unsigned long) (uintptr_t) bc_natives[insn->imm].fn);
+                fprintf(out, "\tmovabs $%lu, %%rax\n", (unsigned long) (uintptr_t) jit_native);
+                fprintf(out, "\tcall *%%rax\n");
+                break;
+            }
+            callee = insn->target->function;
+            if (insn->target != &m->code[m->functions[callee].entry])
+                return "it calls into the middle of a function";
+            fprintf(out, "\tmovabs $%lu, %%r11\n", (unsigned long) (uintptr_t) &m->jit->cells[callee]);
+            fprintf(out, "\tcall *(%%r11)\n");
+            break;
+        case BC_CALL_R:
+            fprintf(out, "\tmov %s, %%r11\n", s);
+            fprintf(out, "\tmovabs $%lu, %%rax\n", (unsigned long) (uintptr_t) jit_indirect);
+            fprintf(out, "\tcall *%%rax\n");
+            break;
+        case BC_RET:     fprintf(out, "\tret\n"); break;
+
+        case BC_SETCC:
+            fprintf(out, "\tset%s %s\n", condition_names[bc->cond], byte_reg_names[bc->dst]);
+            break;
+        case BC_CMOVCC:
+            fprintf(out, "\tcmov%s %s, %s\n", condition_names[bc->cond], s, d);
+            break;
+        default:
+            return "it has an instruction unknown to the JIT";
+        }
+    }
+    return NULL;
+}
+
+//
+// Run the assembler on a file, quietly.
+// Return NULL, or the reason it failed: on a host without
+// binutils the functions stay interpreted.
+//
+static const char *assemble(const char *source, const char *object)
+{
+    char *const argv[] = { "as", "--64", (char*) source, "-o", (char*) object, NULL };
+    posix_spawn_file_actions_t actions;
+    const char *reason = "the assembler " QUOTE_FMT("as") " cannot be run";
+    int status = -1;
+    pid_t pid;
+
+    posix_spawn_file_actions_init(&actions);
+    posix_spawn_file_actions_addopen(&actions, STDOUT_FILENO, "/dev/null", O_WRONLY, 0);
+    posix_spawn_file_actions_adddup2(&actions, STDOUT_FILENO, STDERR_FILENO);
+    if (posix_spawnp(&pid, "as", &actions, NULL, argv, environ) == 0) {
+        while (waitpid(pid, &status, 0) < 0 && errno == EINTR)
+            ;
+        /* the child exits with 127 when as is not found */
+        if (status == 0)
+            reason = NULL;
+        else if (!WIFEXITED(status) || WEXITSTATUS(status) != 127)
+            reason = "the assembler failed";
+    }
+    posix_spawn_file_actions_destroy(&actions);
+    return reason;
+}
+
+//
+// Read the .text section of an object file into executable memory.
+// Fail when the code needs relocation.
+//
+static struct jit_code *load_object(const char *object)
+{
+    struct jit_code *code = NULL;
+    const Elf64_Ehdr *ehdr;
+    const Elf64_Shdr *shdr, *text = NULL;
+    unsigned char *image = NULL;
+    const char *names;
+    long size;
+    size_t i;
+    FILE *in;
+
+    if (!(in = fopen(object, "rb")))
+        return NULL;
+    if (fseek(in, 0, SEEK_END) == 0 && (size = ftell(in)) > (long) sizeof(Elf64_Ehdr) &&
+        fseek(in, 0, SEEK_SET) == 0 && (image = malloc(size)) && fread(image, size, 1, in) != 1) {
+        free(image);
+        image = NULL;
+    }
+    fclose(in);
+    if (!image)
+        return NULL;
+
+    ehdr = (const Elf64_Ehdr*) image;
+    if (memcmp(ehdr->e_ident, ELFMAG, SELFMAG) != 0 || ehdr->e_ident[EI_CLASS] != ELFCLASS64 ||
+        ehdr->e_shentsize != sizeof(Elf64_Shdr) || ehdr->e_shstrndx >= ehdr->e_shnum ||
+        ehdr->e_shoff > (unsigned long) size ||
+        ehdr->e_shnum > (size - ehdr->e_shoff) / sizeof(Elf64_Shdr))
+        goto done;
+    shdr = (const Elf64_Shdr*) (image + ehdr->e_shoff);
+    if (shdr[ehdr->e_shstrndx].sh_offset >= (unsigned long) size)
+        goto done;
+    names = (const char*) image + shdr[ehdr->e_shstrndx].sh_offset;
+    for (i = 0; i < ehdr->e_shnum; i++) {
+        if (shdr[i].sh_name >= size - shdr[ehdr->e_shstrndx].sh_offset)
+            goto done;
+        if (shdr[i].sh_type == SHT_RELA && shdr[i].sh_size > 0)
+            goto done;
+        if (strcmp(names + shdr[i].sh_name, ".text") == 0)
+            text = &shdr[i];
+    }
+    if (!text || text->sh_size == 0 || text->sh_offset > (unsigned long) size ||
+        text->sh_size > size - text->sh_offset)
+        goto done;
+
+    code = malloc(sizeof(struct jit_code));
+    code->size = text->sh_size;
+    code->addr = mmap(NULL, code->size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (code->addr == MAP_FAILED) {
+        free(code);
+        code = NULL;
+        goto done;
+    }
+    memcpy(code->addr, image + text->sh_offset, code->size);
+    if (mprotect(code->addr, code->size, PROT_READ | PROT_EXEC) != 0) {
+        munmap(code->addr, code->size);
+        free(code);
+        code = NULL;
+    }
+done:
+    free(image);
+    return code;
+}
+
+//
+// Compile a function to native code. Return its code, or NULL
+// after reporting why it stays interpreted.
+//
+static struct jit_code *compile_function(struct machine *m, const struct interp_function *f)
+{
+    const char *tmpdir = getenv("TMPDIR");
+    char source[4096], object[4096];
+    struct jit_code *code = NULL;
+    const char *reason;
+    FILE *out;
+    int fd;
+
+    if (!tmpdir || !*tmpdir)
+        tmpdir = "/tmp";
+    snprintf(source, sizeof(source), "%s/bcause-jit-XXXXXX", tmpdir);
+    snprintf(object, sizeof(object), "%s/bcause-jit-XXXXXX", tmpdir);
+    if ((fd = mkstemp(source)) < 0) {
+        jit_remark(m, false, "function " QUOTE_FMT("%s") " stays interpreted: %s", f->name, strerror(errno));
+        return NULL;
+    }
+    out = fdopen(fd, "w");
+    reason = function_assembly(m, f, out);
+    fclose(out);
+    if (!reason) {
+        if ((fd = mkstemp(object)) < 0)
+            reason = strerror(errno);
+        else {
+            close(fd);
+            if (!(reason = assemble(source, object)) && !(code = load_object(object)))
+                reason = "its object code cannot be loaded";
+            remove(object);
+        }
+    }
+    remove(source);
+
+    if (reason)
+        jit_remark(m, false, "function " QUOTE_FMT("%s") " stays interpreted: %s", f->name, reason);
+    else
+        jit_remark(m, true, "function " QUOTE_FMT("%s") " compiled to native code, %zu bytes",
+                   f->name, code->size);
+    return code;
+}
+
+//
+// Compile the functions found hot, until stopped.
+//
+static void *worker(void *arg)
+{
+    struct machine *m = arg;
+    struct jit *jit = m->jit;
+    struct interp_function *f;
+    struct jit_code *code;
+    uint32_t function;
+
+    for (;;) {
+        pthread_mutex_lock(&jit->lock);
+        while (!jit->stop && jit->head == jit->tail)
+            pthread_cond_wait(&jit->wake, &jit->lock);
+        if (jit->stop) {
+            pthread_mutex_unlock(&jit->lock);
+            return NULL;
+        }
+        function = jit->queue[jit->head++];
+        pthread_mutex_unlock(&jit->lock);
+
+        f = &m->functions[function];
+        if (!(code = compile_function(m, f))) {
+            __atomic_store_n(&f->tier, TIER_FAILED, __ATOMIC_RELAXED);
+            continue;
+        }
+        list_push(&jit->code, code);
+        __atomic_store_n(&jit->cells[function], code->addr, __ATOMIC_RELEASE);
+        __atomic_store_n(&m->code[f->entry].handler, m->enter_native, __ATOMIC_RELEASE);
+        __atomic_store_n(&f->tier, TIER_NATIVE, __ATOMIC_RELAXED);
+    }
+}
+
+//
+// Queue a function found hot for compilation.
+//
+void jit_hot(struct machine *m, uint32_t function)
+{
+    struct jit *jit = m->jit;
+    enum tier expected = TIER_INTERPRETED;
+
+    if (!__atomic_compare_exchange_n(&m->functions[function].tier, &expected, TIER_QUEUED,
+                                     false, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+        return;
+    pthread_mutex_lock(&jit->lock);
+    jit->queue[jit->tail++] = function;
+    pthread_cond_signal(&jit->wake);
+    pthread_mutex_unlock(&jit->lock);
+}
+
+//
+// Set up tiered execution of a loaded program: the stubs, the cells
+// of the functions and the worker thread.
+//
+int jit_start(struct machine *m)
+{
+    struct jit *jit = calloc(1, sizeof(struct jit));
+    unsigned char *stub;
+    uint64_t gate = (uintptr_t) jit_gate;
+    uint32_t i;
+
+    jit->cells = calloc(m->num_functions, sizeof(void*));
+    jit->queue = calloc(m->num_functions, sizeof(uint32_t));
+    jit->stubs_size = m->num_functions * STUB_SIZE;
+    jit->stubs = mmap(NULL, jit->stubs_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    m->jit = jit;
+    if (jit->stubs == MAP_FAILED) {
+        jit->stubs = NULL;
+        eprintf(m->args->arg0, "cannot map code: %s\n", strerror(errno));
+        return 1;
+    }
+
+    /* mov $function, %eax; movabs $jit_gate, %r11; jmp *%r11 */
+    for (i = 0; i < m->num_functions; i++) {
+        stub = jit->stubs + i * STUB_SIZE;
+        stub[0] = 0xb8;
+        memcpy(stub + 1, &i, 4);
+        stub[5] = 0x49;
+        stub[6] = 0xbb;
+        memcpy(stub + 7, &gate, 8);
+        stub[15] = 0x41;
+        stub[16] = 0xff;
+        stub[17] = 0xe3;
+        jit->cells[i] = stub;
+    }
+    if (mprotect(jit->stubs, jit->stubs_size, PROT_READ | PROT_EXEC) != 0) {
+        eprintf(m->args->arg0, "cannot map code: %s\n", strerror(errno));
+        return 1;
+    }
+
+    jit_machine = m;
+    pthread_mutex_init(&jit->lock, NULL);
+    pthread_cond_init(&jit->wake, NULL);
+    if (pthread_create(&jit->worker, NULL, worker, m) != 0) {
+        eprintf(m->args->arg0, "cannot start the JIT thread\n");
+        return 1;
+    }
+    jit->running = true;
+    return 0;
+}
+
+//
+// Stop the worker, after the function it compiles, and release
+// the native code.
+//
+void jit_stop(struct machine *m)
+{
+    struct jit *jit = m->jit;
+    struct jit_code *code;
+    size_t i;
+
+    if (!jit)
+        return;
+    if (jit->running) {
+        pthread_mutex_lock(&jit->lock);
+        jit->stop = true;
+        pthread_cond_signal(&jit->wake);
+        pthread_mutex_unlock(&jit->lock);
+        pthread_join(jit->worker, NULL);
+    }
+    if (jit_machine == m) {
+        pthread_cond_destroy(&jit->wake);
+        pthread_mutex_destroy(&jit->lock);
+    }
+    for (i = 0; i < jit->code.size; i++) {
+        code = jit->code.data[i];
+        munmap(code->addr, code->size);
+        free(code);
+    }
+    list_free(&jit->code);
+    if (jit->stubs)
+        munmap(jit->stubs, jit->stubs_size);
+    free(jit->queue);
+    free(jit->cells);
+    free(jit);
+    m->jit = NULL;
+    jit_machine = NULL;
+}
@@ -22,4 +22,5 @@ void list_free(struct list *list)
 {
     if(list->alloc)
         free(list->data);
+    memset(list, 0, sizeof(struct list));
 }
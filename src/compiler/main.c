@@ -2,13 +2,22 @@
 #include <string.h>
 #include <stdarg.h>
 #include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <limits.h>
 
 #include "compiler.h"
+#include "optimize.h"
+#include "stack.h"
 
 #ifndef BCAUSE_VERSION
     #define BCAUSE_VERSION "0.1"
 #endif
 
+/* alignment of functions and loops at -O2, and the largest one accepted */
+#define DEFAULT_ALIGNMENT 16
+#define MAX_ALIGNMENT     4096
+
 static inline void version(char *arg0)
 {
     printf("%s " BCAUSE_VERSION "\n"
@@ -30,7 +39,54 @@ static inline void help(char *arg0)
         "-L<dir>     Location of B library.\n"
 	"-S          Compile only; do not assemble or link.\n"
         "-c          Compile and assemble, but do not link.\n"
-        "-save-temps Do not delete intermediate files.\n",
+        "-save-temps Do not delete intermediate files.\n"
+        "--emit-bytecode\n"
+        "            Write the program as bytecode instead of an executable.\n"
+        "--interp    Run the program, or a bytecode file, with the interpreter.\n"
+        "--jit       Interpret, and compile hot functions to native code meanwhile.\n"
+        "            Needs the assembler as; without it everything is interpreted.\n"
+        "-mword=<n>  Use <n>-bit words, 32 or 64 (default).\n"
+        "-mpopcnt, -mlzcnt, -mbmi\n"
+        "            Use popcnt, lzcnt or tzcnt for the builtins popcnt, clz and ctz.\n"
+        "-O<n>       Optimization level, 0, 1 (default) or 2.\n"
+        "-fomit-frame-pointer\n"
+        "            Address locals from %%rsp, default at -O2.\n"
+        "-funroll-loops\n"
+        "            Unroll counted while loops.\n"
+        "-fspecialize\n"
+        "            Clone functions for constant call arguments, default at -O2.\n"
+        "-finternal-calls\n"
+        "            Pass arguments on the stack to functions of the program, default at -O2.\n"
+        "-freorder-functions\n"
+        "            Lay out functions by call-graph affinity, default at -O2.\n"
+        "-falign-functions[=<n>]\n"
+        "            Align function entries to <n> bytes, 16 at -O2.\n"
+        "-falign-loops[=<n>]\n"
+        "            Align loop heads to <n> bytes, 16 at -O2.\n"
+        "-fhuge-pages\n"
+        "            Back the text and big data of the program by huge pages.\n"
+        "--param <name>=<n>\n"
+        "            Set a parameter: unroll (copies of an unrolled body),\n"
+        "            max-unrolled-insns (size limit of an unrolled loop),\n"
+        "            max-specializations (clones per function),\n"
+        "            specialize-min-calls (call sites needed for a clone),\n"
+        "            max-specialize-insns (size limit of a cloned function),\n"
+        "            jit-threshold (calls and loop iterations making a function hot),\n"
+        "            threads (threads optimizing functions, 0 for one per processor).\n"
+        "-Rpass=<regex>\n"
+        "            Report optimizations done by the passes matching <regex>.\n"
+        "-Rpass-missed=<regex>\n"
+        "            Report optimizations missed by the passes matching <regex>, and why.\n"
+        "-fsave-optimization-record\n"
+        "            Write all optimization remarks to <output>.opt.yaml.\n"
+        "-fstack-usage\n"
+        "            Write the stack usage and the callees of every function to <output>.su.\n"
+        "--stack-bound\n"
+        "            Combine the .su files given as input into the stack bound of every function.\n"
+        "--print-after=<pass>\n"
+        "            Dump the code of each function after <pass>.\n"
+        "--cache-dir=<dir>\n"
+        "            Reuse the code of unchanged functions from <dir>.\n",
         arg0
     );
 }
@@ -46,6 +102,75 @@ static inline void set_default_args(struct compiler_args *args, const char *arg0
     args->input_files = input_files;
     args->do_assembling = args->do_linking = true;
     args->word_size = X86_64_WORD_SIZE;
+    args->opt_level = 1;
+    args->unroll_factor = 4;
+    args->max_unrolled_insns = 200;
+    args->max_specializations = 2;
+    args->specialize_min_calls = 2;
+    args->max_specialize_insns = 300;
+    args->jit_threshold = 1000;
+}
+
+/* set a tuning parameter given as name=value */
+static int set_param(struct compiler_args *args, const char *param)
+{
+    static const struct {
+        const char *name;
+        size_t offset;
+    } params[] = {
+        { "unroll",             offsetof(struct compiler_args, unroll_factor) },
+        { "max-unrolled-insns", offsetof(struct compiler_args, max_unrolled_insns) },
+        { "max-specializations", offsetof(struct compiler_args, max_specializations) },
+        { "specialize-min-calls", offsetof(struct compiler_args, specialize_min_calls) },
+        { "max-specialize-insns", offsetof(struct compiler_args, max_specialize_insns) },
+        { "jit-threshold",      offsetof(struct compiler_args, jit_threshold) },
+        { "threads",            offsetof(struct compiler_args, threads) },
+    };
+    const char *value = strchr(param, '=');
+    char *end;
+    unsigned long number;
+    size_t i;
+
+    if (!value)
+        return -1;
+    number = strtoul(value + 1, &end, 10);
+    if (value[1] == '\0' || *end || number > UINT_MAX)
+        return -1;
+
+    for (i = 0; i < sizeof(params) / sizeof(params[0]); i++) {
+        if (strlen(params[i].name) == (size_t) (value - param) &&
+            strncmp(param, params[i].name, value - param) == 0) {
+            *(unsigned*) ((char*) args + params[i].offset) = number;
+            return 0;
+        }
+    }
+    return -1;
+}
+
+/* parse the value of -falign-functions or -falign-loops: a power of two */
+static long alignment(const char *arg0, const char *value)
+{
+    char *end;
+    unsigned long n;
+
+    if (!*value)
+        return DEFAULT_ALIGNMENT;
+    n = strtoul(value + 1, &end, 10);
+    if (value[1] == '\0' || *end || n == 0 || n > MAX_ALIGNMENT || (n & (n - 1))) {
+        eprintf(arg0, "invalid alignment " QUOTE_FMT("%s") ", expect a power of two up to %d\n", value + 1, MAX_ALIGNMENT);
+        return -1;
+    }
+    return n;
+}
+
+/* compile the pattern of -Rpass or -Rpass-missed */
+static regex_t *remark_filter(const char *arg0, regex_t *filter, const char *pattern)
+{
+    if(regcomp(filter, pattern, REG_EXTENDED | REG_NOSUB) != 0) {
+        eprintf(arg0, "invalid regular expression " QUOTE_FMT("%s") "\n", pattern);
+        return NULL;
+    }
+    return filter;
 }
 
 int main(int argc, char **argv)
@@ -54,6 +179,12 @@ int main(int argc, char **argv)
 
     struct compiler_args c_args;
     set_default_args(&c_args, argv[0], input_files);
+    int omit_frame_pointer = -1;
+    int specialize = -1;
+    int internal_calls = -1;
+    int reorder_functions = -1;
+    long align_functions = -1, align_loops = -1;
+    regex_t rpass, rpass_missed;
 
     for(int i = 1; i < argc; i++)
     {
@@ -86,6 +217,101 @@ int main(int argc, char **argv)
         }
         else if(strcmp(argv[i], "-save-temps") == 0)
             c_args.save_temps = true;
+        else if(strcmp(argv[i], "--emit-bytecode") == 0)
+            c_args.emit_bytecode = true;
+        else if(strcmp(argv[i], "--interp") == 0)
+            c_args.interpret = true;
+        else if(strcmp(argv[i], "--jit") == 0)
+            c_args.interpret = c_args.jit = true;
+        else if(strcmp(argv[i], "-mword=32") == 0)
+            c_args.word_size = X86_64_WORD32_SIZE;
+        else if(strcmp(argv[i], "-mword=64") == 0)
+            c_args.word_size = X86_64_WORD_SIZE;
+        else if(strcmp(argv[i], "-mpopcnt") == 0)
+            c_args.popcnt = true;
+        else if(strcmp(argv[i], "-mno-popcnt") == 0)
+            c_args.popcnt = false;
+        else if(strcmp(argv[i], "-mlzcnt") == 0)
+            c_args.lzcnt = true;
+        else if(strcmp(argv[i], "-mno-lzcnt") == 0)
+            c_args.lzcnt = false;
+        else if(strcmp(argv[i], "-mbmi") == 0)
+            c_args.bmi = true;
+        else if(strcmp(argv[i], "-mno-bmi") == 0)
+            c_args.bmi = false;
+        else if(strcmp(argv[i], "-O") == 0)
+            c_args.opt_level = 1;
+        else if(strncmp(argv[i], "-O", 2) == 0 && argv[i][2] >= '0' && argv[i][2] <= '2' && !argv[i][3])
+            c_args.opt_level = argv[i][2] - '0';
+        else if(strcmp(argv[i], "-funroll-loops") == 0)
+            c_args.unroll_loops = true;
+        else if(strcmp(argv[i], "-fno-unroll-loops") == 0)
+            c_args.unroll_loops = false;
+        else if(strcmp(argv[i], "--param") == 0) {
+            if(argc - i <= 1) {
+                eprintf(argv[0], "missing argument after " QUOTE_FMT("%s") "\n", argv[i]);
+                return 1;
+            }
+            if(set_param(&c_args, argv[++i])) {
+                eprintf(argv[0], "invalid parameter " QUOTE_FMT("%s") "\n", argv[i]);
+                return 1;
+            }
+        }
+        else if(strcmp(argv[i], "-fomit-frame-pointer") == 0)
+            omit_frame_pointer = 1;
+        else if(strcmp(argv[i], "-fno-omit-frame-pointer") == 0)
+            omit_frame_pointer = 0;
+        else if(strcmp(argv[i], "-fspecialize") == 0)
+            specialize = 1;
+        else if(strcmp(argv[i], "-fno-specialize") == 0)
+            specialize = 0;
+        else if(strcmp(argv[i], "-finternal-calls") == 0)
+            internal_calls = 1;
+        else if(strcmp(argv[i], "-fno-internal-calls") == 0)
+            internal_calls = 0;
+        else if(strcmp(argv[i], "-freorder-functions") == 0)
+            reorder_functions = 1;
+        else if(strcmp(argv[i], "-fno-reorder-functions") == 0)
+            reorder_functions = 0;
+        else if(strncmp(argv[i], "-falign-functions", 17) == 0 && (!argv[i][17] || argv[i][17] == '=')) {
+            if((align_functions = alignment(argv[0], argv[i] + 17)) < 0)
+                return 1;
+        }
+        else if(strcmp(argv[i], "-fno-align-functions") == 0)
+            align_functions = 0;
+        else if(strncmp(argv[i], "-falign-loops", 13) == 0 && (!argv[i][13] || argv[i][13] == '=')) {
+            if((align_loops = alignment(argv[0], argv[i] + 13)) < 0)
+                return 1;
+        }
+        else if(strcmp(argv[i], "-fno-align-loops") == 0)
+            align_loops = 0;
+        else if(strcmp(argv[i], "-fhuge-pages") == 0)
+            c_args.huge_pages = true;
+        else if(strcmp(argv[i], "-fno-huge-pages") == 0)
+            c_args.huge_pages = false;
+        else if(strncmp(argv[i], "-Rpass=", 7) == 0) {
+            if(!(c_args.rpass = remark_filter(argv[0], &rpass, argv[i] + 7)))
+                return 1;
+        }
+        else if(strncmp(argv[i], "-Rpass-missed=", 14) == 0) {
+            if(!(c_args.rpass_missed = remark_filter(argv[0], &rpass_missed, argv[i] + 14)))
+                return 1;
+        }
+        else if(strcmp(argv[i], "-fsave-optimization-record") == 0)
+            c_args.save_remarks = true;
+        else if(strcmp(argv[i], "-fstack-usage") == 0)
+            c_args.stack_usage = true;
+        else if(strcmp(argv[i], "--stack-bound") == 0)
+            c_args.stack_bound = true;
+        else if(strncmp(argv[i], "--print-after=", 14) == 0) {
+            c_args.print_after = argv[i] + 14;
+            if(!optimize_pass_exists(c_args.print_after)) {
+                eprintf(argv[0], "unknown optimization pass " QUOTE_FMT("%s") "\n", c_args.print_after);
+                return 1;
+            }
+        }
+        else if(strncmp(argv[i], "--cache-dir=", 12) == 0 && argv[i][12])
+            c_args.cache_dir = argv[i] + 12;
         else if(argv[i][0] == '-') {
             eprintf(argv[0], "unrecognized command-line option " QUOTE_FMT("%s") "\n", argv[i]);
             return 1;
@@ -94,10 +320,28 @@ int main(int argc, char **argv)
             c_args.input_files[c_args.num_input_files++] = argv[i];
     }
 
+    c_args.omit_frame_pointer = omit_frame_pointer < 0 ? c_args.opt_level >= 2 : omit_frame_pointer;
+    c_args.specialize = specialize < 0 ? c_args.opt_level >= 2 : specialize;
+    c_args.internal_calls = internal_calls < 0 ? c_args.opt_level >= 2 : internal_calls;
+    c_args.reorder_functions = reorder_functions < 0 ? c_args.opt_level >= 2 : reorder_functions;
+    c_args.align_functions = align_functions < 0 ? (c_args.opt_level >= 2 ? DEFAULT_ALIGNMENT : 0) : align_functions;
+    c_args.align_loops = align_loops < 0 ? (c_args.opt_level >= 2 ? DEFAULT_ALIGNMENT : 0) : align_loops;
+
+    if((c_args.emit_bytecode || c_args.interpret) && c_args.word_size != X86_64_WORD_SIZE) {
+        eprintf(argv[0], "bytecode needs 64-bit words\n");
+        return 1;
+    }
+    if((c_args.emit_bytecode || c_args.interpret) && !c_args.do_linking) {
+        eprintf(argv[0], "bytecode holds a whole program, cannot be used with " QUOTE_FMT("-S") " or " QUOTE_FMT("-c") "\n");
+        return 1;
+    }
+
     if(!c_args.num_input_files) {
         eprintf(argv[0], "no input files\ncompilation terminated.\n");
         return 1;
     }
 
+    if(c_args.stack_bound)
+        return stack_bound(&c_args);
     return compile(&c_args);
 }
@@ -0,0 +1,131 @@
+//
+// Binding of the B library to the interpreter: libb is compiled
+// into the compiler with prefixed names, and each function gets
+// a wrapper taking the six argument registers.
+//
+#include "bytecode.h"
+
+#include <stdlib.h>
+
+#pragma GCC diagnostic ignored "-Wbuiltin-declaration-mismatch"
+#pragma GCC diagnostic ignored "-Wunused-function"
+
+/* libb names the standard files by their descriptors */
+#undef stdin
+#undef stdout
+#undef stderr
+
+#define B_FN(name) libb_##name
+#define B_NO_START
+#include "../libb/libb.c"
+
+#define BIND(name, call) \
+    static int64_t bind_##name(int64_t a, int64_t b, int64_t c, int64_t d, int64_t e, int64_t f) \
+    { \
+        (void) a; (void) b; (void) c; (void) d; (void) e; (void) f; \
+        return (int64_t) call; \
+    }
+
+#define BIND_VOID(name, call) \
+    static int64_t bind_##name(int64_t a, int64_t b, int64_t c, int64_t d, int64_t e, int64_t f) \
+    { \
+        (void) a; (void) b; (void) c; (void) d; (void) e; (void) f; \
+        call; \
+        return 0; \
+    }
+
+BIND(char, libb__char(a, b))
+BIND(chdir, libb_chdir(a))
+BIND(chmod, libb_chmod(a, b))
+BIND(chown, libb_chown(a, b))
+BIND(close, libb_close(a))
+BIND(creat, libb_creat(a, b))
+BIND_VOID(ctime, libb_ctime(a, b))
+BIND_VOID(execl, libb_execl(a, b, c, d, e, f))
+BIND_VOID(execv, libb_execv(a, b, c))
+BIND_VOID(exit, _Exit(0))     /* all threads, libb only ends the calling one */
+BIND(fork, libb_fork())
+BIND(fstat, libb_fstat(a, b))
+BIND(getchar, libb_getchar())
+BIND(getuid, libb_getuid())
+BIND(gtty, libb_gtty(a, b))
+BIND_VOID(lchar, libb_lchar(a, b, c))
+BIND(link, libb_link(a, b))
+BIND(mkdir, libb_mkdir(a, b))
+BIND(open, libb_open(a, b))
+BIND_VOID(printf, libb_printf(a, b, c, d, e, f))
+BIND_VOID(printn, libb_printn(a, b))
+BIND_VOID(putchar, libb_putchar(a))
+BIND(nread, libb_nread(a, b, c))
+BIND(seek, libb_seek(a, b, c))
+BIND(setuid, libb_setuid(a))
+BIND(stat, libb_stat(a, b))
+BIND(stty, libb_stty(a, b))
+BIND_VOID(time, libb_time(a))
+BIND(unlink, libb_unlink(a))
+BIND(wait, libb_wait())
+BIND(nwrite, libb_nwrite(a, b, c))
+BIND_VOID(vbegin, libb_vbegin(a))
+BIND_VOID(vwrite, libb_vwrite(a, b))
+BIND_VOID(vputs, libb_vputs(a))
+BIND_VOID(vputchar, libb_vputchar(a))
+BIND_VOID(vprintn, libb_vprintn(a, b))
+BIND(vflush, libb_vflush())
+BIND(vsum, libb_vsum(a, b))
+BIND(vmin, libb_vmin(a, b))
+BIND(vmax, libb_vmax(a, b))
+BIND(vdot, libb_vdot(a, b, c))
+BIND_VOID(vaxpy, libb_vaxpy(a, b, c, d))
+BIND(vcount, libb_vcount(a, b, c))
+BIND(vcountle, libb_vcountle(a, b, c))
+
+#define NATIVE(name) { #name, bind_##name },
+
+const struct bc_native bc_natives[] = {
+    NATIVE(char)
+    NATIVE(chdir)
+    NATIVE(chmod)
+    NATIVE(chown)
+    NATIVE(close)
+    NATIVE(creat)
+    NATIVE(ctime)
+    NATIVE(execl)
+    NATIVE(execv)
+    NATIVE(exit)
+    NATIVE(fork)
+    NATIVE(fstat)
+    NATIVE(getchar)
+    NATIVE(getuid)
+    NATIVE(gtty)
+    NATIVE(lchar)
+    NATIVE(link)
+    NATIVE(mkdir)
+    NATIVE(open)
+    NATIVE(printf)
+    NATIVE(printn)
+    NATIVE(putchar)
+    NATIVE(nread)
+    NATIVE(seek)
+    NATIVE(setuid)
+    NATIVE(stat)
+    NATIVE(stty)
+    NATIVE(time)
+    NATIVE(unlink)
+    NATIVE(wait)
+    NATIVE(nwrite)
+    NATIVE(vbegin)
+    NATIVE(vwrite)
+    NATIVE(vputs)
+    NATIVE(vputchar)
+    NATIVE(vprintn)
+    NATIVE(vflush)
+    NATIVE(vsum)
+    NATIVE(vmin)
+    NATIVE(vmax)
+    NATIVE(vdot)
+    NATIVE(vaxpy)
+    NATIVE(vcount)
+    NATIVE(vcountle)
+};
+
+const size_t bc_num_natives = sizeof(bc_natives) / sizeof(bc_natives[0]);
@@ -0,0 +1,2179 @@
+#define _XOPEN_SOURCE 700
+#include <stdio.h>
+#undef _XOPEN_SOURCE
+
+#include "optimize.h"
+#include "compiler.h"
+
+#include <pthread.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#define MAX_MNEMONIC 16
+#define MAX_THREADS  64
+
+//
+// Split generated code into lines.
+//
+void function_code_parse(struct function_code *fn, const char *name, const char *text)
+{
+    const char *end;
+
+    memset(fn, 0, sizeof(struct function_code));
+    fn->name = name;
+
+    while (*text) {
+        if (!(end = strchr(text, '\n')))
+            end = text + strlen(text);
+        list_push(&fn->lines, strndup(text, end - text));
+        text = *end ? end + 1 : end;
+    }
+}
+
+//
+// Write the lines back as assembly code.
+//
+void function_code_write(struct function_code *fn, FILE *out)
+{
+    size_t i;
+
+    for (i = 0; i < fn->lines.size; i++)
+        fprintf(out, "%s\n", (char*) fn->lines.data[i]);
+}
+
+//
+// Deallocate the lines.
+//
+void function_code_free(struct function_code *fn)
+{
+    size_t i;
+
+    for (i = 0; i < fn->lines.size; i++)
+        free(fn->lines.data[i]);
+    list_free(&fn->lines);
+}
+
+//
+// Check whether a line is a label.
+//
+static bool is_label(const char *line)
+{
+    size_t len = strlen(line);
+
+    return len > 1 && line[0] != ' ' && line[len - 1] == ':';
+}
+
+//
+// Check whether a line is the given label.
+//
+static bool is_label_of(const char *line, const char *name)
+{
+    size_t len = strlen(name);
+
+    return strncmp(line, name, len) == 0 && line[len] == ':' && line[len + 1] == '\0';
+}
+
+//
+// Split an instruction into mnemonic and operands.
+// Return false for labels and directives.
+//
+static bool instruction(const char *line, char *mnemonic, const char **operands)
+{
+    size_t len = 0;
+
+    if (line[0] != ' ')
+        return false;
+    while (*line == ' ')
+        line++;
+    while (line[len] && line[len] != ' ' && len < MAX_MNEMONIC - 1) {
+        mnemonic[len] = line[len];
+        len++;
+    }
+    mnemonic[len] = '\0';
+
+    line += len;
+    while (*line == ' ')
+        line++;
+    *operands = line;
+    return true;
+}
+
+//
+// Return the target of a jump instruction, or NULL.
+// Set *is_conditional for conditional jumps.
+//
+static const char *jump_target(const char *line, bool *is_conditional)
+{
+    char mnemonic[MAX_MNEMONIC];
+    const char *operands;
+
+    if (!instruction(line, mnemonic, &operands) || mnemonic[0] != 'j')
+        return NULL;
+    *is_conditional = strcmp(mnemonic, "jmp") != 0;
+    return operands;
+}
+
+//
+// Check whether control never falls through to the next line.
+//
+static bool is_terminator(const char *line)
+{
+    char mnemonic[MAX_MNEMONIC];
+    const char *operands;
+
+    return instruction(line, mnemonic, &operands) &&
+        (strcmp(mnemonic, "jmp") == 0 || strcmp(mnemonic, "ret") == 0);
+}
+
+//
+// Find the line of a label.
+//
+static long find_label(struct function_code *fn, const char *name)
+{
+    size_t i;
+
+    for (i = 0; i < fn->lines.size; i++)
+        if (is_label_of(fn->lines.data[i], name))
+            return i;
+    return -1;
+}
+
+//
+// Remove lines which were set to NULL.
+//
+static void compact(struct function_code *fn)
+{
+    size_t i, n = 0;
+
+    for (i = 0; i < fn->lines.size; i++)
+        if (fn->lines.data[i])
+            fn->lines.data[n++] = fn->lines.data[i];
+    fn->lines.size = n;
+}
+
+//
+// Delete a line.
+//
+static void delete_line(struct function_code *fn, size_t i)
+{
+    free(fn->lines.data[i]);
+    fn->lines.data[i] = NULL;
+}
+
+//
+// Remove code which cannot be reached from the function entry.
+// Control flow is followed through fall-through and jumps.
+//
+static bool remove_unreachable(struct function_code *fn)
+{
+    size_t n = fn->lines.size, top = 0, i;
+    bool *reachable = calloc(n + 1, sizeof(bool));
+    size_t *work = malloc((n + 1) * sizeof(size_t));
+    bool is_conditional, changed = false;
+    const char *target;
+    long j;
+
+    work[top++] = 0;
+    while (top) {
+        for (i = work[--top]; i < n && !reachable[i]; i++) {
+            reachable[i] = true;
+            if ((target = jump_target(fn->lines.data[i], &is_conditional))) {
+                if ((j = find_label(fn, target)) < 0) {
+                    /* unknown destination, keep everything */
+                    free(reachable);
+                    free(work);
+                    return false;
+                }
+                work[top++] = j;
+            }
+            if (is_terminator(fn->lines.data[i]))
+                break;
+        }
+    }
+
+    for (i = 0; i < n; i++) {
+        /* labels and directives are left for the other passes */
+        if (!reachable[i] && ((char*) fn->lines.data[i])[0] == ' ') {
+            delete_line(fn, i);
+            changed = true;
+        }
+    }
+    compact(fn);
+
+    free(reachable);
+    free(work);
+    return changed;
+}
+
+//
+// Remove jumps to a label that directly follows.
+//
+static bool remove_jumps_to_next(struct function_code *fn)
+{
+    size_t i, j;
+    bool is_conditional, changed = false;
+    const char *target;
+
+    for (i = 0; i < fn->lines.size; i++) {
+        if (!(target = jump_target(fn->lines.data[i], &is_conditional)))
+            continue;
+        for (j = i + 1; j < fn->lines.size && is_label(fn->lines.data[j]); j++) {
+            if (is_label_of(fn->lines.data[j], target)) {
+                delete_line(fn, i);
+                changed = true;
+                break;
+            }
+        }
+    }
+    compact(fn);
+    return changed;
+}
+
+//
+// Remove local labels which are not a jump target.
+//
+static bool remove_unused_labels(struct function_code *fn)
+{
+    size_t i, j;
+    bool is_conditional, used, changed = false;
+    const char *line, *target;
+
+    for (i = 0; i < fn->lines.size; i++) {
+        line = fn->lines.data[i];
+        if (!is_label(line) || strncmp(line, ".L.", 3) != 0)
+            continue;
+
+        used = false;
+        for (j = 0; j < fn->lines.size && !used; j++) {
+            target = fn->lines.data[j] ? jump_target(fn->lines.data[j], &is_conditional) : NULL;
+            used = target && is_label_of(line, target);
+        }
+        if (!used) {
+            delete_line(fn, i);
+            changed = true;
+        }
+    }
+    compact(fn);
+    return changed;
+}
+
+//
+// Check whether an instruction sets %rax without reading it
+// or having another effect.
+//
+static bool defines_rax_only(const char *line)
+{
+    char mnemonic[MAX_MNEMONIC];
+    const char *operands, *reg;
+    size_t len;
+
+    if (!instruction(line, mnemonic, &operands))
+        return false;
+    if (strcmp(mnemonic, "xor") == 0)
+        return strcmp(operands, "%rax, %rax") == 0;
+    if (strcmp(mnemonic, "mov") != 0 && strcmp(mnemonic, "lea") != 0)
+        return false;
+
+    len = strlen(operands);
+    if (len < 6 || strcmp(operands + len - 6, ", %rax") != 0)
+        return false;
+
+    /* the source is an immediate, another register or a frame or rip-relative address */
+    if (operands[0] == '$')
+        return !strchr(operands, '(');
+    if (operands[0] == '%')
+        return strcmp(mnemonic, "mov") == 0 && !strchr(operands, '(') &&
+            strncmp(operands, "%rax", 4) != 0 && strncmp(operands, "%eax", 4) != 0;
+    reg = strchr(operands, '%');
+    return reg + 7 == operands + len - 4 &&
+        (strncmp(reg, "%rbp), ", 7) == 0 || strncmp(reg, "%rip), ", 7) == 0);
+}
+
+//
+// Check whether an instruction loads %rax from the address in %rax.
+//
+static bool is_rax_load(const char *line)
+{
+    char mnemonic[MAX_MNEMONIC];
+    const char *operands;
+
+    return instruction(line, mnemonic, &operands) &&
+        (strcmp(mnemonic, "mov") == 0 || strcmp(mnemonic, "movslq") == 0) &&
+        strcmp(operands, "(%rax), %rax") == 0;
+}
+
+//
+// Remove instructions setting %rax when the next one sets it again.
+// A load whose result is never used is removed as well.
+//
+static bool remove_dead_rax(struct function_code *fn)
+{
+    size_t i;
+    bool changed = false;
+
+    for (i = 0; i + 1 < fn->lines.size; i++) {
+        if ((defines_rax_only(fn->lines.data[i]) || is_rax_load(fn->lines.data[i])) &&
+            defines_rax_only(fn->lines.data[i + 1])) {
+            delete_line(fn, i);
+            changed = true;
+        }
+    }
+    compact(fn);
+    return changed;
+}
+
+//
+// Return the frame offset of a local referenced in a line, or 0.
+//
+static unsigned long frame_slot(const char *line)
+{
+    const char *p = strstr(line, "(%rbp)");
+
+    if (!p)
+        return 0;
+    while (p > line && p[-1] >= '0' && p[-1] <= '9')
+        p--;
+    if (p == line || p[-1] != '-')
+        return 0;
+    return strtoul(p, NULL, 10);
+}
+
+//
+// Check whether a line stores a register into a local.
+//
+static bool is_frame_store(const char *line)
+{
+    char mnemonic[MAX_MNEMONIC];
+    const char *operands;
+
+    return instruction(line, mnemonic, &operands) &&
+        strcmp(mnemonic, "mov") == 0 && operands[0] == '%' &&
+        strstr(operands, ", -") && frame_slot(operands);
+}
+
+//
+// Remove stores to local variables which are never read.
+// Only valid when no local has its address taken.
+//
+static bool remove_dead_stores(struct function_code *fn)
+{
+    size_t i, j;
+    struct list live = {0};
+    unsigned long slot;
+    bool is_live, changed = false;
+
+    if (fn->address_taken)
+        return false;
+
+    for (i = 0; i < fn->lines.size; i++)
+        if (!is_frame_store(fn->lines.data[i]) && (slot = frame_slot(fn->lines.data[i])))
+            list_push(&live, (void*) (uintptr_t) slot);
+
+    for (i = 0; i < fn->lines.size; i++) {
+        if (!is_frame_store(fn->lines.data[i]))
+            continue;
+        slot = frame_slot(fn->lines.data[i]);
+        is_live = false;
+        for (j = 0; j < live.size && !is_live; j++)
+            is_live = (uintptr_t) live.data[j] == slot;
+        if (!is_live) {
+            delete_line(fn, i);
+            changed = true;
+        }
+    }
+    compact(fn);
+    list_free(&live);
+    return changed;
+}
+
+//
+// Replace a line with new text.
+//
+static void replace_line(struct function_code *fn, size_t i, const char *text)
+{
+    free(fn->lines.data[i]);
+    fn->lines.data[i] = strdup(text);
+}
+
+//
+// Insert a line before line i.
+//
+static void insert_line(struct function_code *fn, size_t i, const char *text)
+{
+    list_push(&fn->lines, NULL);
+    memmove(&fn->lines.data[i + 1], &fn->lines.data[i], (fn->lines.size - 1 - i) * sizeof(void*));
+    fn->lines.data[i] = strdup(text);
+}
+
+//
+// Find the first instruction at a label, skipping other labels.
+// Return -1 when there is none.
+//
+static long label_code(struct function_code *fn, const char *name)
+{
+    long i = find_label(fn, name);
+
+    while (i >= 0 && (size_t) i < fn->lines.size && is_label(fn->lines.data[i]))
+        i++;
+    return i >= 0 && (size_t) i < fn->lines.size ? i : -1;
+}
+
+#define MAX_THREAD_HOPS 16
+
+//
+// Retarget jumps whose destination is an unconditional jump,
+// as when nested statements end at the same place.
+//
+static bool thread_jumps(struct function_code *fn)
+{
+    size_t i;
+    int hops;
+    long j;
+    bool is_conditional, changed = false;
+    char mnemonic[MAX_MNEMONIC], text[BUFSIZ];
+    const char *operands, *target, *next;
+
+    for (i = 0; i < fn->lines.size; i++) {
+        if (!(target = jump_target(fn->lines.data[i], &is_conditional)))
+            continue;
+        for (hops = 0; hops < MAX_THREAD_HOPS; hops++) {
+            if ((j = label_code(fn, target)) < 0 || (size_t) j == i ||
+                !(next = jump_target(fn->lines.data[j], &is_conditional)) ||
+                is_conditional || strcmp(next, target) == 0)
+                break;
+            target = next;
+        }
+        if (hops) {
+            instruction(fn->lines.data[i], mnemonic, &operands);
+            snprintf(text, sizeof(text), "  %s %s", mnemonic, target);
+            replace_line(fn, i, text);
+            changed = true;
+        }
+    }
+    return changed;
+}
+
+//
+// Conditional jumps and their inverses.
+//
+static const char *inverse_jumps[][2] = {
+    { "je",  "jne" },
+    { "jl",  "jge" },
+    { "jle", "jg"  },
+    { "jb",  "jae" },
+    { "jbe", "ja"  },
+    { "jc",  "jnc" },
+    { "js",  "jns" },
+};
+
+static const char *inverse_jump(const char *mnemonic)
+{
+    size_t i;
+
+    for (i = 0; i < sizeof(inverse_jumps) / sizeof(inverse_jumps[0]); i++) {
+        if (strcmp(mnemonic, inverse_jumps[i][0]) == 0)
+            return inverse_jumps[i][1];
+        if (strcmp(mnemonic, inverse_jumps[i][1]) == 0)
+            return inverse_jumps[i][0];
+    }
+    return NULL;
+}
+
+//
+// Invert a conditional jump over an unconditional one, so that
+// the path taken falls through:
+//      jcc 1f; jmp 2f; 1:  ->  jncc 2f; 1:
+//
+static bool invert_branches(struct function_code *fn)
+{
+    size_t i, j;
+    bool is_conditional, changed = false;
+    char mnemonic[MAX_MNEMONIC], text[BUFSIZ];
+    const char *operands, *target, *other, *inverse;
+
+    for (i = 0; i + 2 < fn->lines.size; i++) {
+        if (!(target = jump_target(fn->lines.data[i], &is_conditional)) || !is_conditional ||
+            !(other = jump_target(fn->lines.data[i + 1], &is_conditional)) || is_conditional)
+            continue;
+        for (j = i + 2; j < fn->lines.size && is_label(fn->lines.data[j]); j++)
+            if (is_label_of(fn->lines.data[j], target))
+                break;
+        instruction(fn->lines.data[i], mnemonic, &operands);
+        if (j == fn->lines.size || !is_label(fn->lines.data[j]) || !(inverse = inverse_jump(mnemonic)))
+            continue;
+
+        snprintf(text, sizeof(text), "  %s %s", inverse, other);
+        replace_line(fn, i, text);
+        delete_line(fn, i + 1);
+        changed = true;
+        i++;
+    }
+    compact(fn);
+    return changed;
+}
+
+//
+// An edge into a label: an unconditional jump, or falling through.
+//
+struct edge {
+    long end;       /* last line of the code before the edge */
+    long dest;      /* first instruction at the destination */
+    bool is_jump;   /* the line after end is the jump */
+};
+
+//
+// Count identical instructions ending at two lines, a after b.
+// Labels stop the count, and the two pieces may not overlap.
+//
+static long common_tail(struct function_code *fn, long a, long b)
+{
+    long n = 0;
+    const char *x, *y;
+
+    while (b - n >= 0 && a - n > b) {
+        x = fn->lines.data[a - n];
+        y = fn->lines.data[b - n];
+        if (x[0] != ' ' || strcmp(x, y) != 0 || is_terminator(x))
+            break;
+        n++;
+    }
+    return n;
+}
+
+#define MIN_TAIL_INSNS 2
+
+//
+// Find two edges to the same place preceded by the same code,
+// and make one of them jump into the other. Return false when
+// there is nothing to merge.
+//
+static bool merge_tail(struct function_code *fn, unsigned long *label_id)
+{
+    size_t i, p, q;
+    long n;
+    bool is_conditional;
+    const char *target;
+    char text[BUFSIZ];
+    struct edge edge, *keep, *copy;
+    struct list edges = {0};
+    bool merged = false;
+
+    for (i = 1; i < fn->lines.size; i++) {
+        edge.end = i - 1;
+        if ((target = jump_target(fn->lines.data[i], &is_conditional)) && !is_conditional) {
+            edge.dest = label_code(fn, target);
+            edge.is_jump = true;
+        }
+        else if (is_label(fn->lines.data[i]) && !is_label(fn->lines.data[i - 1]) &&
+                 ((char*) fn->lines.data[i - 1])[0] == ' ' && !is_terminator(fn->lines.data[i - 1])) {
+            for (edge.dest = i; (size_t) edge.dest < fn->lines.size && is_label(fn->lines.data[edge.dest]); edge.dest++)
+                ;
+            edge.is_jump = false;
+        }
+        else
+            continue;
+        if (edge.dest >= 0 && (size_t) edge.dest < fn->lines.size) {
+            list_push(&edges, malloc(sizeof(struct edge)));
+            *(struct edge*) edges.data[edges.size - 1] = edge;
+        }
+    }
+
+    for (q = 0; q < edges.size && !merged; q++) {
+        for (p = 0; p < q && !merged; p++) {
+            keep = edges.data[p];
+            copy = edges.data[q];
+            if (keep->dest != copy->dest ||
+                (n = common_tail(fn, copy->end, keep->end)) < MIN_TAIL_INSNS)
+                continue;
+            if (!copy->is_jump) {
+                /* the code falling through stays */
+                keep = edges.data[q];
+                copy = edges.data[p];
+            }
+
+            snprintf(text, sizeof(text), "  jmp .L.tail.%s.%lu", fn->name, *label_id);
+            replace_line(fn, copy->end + 1, text);
+            for (i = copy->end - n + 1; i <= (size_t) copy->end; i++)
+                delete_line(fn, i);
+            snprintf(text, sizeof(text), ".L.tail.%s.%lu:", fn->name, (*label_id)++);
+            insert_line(fn, keep->end - n + 1, text);
+            compact(fn);
+            merged = true;
+        }
+    }
+
+    for (i = 0; i < edges.size; i++)
+        free(edges.data[i]);
+    list_free(&edges);
+    return merged;
+}
+
+//
+// Merge identical code ending at the same place.
+//
+static bool merge_tails(struct function_code *fn)
+{
+    bool changed = false;
+
+    while (merge_tail(fn, &fn->next_label))
+        changed = true;
+    return changed;
+}
+
+//
+// Check whether an operand is a memory location addressed
+// relative to the frame or instruction pointer.
+//
+static bool is_named_memory(const char *operand)
+{
+    size_t len = strlen(operand);
+
+    return len > 6 && operand[0] != '(' &&
+        (strcmp(operand + len - 6, "(%rbp)") == 0 || strcmp(operand + len - 6, "(%rip)") == 0);
+}
+
+//
+// Fold a load through an address computed just before:
+//      lea X, %rax; mov (%rax), %rax   =>  mov X, %rax
+//      lea X, %rax; push (%rax)        =>  push X
+//
+static bool combine_loads(struct function_code *fn)
+{
+    size_t i, len;
+    bool changed = false;
+    char mnemonic[MAX_MNEMONIC], next[MAX_MNEMONIC], *text, *address;
+    const char *operands, *next_operands;
+
+    for (i = 0; i + 1 < fn->lines.size; i++) {
+        if (!instruction(fn->lines.data[i], mnemonic, &operands) || strcmp(mnemonic, "lea") != 0 ||
+            !instruction(fn->lines.data[i + 1], next, &next_operands))
+            continue;
+
+        len = strlen(operands);
+        if (len < 6 || strcmp(operands + len - 6, ", %rax") != 0)
+            continue;
+        address = strndup(operands, len - 6);
+        if (!is_named_memory(address)) {
+            free(address);
+            continue;
+        }
+
+        text = NULL;
+        if ((strcmp(next, "mov") == 0 || strcmp(next, "movslq") == 0) &&
+            strcmp(next_operands, "(%rax), %rax") == 0) {
+            text = malloc(strlen(address) + 32);
+            sprintf(text, "  %s %s, %%rax", next, address);
+        }
+        else if (strcmp(next, "push") == 0 && strcmp(next_operands, "(%rax)") == 0 &&
+            i + 2 < fn->lines.size && defines_rax_only(fn->lines.data[i + 2])) {
+            /* the address itself is not used afterwards */
+            text = malloc(strlen(address) + 32);
+            sprintf(text, "  push %s", address);
+        }
+        free(address);
+
+        if (text) {
+            delete_line(fn, i);
+            free(fn->lines.data[i + 1]);
+            fn->lines.data[i + 1] = text;
+            changed = true;
+            i++;
+        }
+    }
+    compact(fn);
+    return changed;
+}
+
+//
+// Compute the magic multiplier and shift for signed division
+// by a constant d >= 3 which is not a power of two.
+// See H. S. Warren, Hacker's Delight, chapter 10.
+//
+static void division_magic(int64_t d, int64_t *multiplier, int *shift)
+{
+    const uint64_t two63 = (uint64_t) 1 << 63;
+    uint64_t ad = d, anc = two63 - 1 - two63 % ad;
+    uint64_t q1 = two63 / anc, r1 = two63 - q1 * anc;
+    uint64_t q2 = two63 / ad, r2 = two63 - q2 * ad, delta;
+    int p = 63;
+
+    do {
+        p++;
+        q1 *= 2;
+        r1 *= 2;
+        if (r1 >= anc) {
+            q1++;
+            r1 -= anc;
+        }
+        q2 *= 2;
+        r2 *= 2;
+        if (r2 >= ad) {
+            q2++;
+            r2 -= ad;
+        }
+        delta = ad - r2;
+    } while (q1 < delta || (q1 == delta && r1 == 0));
+
+    *multiplier = (int64_t) (q2 + 1);
+    *shift = p - 64;
+}
+
+//
+// Emit a signed division or remainder of %rax by a constant
+// without the idiv instruction. The result is left in %rax.
+//
+static void divide_by_constant(FILE *out, int64_t d, bool remainder)
+{
+    int64_t multiplier;
+    int shift, k;
+
+    if ((d & (d - 1)) == 0) {
+        /* power of two: round towards zero, then shift or mask */
+        for (k = 0; ((int64_t) 1 << k) != d; k++)
+            ;
+        fprintf(out, "  mov %%rax, %%rdx\n  sar $63, %%rdx\n  shr $%d, %%rdx\n  add %%rax, %%rdx\n", 64 - k);
+        if (remainder)
+            fprintf(out, "  and $%ld, %%rdx\n  sub %%rdx, %%rax\n", -d);
+        else
+            fprintf(out, "  sar $%d, %%rdx\n  mov %%rdx, %%rax\n", k);
+        return;
+    }
+
+    division_magic(d, &multiplier, &shift);
+    fprintf(out, "  mov %%rax, %%rcx\n  movabs $%ld, %%rdx\n  imul %%rdx\n", multiplier);
+    if (multiplier < 0)
+        fprintf(out, "  add %%rcx, %%rdx\n");
+    if (shift)
+        fprintf(out, "  sar $%d, %%rdx\n", shift);
+    fprintf(out, "  mov %%rcx, %%rax\n  shr $63, %%rax\n  add %%rdx, %%rax\n");
+    if (remainder)
+        fprintf(out, "  imul $%ld, %%rax\n  sub %%rax, %%rcx\n  mov %%rcx, %%rax\n", d);
+}
+
+//
+// Replace division and remainder by a constant with multiplication
+// and shifts:
+//      mov $C, %rax; mov %rax, %rdi; pop %rax; cqo; idiv %rdi
+//
+static bool reduce_division(struct function_code *fn)
+{
+    size_t i, j, len;
+    bool remainder, changed = false;
+    char *code, *line, *next;
+    int64_t d;
+    FILE *out;
+    struct list lines = {0};
+
+    for (i = 0; i < fn->lines.size; i++) {
+        line = fn->lines.data[i];
+        if (i + 4 < fn->lines.size && sscanf(line, "  mov $%ld, %%rax", &d) == 1 &&
+            d > 1 && d <= INT32_MAX && strcmp(line + strlen(line) - 6, ", %rax") == 0 &&
+            strcmp(fn->lines.data[i + 1], "  mov %rax, %rdi") == 0 &&
+            strcmp(fn->lines.data[i + 2], "  pop %rax") == 0 &&
+            strcmp(fn->lines.data[i + 3], "  cqo") == 0 &&
+            strcmp(fn->lines.data[i + 4], "  idiv %rdi") == 0) {
+            remainder = i + 5 < fn->lines.size && strcmp(fn->lines.data[i + 5], "  mov %rdx, %rax") == 0;
+
+            out = open_memstream(&code, &len);
+            fprintf(out, "  pop %%rax\n");
+            divide_by_constant(out, d, remainder);
+            fclose(out);
+            for (line = code; *line; line = next + 1) {
+                next = strchr(line, '\n');
+                list_push(&lines, strndup(line, next - line));
+            }
+            free(code);
+
+            for (j = 0; j < (remainder ? 6u : 5u); j++)
+                free(fn->lines.data[i + j]);
+            i += remainder ? 5 : 4;
+            changed = true;
+            continue;
+        }
+        list_push(&lines, line);
+    }
+
+    list_free(&fn->lines);
+    fn->lines = lines;
+    return changed;
+}
+
+//
+// Instruction selection.
+//
+// The parser emits every operator as a fixed stack-machine template.
+// Here sequences of templates are matched against a table of x86-64
+// instruction forms: immediate and memory operands, scaled-index
+// addressing and cheaper equivalents. Where several forms match, the
+// one saving the most by the cost table is chosen.
+//
+// Patterns are lines where {x} stands for an operand:
+//      {c} an immediate fitting 32 bits   {n} a shift count
+//      {p} a power of two                 {k} a shift count from 1 to 3
+//      {s} an index scale                 {m} {o} frame or global operands
+// In a replacement, {l} is the logarithm of {p} and {s} may be made
+// from {k}.
+//
+
+#define SELECT_MAX_LINES 6
+
+enum scratch_reg {
+    SCRATCH_NONE,
+    SCRATCH_RDI,
+    SCRATCH_RCX,
+};
+
+static const struct selection {
+    const char *match[SELECT_MAX_LINES];
+    const char *replace[3];
+    enum scratch_reg scratch; /* register the replacement leaves different */
+} selections[] = {
+    /* immediate operands */
+    { { "  push %rax", "  mov ${c}, %rax", "  pop %rdi", "  add %rdi, %rax" }, { "  add ${c}, %rax" }, SCRATCH_RDI },
+    { { "  push %rax", "  mov ${c}, %rax", "  pop %rdi", "  imul %rdi, %rax" }, { "  imul ${c}, %rax" }, SCRATCH_RDI },
+    { { "  push %rax", "  mov ${c}, %rax", "  pop %rdi", "  and %rdi, %rax" }, { "  and ${c}, %rax" }, SCRATCH_RDI },
+    { { "  push %rax", "  mov ${c}, %rax", "  pop %rdi", "  or %rdi, %rax" }, { "  or ${c}, %rax" }, SCRATCH_RDI },
+    { { "  push %rax", "  mov ${c}, %rax", "  mov %rax, %rdi", "  pop %rax", "  sub %rdi, %rax" }, { "  sub ${c}, %rax" }, SCRATCH_RDI },
+    { { "  push %rax", "  mov ${c}, %rax", "  pop %rdi", "  cmp %rax, %rdi" }, { "  cmp ${c}, %rax" }, SCRATCH_RDI },
+    { { "  push %rax", "  xor %rax, %rax", "  pop %rdi", "  cmp %rax, %rdi" }, { "  test %rax, %rax" }, SCRATCH_RDI },
+    { { "  push %rax", "  mov ${n}, %rax", "  mov %rax, %rcx", "  pop %rax", "  shl %cl, %rax" }, { "  shl ${n}, %rax" }, SCRATCH_RCX },
+    { { "  push %rax", "  mov ${n}, %rax", "  mov %rax, %rcx", "  pop %rax", "  sar %cl, %rax" }, { "  sar ${n}, %rax" }, SCRATCH_RCX },
+
+    /* memory operands */
+    { { "  push %rax", "  mov {m}, %rax", "  pop %rdi", "  add %rdi, %rax" }, { "  add {m}, %rax" }, SCRATCH_RDI },
+    { { "  push %rax", "  mov {m}, %rax", "  pop %rdi", "  imul %rdi, %rax" }, { "  imul {m}, %rax" }, SCRATCH_RDI },
+    { { "  push %rax", "  mov {m}, %rax", "  pop %rdi", "  and %rdi, %rax" }, { "  and {m}, %rax" }, SCRATCH_RDI },
+    { { "  push %rax", "  mov {m}, %rax", "  pop %rdi", "  or %rdi, %rax" }, { "  or {m}, %rax" }, SCRATCH_RDI },
+    { { "  push %rax", "  mov {m}, %rax", "  mov %rax, %rdi", "  pop %rax", "  sub %rdi, %rax" }, { "  sub {m}, %rax" }, SCRATCH_RDI },
+    { { "  push %rax", "  mov {m}, %rax", "  pop %rdi", "  cmp %rax, %rdi" }, { "  cmp {m}, %rax" }, SCRATCH_RDI },
+
+    { { "  push %rax", "  mov {m}, %rax", "  pop %rdi" }, { "  mov %rax, %rdi", "  mov {m}, %rax" }, SCRATCH_NONE },
+    { { "  push {o}", "  mov {m}, %rax", "  pop %rdi" }, { "  mov {o}, %rdi", "  mov {m}, %rax" }, SCRATCH_NONE },
+
+    /* addressing */
+    { { "  shl ${k}, %rax", "  pop %rdi", "  add %rdi, %rax" }, { "  pop %rdi", "  lea (%rdi,%rax,{s}), %rax" }, SCRATCH_NONE },
+    { { "  shl ${k}, %rax", "  add %rdi, %rax" }, { "  lea (%rdi,%rax,{s}), %rax" }, SCRATCH_NONE },
+    { { "  lea (%rdi,%rax,{s}), %rax", "  add ${c}, %rax" }, { "  lea {c}(%rdi,%rax,{s}), %rax" }, SCRATCH_NONE },
+    { { "  lea (%rdi,%rax,{s}), %rax", "  mov (%rax), %rax" }, { "  mov (%rdi,%rax,{s}), %rax" }, SCRATCH_NONE },
+    { { "  lea (%rdi,%rax,{s}), %rax", "  movslq (%rax), %rax" }, { "  movslq (%rdi,%rax,{s}), %rax" }, SCRATCH_NONE },
+    { { "  lea {c}(%rdi,%rax,{s}), %rax", "  mov (%rax), %rax" }, { "  mov {c}(%rdi,%rax,{s}), %rax" }, SCRATCH_NONE },
+
+    /* cheaper equivalents */
+    { { "  imul ${p}, %rax" }, { "  shl ${l}, %rax" }, SCRATCH_NONE },
+    { { "  cmp $0, %rax" }, { "  test %rax, %rax" }, SCRATCH_NONE },
+};
+
+#define NUM_SELECTIONS (sizeof(selections) / sizeof(selections[0]))
+
+//
+// Operands captured by a pattern.
+//
+struct captures {
+    long value[26];
+    char memory[2][BUFSIZ]; /* {m} and {o} */
+};
+
+//
+// Cost of an instruction, in quarters of a cycle: the mnemonic,
+// plus a memory access, plus a little for an immediate.
+//
+static int instruction_cost(const char *line)
+{
+    static const struct {
+        const char *mnemonic;
+        int cost;
+    } costs[] = {
+        { "imul", 12 },
+        { "idiv", 160 },
+        { "call", 20 },
+    };
+    char mnemonic[MAX_MNEMONIC];
+    const char *operands;
+    size_t i;
+    int cost = 4;
+
+    if (!instruction(line, mnemonic, &operands))
+        return 0;
+    for (i = 0; i < sizeof(costs) / sizeof(costs[0]); i++)
+        if (strcmp(mnemonic, costs[i].mnemonic) == 0)
+            cost = costs[i].cost;
+    if (strchr(operands, '(') && strcmp(mnemonic, "lea") != 0)
+        cost += 4;
+    if (operands[0] == '$')
+        cost++;
+    return cost;
+}
+
+//
+// Match one line against a pattern line, capturing operands.
+//
+static bool match_line(const char *pattern, const char *line, struct captures *cap)
+{
+    char *end, *memory;
+    const char *close;
+    long value;
+    int x;
+
+    while (*pattern) {
+        if (pattern[0] != '{') {
+            if (*pattern++ != *line++)
+                return false;
+            continue;
+        }
+        x = pattern[1];
+        pattern += 3;
+        if (x == 'm' || x == 'o') {
+            memory = cap->memory[x == 'o'];
+            if (!(close = strchr(line, ')')) || (size_t) (close + 1 - line) >= sizeof(cap->memory[0]))
+                return false;
+            memcpy(memory, line, close + 1 - line);
+            memory[close + 1 - line] = '\0';
+            if (!is_named_memory(memory))
+                return false;
+            line = close + 1;
+            continue;
+        }
+
+        value = strtol(line, &end, 10);
+        if (end == line)
+            return false;
+        line = end;
+        switch (x) {
+        case 'c':
+            if (value < INT32_MIN || value > INT32_MAX)
+                return false;
+            break;
+        case 'n':
+            if (value < 0 || value > 63)
+                return false;
+            break;
+        case 'k':
+            if (value < 1 || value > 3)
+                return false;
+            cap->value['s' - 'a'] = 1L << value;
+            break;
+        case 's':
+            if (value != 1 && value != 2 && value != 4 && value != 8)
+                return false;
+            break;
+        case 'p':
+            if (value < 2 || value > INT32_MAX || (value & (value - 1)))
+                return false;
+            for (cap->value['l' - 'a'] = 0; (1L << cap->value['l' - 'a']) != value; cap->value['l' - 'a']++)
+                ;
+            break;
+        }
+        cap->value[x - 'a'] = value;
+    }
+    return *line == '\0';
+}
+
+//
+// Fill the operands into a replacement line.
+//
+static void fill_line(const char *pattern, const struct captures *cap, char *text, size_t size)
+{
+    size_t n = 0;
+
+    for (; *pattern && n + 1 < size; pattern++) {
+        if (pattern[0] != '{')
+            text[n++] = *pattern;
+        else if (pattern[1] == 'm' || pattern[1] == 'o') {
+            n += snprintf(text + n, size - n, "%s", cap->memory[pattern[1] == 'o']);
+            pattern += 2;
+        }
+        else {
+            n += snprintf(text + n, size - n, "%ld", cap->value[pattern[1] - 'a']);
+            pattern += 2;
+        }
+    }
+    text[n < size ? n : size - 1] = '\0';
+}
+
+//
+// Check whether a line mentions a register of the family.
+//
+static bool mentions_reg(const char *line, enum scratch_reg reg)
+{
+    static const char *names[][3] = {
+        [SCRATCH_RDI] = { "%rdi", "%edi", "%dil" },
+        [SCRATCH_RCX] = { "%rcx", "%ecx", "%cl" },
+    };
+    int i;
+
+    for (i = 0; i < 3; i++)
+        if (strstr(line, names[reg][i]))
+            return true;
+    return false;
+}
+
+//
+// Check whether the value of a scratch register after line i is never
+// used: it is set again, or the basic block ends, before any use.
+//
+static bool scratch_dead(struct function_code *fn, size_t i, enum scratch_reg reg)
+{
+    char mnemonic[MAX_MNEMONIC], source[BUFSIZ];
+    const char *operands, *comma;
+
+    if (reg == SCRATCH_NONE)
+        return true;
+    for (i++; i < fn->lines.size; i++) {
+        if (!instruction(fn->lines.data[i], mnemonic, &operands) || mnemonic[0] == 'j' ||
+            strcmp(mnemonic, "ret") == 0)
+            return true;
+        if (strcmp(mnemonic, "call") == 0)
+            return false;
+        if (!mentions_reg(operands, reg))
+            continue;
+        if (strcmp(mnemonic, "pop") == 0)
+            return true;
+        /* only a plain write of the register kills it */
+        if (!(comma = strrchr(operands, ',')) || (size_t) (comma - operands) >= sizeof(source))
+            return false;
+        memcpy(source, operands, comma - operands);
+        source[comma - operands] = '\0';
+        return (strcmp(mnemonic, "mov") == 0 || strcmp(mnemonic, "lea") == 0) &&
+            mentions_reg(comma, reg) && !strchr(comma, '(') && !mentions_reg(source, reg);
+    }
+    return true;
+}
+
+//
+// Replace stack-machine templates with the cheapest matching
+// instruction forms.
+//
+static bool select_instructions(struct function_code *fn)
+{
+    size_t i, j, n, best_len = 0;
+    int best_saving, saving;
+    const struct selection *sel, *best;
+    struct captures cap, best_cap;
+    char text[BUFSIZ];
+    bool changed = false;
+
+    for (i = 0; i < fn->lines.size; i++) {
+        best = NULL;
+        best_saving = 0;
+        for (sel = selections; sel < selections + NUM_SELECTIONS; sel++) {
+            memset(&cap, 0, sizeof(cap));
+            for (n = 0; n < SELECT_MAX_LINES && sel->match[n]; n++)
+                if (i + n >= fn->lines.size || !match_line(sel->match[n], fn->lines.data[i + n], &cap))
+                    break;
+            if (n == SELECT_MAX_LINES || sel->match[n] || !scratch_dead(fn, i + n - 1, sel->scratch))
+                continue;
+
+            saving = 0;
+            for (j = 0; j < n; j++)
+                saving += instruction_cost(fn->lines.data[i + j]);
+            for (j = 0; j < 3 && sel->replace[j]; j++) {
+                fill_line(sel->replace[j], &cap, text, sizeof(text));
+                saving -= instruction_cost(text);
+            }
+            if (saving > best_saving) {
+                best = sel;
+                best_saving = saving;
+                best_cap = cap;
+                best_len = n;
+            }
+        }
+        if (!best)
+            continue;
+
+        for (j = 0; j < best_len; j++)
+            delete_line(fn, i + j);
+        for (j = 0; j < 3 && best->replace[j]; j++) {
+            fill_line(best->replace[j], &best_cap, text, sizeof(text));
+            fn->lines.data[i + j] = strdup(text);
+        }
+        compact(fn);
+        changed = true;
+
+        /* the new instructions may start a longer pattern */
+        i = i > SELECT_MAX_LINES ? i - SELECT_MAX_LINES : 0;
+        i--;
+    }
+    return changed;
+}
+
+//
+// Local value numbering.
+//
+// Within a basic block every value held in a register or pushed on the
+// stack gets a number. Equal numbers mean equal values, so an instruction
+// computing a value which a register already holds is redundant.
+//
+// Memory is modelled by the last value stored to or loaded from an
+// address. A store to a local clobbers only that local, unless the
+// function takes the address of a local. A store through a pointer or
+// a call clobbers everything else.
+//
+
+#define VN_NUM_REGS 9
+
+static const char *vn_regs[VN_NUM_REGS][2] = {
+    { "%rax", "%eax" }, { "%rcx", "%ecx" }, { "%rdx", "%edx" },
+    { "%rdi", "%edi" }, { "%rsi", "%esi" }, { "%r8",  "%r8d" },
+    { "%r9",  "%r9d" }, { "%r10", "%r10d" }, { "%r11", "%r11d" },
+};
+
+struct vn_value {
+    char *key;              /* expression, or NULL for an unknown value */
+    unsigned long slot;     /* frame offset, when this is the address of a local */
+};
+
+struct vn_memory {
+    unsigned long address;  /* value number of the address */
+    unsigned long value;    /* value number of the contents */
+    int width;              /* access size in bytes */
+};
+
+struct vn_state {
+    bool address_taken;
+    struct list values;     /* value number N is values.data[N - 1] */
+    struct list memory;     /* known memory contents */
+    struct list stack;      /* value numbers of pushed words */
+    unsigned long regs[VN_NUM_REGS];
+};
+
+//
+// Find a register by name. Set *width to its size in bytes.
+//
+static int vn_reg(const char *name, int *width)
+{
+    int i;
+
+    for (i = 0; i < VN_NUM_REGS; i++) {
+        if (strcmp(name, vn_regs[i][0]) == 0) {
+            *width = 8;
+            return i;
+        }
+        if (strcmp(name, vn_regs[i][1]) == 0) {
+            *width = 4;
+            return i;
+        }
+    }
+    return -1;
+}
+
+//
+// Find the register of an indirect operand like (%rax).
+//
+static int vn_indirect(const char *operand)
+{
+    char name[8];
+    size_t len = strlen(operand);
+    int width;
+
+    if (len < 3 || len - 2 >= sizeof(name) || operand[0] != '(' || operand[len - 1] != ')')
+        return -1;
+    memcpy(name, operand + 1, len - 2);
+    name[len - 2] = '\0';
+    return vn_reg(name, &width);
+}
+
+//
+// Forget everything known at a basic block boundary.
+//
+static void vn_reset(struct vn_state *state)
+{
+    size_t i;
+
+    for (i = 0; i < state->values.size; i++) {
+        free(((struct vn_value*) state->values.data[i])->key);
+        free(state->values.data[i]);
+    }
+    for (i = 0; i < state->memory.size; i++)
+        free(state->memory.data[i]);
+    list_clear(&state->values);
+    list_clear(&state->memory);
+    list_clear(&state->stack);
+    memset(state->regs, 0, sizeof(state->regs));
+}
+
+//
+// Return the number of a value given by an expression.
+// A NULL expression creates a new unknown value.
+//
+static unsigned long vn_lookup(struct vn_state *state, const char *key)
+{
+    size_t i;
+    struct vn_value *value;
+
+    if (key) {
+        for (i = 0; i < state->values.size; i++) {
+            value = state->values.data[i];
+            if (value->key && strcmp(value->key, key) == 0)
+                return i + 1;
+        }
+    }
+
+    value = calloc(1, sizeof(struct vn_value));
+    value->key = key ? strdup(key) : NULL;
+    list_push(&state->values, value);
+    return state->values.size;
+}
+
+//
+// Return the number of a register value, giving an unknown value a number.
+//
+static unsigned long vn_reg_value(struct vn_state *state, int reg)
+{
+    if (!state->regs[reg])
+        state->regs[reg] = vn_lookup(state, NULL);
+    return state->regs[reg];
+}
+
+//
+// Return the number of the address of a named memory location.
+//
+static unsigned long vn_address(struct vn_state *state, const char *operand)
+{
+    char key[BUFSIZ];
+    unsigned long vn;
+    struct vn_value *value;
+
+    snprintf(key, sizeof(key), "lea %s", operand);
+    vn = vn_lookup(state, key);
+    value = state->values.data[vn - 1];
+    if (operand[0] == '-' && strcmp(operand + strlen(operand) - 6, "(%rbp)") == 0)
+        value->slot = strtoul(operand + 1, NULL, 10);
+    return vn;
+}
+
+//
+// Return the number of a binary operation.
+//
+static unsigned long vn_binary(struct vn_state *state, const char *op,
+    unsigned long a, unsigned long b, bool commutative)
+{
+    char key[64];
+    unsigned long t;
+
+    if (commutative && a > b) {
+        t = a;
+        a = b;
+        b = t;
+    }
+    snprintf(key, sizeof(key), "%s %lu %lu", op, a, b);
+    return vn_lookup(state, key);
+}
+
+//
+// Return the value loaded from an address.
+//
+static unsigned long vn_load(struct vn_state *state, unsigned long address, int width)
+{
+    size_t i;
+    struct vn_memory *mem;
+
+    for (i = 0; i < state->memory.size; i++) {
+        mem = state->memory.data[i];
+        if (mem->address == address && mem->width == width)
+            return mem->value;
+    }
+
+    mem = malloc(sizeof(struct vn_memory));
+    mem->address = address;
+    mem->value = vn_lookup(state, NULL);
+    mem->width = width;
+    list_push(&state->memory, mem);
+    return mem->value;
+}
+
+//
+// Forget memory contents which may be changed by a store to an address,
+// or by a call when address is 0.
+//
+static void vn_clobber(struct vn_state *state, unsigned long address)
+{
+    size_t i, n = 0;
+    struct vn_memory *mem;
+    unsigned long slot = address ? ((struct vn_value*) state->values.data[address - 1])->slot : 0;
+    unsigned long mem_slot;
+
+    for (i = 0; i < state->memory.size; i++) {
+        mem = state->memory.data[i];
+        mem_slot = ((struct vn_value*) state->values.data[mem->address - 1])->slot;
+
+        if (state->address_taken ||
+            (slot && mem_slot == slot) ||
+            (!slot && !mem_slot)) {
+            free(mem);
+            continue;
+        }
+        state->memory.data[n++] = mem;
+    }
+    state->memory.size = n;
+}
+
+//
+// Record a store of a value to an address.
+// An unknown value is given as 0.
+//
+static void vn_store(struct vn_state *state, unsigned long address, unsigned long value, int width)
+{
+    struct vn_memory *mem;
+
+    vn_clobber(state, address);
+    if (!value)
+        return;
+
+    mem = malloc(sizeof(struct vn_memory));
+    mem->address = address;
+    mem->value = value;
+    mem->width = width;
+    list_push(&state->memory, mem);
+}
+
+//
+// Split the operands of an instruction at the top-level comma.
+// Return the number of operands.
+//
+static int vn_operands(const char *operands, char *first, char *second)
+{
+    const char *comma = strstr(operands, ", ");
+
+    first[0] = second[0] = '\0';
+    if (!*operands)
+        return 0;
+    if (!comma || comma - operands >= BUFSIZ || strlen(comma + 2) >= BUFSIZ) {
+        snprintf(first, BUFSIZ, "%s", operands);
+        return 1;
+    }
+    memcpy(first, operands, comma - operands);
+    first[comma - operands] = '\0';
+    strcpy(second, comma + 2);
+    return 2;
+}
+
+//
+// Compute the value of a source operand: a register, an immediate,
+// a named memory location or an address in a register.
+// Return 0 when it is not understood.
+//
+static unsigned long vn_source(struct vn_state *state, const char *operand, int *width, bool *is_load)
+{
+    char key[BUFSIZ];
+    int reg;
+
+    *is_load = false;
+    if ((reg = vn_reg(operand, width)) >= 0)
+        return *width == 8 ? vn_reg_value(state, reg) : 0;
+    if (operand[0] == '$') {
+        snprintf(key, sizeof(key), "imm %s", operand + 1);
+        return vn_lookup(state, key);
+    }
+
+    *is_load = true;
+    if (is_named_memory(operand))
+        return vn_load(state, vn_address(state, operand), *width);
+    if ((reg = vn_indirect(operand)) >= 0)
+        return vn_load(state, vn_reg_value(state, reg), *width);
+    return 0;
+}
+
+//
+// Find a register other than the given one holding a value.
+//
+static int vn_holder(struct vn_state *state, unsigned long value, int except)
+{
+    int i;
+
+    for (i = 0; i < VN_NUM_REGS; i++)
+        if (i != except && state->regs[i] == value)
+            return i;
+    return -1;
+}
+
+//
+// Forget all register values, as after a call.
+//
+static void vn_clobber_regs(struct vn_state *state)
+{
+    memset(state->regs, 0, sizeof(state->regs));
+}
+
+//
+// Remove recomputations of values already held in registers,
+// and replace loads of known values with register moves. Nothing
+// is known at the start of a block, so this stays within blocks.
+//
+static bool local_value_numbering(struct function_code *fn)
+{
+    struct vn_state state;
+    size_t i, count;
+    int dest, width, src_width, src_reg, reg, holder;
+    unsigned long value, address;
+    bool is_load, changed = false;
+    char mnemonic[MAX_MNEMONIC], text[BUFSIZ];
+    char *first = malloc(BUFSIZ), *second = malloc(BUFSIZ);
+    const char *operands, *line;
+    int num_operands;
+
+    memset(&state, 0, sizeof(state));
+    state.address_taken = fn->address_taken;
+
+    for (i = 0; i < fn->lines.size; i++) {
+        line = fn->lines.data[i];
+        if (!instruction(line, mnemonic, &operands)) {
+            /* a label starts a new block */
+            vn_reset(&state);
+            continue;
+        }
+        num_operands = vn_operands(operands, first, second);
+        dest = num_operands == 2 ? vn_reg(second, &width) : -1;
+
+        if ((strcmp(mnemonic, "mov") == 0 || strcmp(mnemonic, "movslq") == 0 ||
+             strcmp(mnemonic, "lea") == 0) && num_operands == 2 && dest >= 0 && width == 8) {
+            /* register definition without side effects */
+            src_width = strcmp(mnemonic, "movslq") == 0 ? 4 : 8;
+            if (strcmp(mnemonic, "lea") == 0) {
+                is_load = false;
+                value = is_named_memory(first) ? vn_address(&state, first) : 0;
+            }
+            else {
+                value = vn_source(&state, first, &src_width, &is_load);
+                if (strcmp(mnemonic, "movslq") == 0 && !is_load)
+                    value = 0; /* sign extension of a register */
+            }
+
+            if (!value) {
+                state.regs[dest] = 0;
+                continue;
+            }
+            if (state.regs[dest] == value) {
+                delete_line(fn, i);
+                changed = true;
+                continue;
+            }
+            if (is_load && (holder = vn_holder(&state, value, dest)) >= 0) {
+                snprintf(text, sizeof(text), "  mov %s, %s", vn_regs[holder][0], vn_regs[dest][0]);
+                replace_line(fn, i, text);
+                changed = true;
+            }
+            state.regs[dest] = value;
+        }
+        else if (strcmp(mnemonic, "mov") == 0 && num_operands == 2 &&
+                 (src_reg = vn_reg(first, &src_width)) >= 0 && dest < 0) {
+            /* store of a register */
+            if (is_named_memory(second))
+                address = vn_address(&state, second);
+            else if ((reg = vn_indirect(second)) >= 0)
+                address = vn_reg_value(&state, reg);
+            else {
+                vn_reset(&state);
+                continue;
+            }
+            value = src_width == 8 ? vn_reg_value(&state, src_reg) : 0;
+            vn_store(&state, address, value, 8);
+        }
+        else if (strcmp(mnemonic, "xor") == 0 && dest >= 0 && width == 8 && strcmp(first, second) == 0) {
+            value = vn_lookup(&state, "imm 0");
+            if (state.regs[dest] == value) {
+                delete_line(fn, i);
+                changed = true;
+                continue;
+            }
+            state.regs[dest] = value;
+        }
+        else if (strcmp(mnemonic, "push") == 0 && num_operands == 1) {
+            src_width = 8;
+            value = strcmp(first, "%rbp") != 0 ? vn_source(&state, first, &src_width, &is_load) : 0;
+            if (value && is_load && (holder = vn_holder(&state, value, -1)) >= 0) {
+                /* push a known value from a register */
+                snprintf(text, sizeof(text), "  push %s", vn_regs[holder][0]);
+                replace_line(fn, i, text);
+                changed = true;
+            }
+            list_push(&state.stack, (void*) (uintptr_t) (value ? value : vn_lookup(&state, NULL)));
+        }
+        else if (strcmp(mnemonic, "pop") == 0 && num_operands == 1 && (dest = vn_reg(first, &width)) >= 0) {
+            state.regs[dest] = state.stack.size ? (uintptr_t) state.stack.data[--state.stack.size] : 0;
+        }
+        else if ((strcmp(mnemonic, "add") == 0 || strcmp(mnemonic, "sub") == 0 ||
+                  strcmp(mnemonic, "imul") == 0 || strcmp(mnemonic, "and") == 0 ||
+                  strcmp(mnemonic, "or") == 0 || strcmp(mnemonic, "shl") == 0 ||
+                  strcmp(mnemonic, "sar") == 0) && dest >= 0 && width == 8) {
+            /* binary operation, the destination is also an operand */
+            value = vn_source(&state, first, &src_width, &is_load);
+            if (is_load || !value || src_width != 8) {
+                state.regs[dest] = 0;
+                continue;
+            }
+            state.regs[dest] = vn_binary(&state, mnemonic, vn_reg_value(&state, dest), value,
+                strcmp(mnemonic, "sub") != 0 && strcmp(mnemonic, "shl") != 0 && strcmp(mnemonic, "sar") != 0);
+        }
+        else if (num_operands == 2 && strcmp(second, "%rsp") == 0 &&
+                 (strcmp(mnemonic, "sub") == 0 || strcmp(mnemonic, "add") == 0) && first[0] == '$') {
+            /* stack allocation or release in whole words */
+            count = strtoul(first + 1, NULL, 10);
+            if (count % 8) {
+                list_clear(&state.stack);
+                continue;
+            }
+            for (count /= 8; count > 0; count--) {
+                if (mnemonic[0] == 's')
+                    list_push(&state.stack, (void*) (uintptr_t) vn_lookup(&state, NULL));
+                else if (state.stack.size)
+                    state.stack.size--;
+            }
+        }
+        else if ((strcmp(mnemonic, "addq") == 0 || strcmp(mnemonic, "subq") == 0 ||
+                  strcmp(mnemonic, "addl") == 0 || strcmp(mnemonic, "subl") == 0) &&
+                 num_operands == 2 && (reg = vn_indirect(second)) >= 0) {
+            /* increment or decrement in memory */
+            vn_store(&state, vn_reg_value(&state, reg), 0, 8);
+        }
+        else if (strcmp(mnemonic, "cmp") == 0 || strcmp(mnemonic, "test") == 0 ||
+                 (mnemonic[0] == 'j' && strcmp(mnemonic, "jmp") != 0)) {
+            /* flags only, or a branch continuing in this block */
+        }
+        else if (strcmp(mnemonic, "call") == 0) {
+            vn_clobber_regs(&state);
+            vn_clobber(&state, 0);
+        }
+        else if (strncmp(mnemonic, "set", 3) == 0 || strncmp(mnemonic, "cmov", 4) == 0 ||
+                 strcmp(mnemonic, "movzb") == 0 || strcmp(mnemonic, "movzx") == 0 ||
+                 strcmp(mnemonic, "neg") == 0 || strcmp(mnemonic, "movslq") == 0) {
+            /* result in the last operand is a new value */
+            dest = vn_reg(num_operands == 2 ? second : first, &width);
+            if (dest < 0) {
+                vn_reset(&state);
+                continue;
+            }
+            state.regs[dest] = 0;
+        }
+        else if (strcmp(mnemonic, "cqo") == 0)
+            state.regs[2] = 0;
+        else if (strcmp(mnemonic, "idiv") == 0)
+            state.regs[0] = state.regs[2] = 0;
+        else {
+            /* anything else ends what is known */
+            vn_reset(&state);
+        }
+    }
+    vn_reset(&state);
+    list_free(&state.values);
+    list_free(&state.memory);
+    list_free(&state.stack);
+    free(first);
+    free(second);
+    compact(fn);
+    return changed;
+}
+
+//
+// Frame pointer omission.
+//
+// The depth of the stack below the entry %rsp is tracked at every line.
+// Locals addressed from %rbp are then addressed from %rsp. A leaf function
+// keeps its whole frame, pushes included, in the 128-byte red zone below
+// %rsp and never adjusts the stack pointer.
+//
+
+#define RED_ZONE_SIZE 128
+
+//
+// Stack depth in bytes below the entry %rsp at every line.
+// Where paths with different depths meet, the stack pointer
+// has to be adjusted on the way.
+//
+struct stack_depth {
+    long *depth;        /* depth before the line, or -1 when not reached */
+    long *before;       /* adjustment before the line, for jumps */
+    long *after;        /* adjustment after the line, for fall-through */
+    long max_depth;     /* deepest point of the frame */
+    bool is_leaf;       /* the function makes no calls */
+    long frame_base;    /* bytes from the saved %rbp up to the frame pointer */
+    bool final;         /* final code: locals may be addressed from %rsp, and dead lines are left */
+};
+
+//
+// Check whether an instruction sets up the frame pointer, from %rsp
+// after the old one is pushed. It points at the saved %rbp, or higher
+// for a function with the internal calling convention.
+//
+static bool frame_setup(const char *mnemonic, const char *operands, long *base)
+{
+    long offset = 0;
+    int n = 0;
+
+    if (strcmp(mnemonic, "mov") == 0 && strcmp(operands, "%rsp, %rbp") == 0)
+        offset = 0;
+    else if (strcmp(mnemonic, "lea") != 0 ||
+             sscanf(operands, "%ld(%%rsp), %%rbp%n", &offset, &n) != 1 || operands[n] != '\0')
+        return false;
+    *base = offset;
+    return true;
+}
+
+//
+// Check whether an instruction releases the frame, leaving %rsp
+// at the saved %rbp.
+//
+static bool frame_release(const char *mnemonic, const char *operands)
+{
+    long base;
+    int n = 0;
+
+    if (strcmp(mnemonic, "mov") == 0 && strcmp(operands, "%rbp, %rsp") == 0)
+        return true;
+    return strcmp(mnemonic, "lea") == 0 &&
+           sscanf(operands, "-%ld(%%rbp), %%rsp%n", &base, &n) == 1 && operands[n] == '\0';
+}
+
+//
+// Check whether %rsp appears in operands only as the base of memory
+// operands, and find the lowest offset from it, below zero in the
+// red zone.
+//
+static bool rsp_addressed(const char *operands, long *lowest)
+{
+    const char *p = operands, *ref, *start;
+    long offset;
+
+    *lowest = 0;
+    while ((ref = strstr(p, "%rsp"))) {
+        if (ref == operands || ref[-1] != '(')
+            return false;
+        start = ref - 1;
+        while (start > p && ((start[-1] >= '0' && start[-1] <= '9') || start[-1] == '-'))
+            start--;
+        offset = start < ref - 1 ? strtol(start, NULL, 10) : 0;
+        if (offset < *lowest)
+            *lowest = offset;
+        p = ref + 4;
+    }
+    return true;
+}
+
+//
+// Continue a path with the given depth at a line.
+// Return the number of bytes to release on the way, or 0
+// when the line is seen for the first time.
+//
+static long stack_merge(struct stack_depth *sd, size_t *work, size_t *top, size_t line, long d)
+{
+    if (sd->depth[line] < 0) {
+        sd->depth[line] = d;
+        work[(*top)++] = line;
+        return 0;
+    }
+    return d - sd->depth[line];
+}
+
+//
+// Compute the stack depth before every line.
+// Return false when it cannot be tracked.
+//
+static bool stack_depths(struct function_code *fn, struct stack_depth *sd)
+{
+    size_t n = fn->lines.size, top = 0, i, start, len;
+    size_t *work = malloc((n + 1) * sizeof(size_t));
+    char mnemonic[MAX_MNEMONIC];
+    const char *operands, *target;
+    bool is_conditional, ok = true;
+    long d, j, delta, lowest;
+
+    sd->max_depth = 0;
+    sd->is_leaf = true;
+    sd->frame_base = 0;
+    for (i = 0; i < n; i++) {
+        sd->depth[i] = -1;
+        sd->before[i] = sd->after[i] = 0;
+    }
+    sd->depth[0] = 0;
+    work[top++] = 0;
+
+    while (top && ok) {
+        start = i = work[--top];
+        for (d = sd->depth[i]; ok && i < n; i++) {
+            if (i != start && sd->depth[i] >= 0) {
+                /* joins a path seen before, maybe with another depth */
+                sd->after[i - 1] = d - sd->depth[i];
+                break;
+            }
+            sd->depth[i] = d;
+
+            if (instruction(fn->lines.data[i], mnemonic, &operands)) {
+                if (strcmp(mnemonic, "push") == 0)
+                    d += 8;
+                else if (strcmp(mnemonic, "pop") == 0)
+                    d -= 8;
+                else if ((strcmp(mnemonic, "sub") == 0 || strcmp(mnemonic, "add") == 0) &&
+                         operands[0] == '$' && (len = strlen(operands)) > 6 &&
+                         strcmp(operands + len - 6, ", %rsp") == 0)
+                    d += (mnemonic[0] == 's' ? 1 : -1) * strtol(operands + 1, NULL, 10);
+                else if (frame_release(mnemonic, operands))
+                    d = 8;
+                else if (strcmp(mnemonic, "call") == 0)
+                    sd->is_leaf = false;
+                else if (!frame_setup(mnemonic, operands, &sd->frame_base) && strstr(operands, "%rsp")) {
+                    if (!sd->final || !rsp_addressed(operands, &lowest))
+                        ok = false;
+                    else if (d - lowest > sd->max_depth)
+                        sd->max_depth = d - lowest;
+                }
+
+                if (d > sd->max_depth)
+                    sd->max_depth = d;
+                if (d < 0)
+                    ok = false;
+                if (strcmp(mnemonic, "ret") == 0) {
+                    ok &= d == 0;
+                    break;
+                }
+            }
+
+            if ((target = jump_target(fn->lines.data[i], &is_conditional))) {
+                if ((j = find_label(fn, target)) < 0) {
+                    ok = false;
+                    break;
+                }
+                delta = stack_merge(sd, work, &top, j, d);
+                if (delta && is_conditional)
+                    ok = false;
+                sd->before[i] = delta;
+                if (!is_conditional)
+                    break;
+            }
+        }
+    }
+
+    /* every instruction has to be reached */
+    for (i = 0; i < n && ok && !sd->final; i++)
+        if (sd->depth[i] < 0 && instruction(fn->lines.data[i], mnemonic, &operands))
+            ok = false;
+
+    free(work);
+    return ok;
+}
+
+//
+// Rewrite frame pointer references -N(%rbp) in a line as %rsp-relative,
+// where %rsp points the given number of bytes below %rbp (negative
+// when above).
+// Return the new line or NULL when it refers to %rbp in another way.
+//
+static char *rebase_line(const char *line, long below_rbp)
+{
+    char *text = malloc(strlen(line) + 64), *out = text;
+    const char *p = line, *ref, *start;
+
+    while ((ref = strstr(p, "(%rbp)"))) {
+        start = ref;
+        while (start > p && start[-1] >= '0' && start[-1] <= '9')
+            start--;
+        if (start == p || start[-1] != '-' || start == ref) {
+            free(text);
+            return NULL;
+        }
+        start--;
+        memcpy(out, p, start - p);
+        out += start - p;
+        out += sprintf(out, "%ld(%%rsp)", below_rbp - strtol(start + 1, NULL, 10));
+        p = ref + 6;
+    }
+    if (strstr(p, "%rbp")) {
+        free(text);
+        return NULL;
+    }
+    strcpy(out, p);
+    return text;
+}
+
+//
+// Add an instruction adjusting the stack pointer.
+//
+static void push_adjust(struct list *lines, long bytes)
+{
+    char buffer[64];
+
+    if (bytes > 0)
+        snprintf(buffer, sizeof(buffer), "  add $%ld, %%rsp", bytes);
+    else
+        snprintf(buffer, sizeof(buffer), "  sub $%ld, %%rsp", -bytes);
+    list_push(lines, strdup(buffer));
+}
+
+//
+// Address locals from %rsp instead of %rbp.
+// Return true when the function was changed.
+//
+static bool omit_frame_pointer(struct function_code *fn)
+{
+    size_t n = fn->lines.size, i;
+    struct stack_depth sd = {0};
+    struct list lines = {0};
+    bool red_zone, ok;
+    long base;
+    char mnemonic[MAX_MNEMONIC], **text = calloc(n + 1, sizeof(char*));
+    char buffer[BUFSIZ], *p, *next;
+    const char *operands, *line;
+    long d;
+
+    sd.depth = malloc((n + 1) * sizeof(long));
+    sd.before = malloc((n + 1) * sizeof(long));
+    sd.after = malloc((n + 1) * sizeof(long));
+    sd.final = false;
+    ok = n > 0 && stack_depths(fn, &sd);
+    red_zone = sd.is_leaf && sd.max_depth <= RED_ZONE_SIZE;
+
+    for (i = 0; i < n && ok; i++) {
+        line = fn->lines.data[i];
+        if (!instruction(line, mnemonic, &operands))
+            continue;
+        d = sd.depth[i];
+
+        if (strcmp(mnemonic, "push") == 0 && strcmp(operands, "%rbp") == 0)
+            text[i] = strdup(red_zone ? "" : "  sub $8, %rsp");
+        else if (frame_setup(mnemonic, operands, &base))
+            text[i] = strdup("");
+        else if (frame_release(mnemonic, operands)) {
+            /* epilogue, the saved %rbp is released together with the frame */
+            if (i + 1 < n && strcmp(fn->lines.data[i + 1], "  pop %rbp") == 0) {
+                snprintf(buffer, sizeof(buffer), "  add $%ld, %%rsp", d);
+                text[i] = strdup(red_zone ? "" : buffer);
+                text[++i] = strdup("");
+            }
+            else {
+                snprintf(buffer, sizeof(buffer), "  add $%ld, %%rsp", d - 8);
+                text[i] = strdup(red_zone || d == 8 ? "" : buffer);
+            }
+        }
+        else if (strcmp(mnemonic, "pop") == 0 && strcmp(operands, "%rbp") == 0)
+            text[i] = strdup(red_zone ? "" : "  add $8, %rsp");
+        else if (red_zone && strstr(operands, ", %rsp"))
+            text[i] = strdup("");
+        else if (red_zone && strcmp(mnemonic, "push") == 0) {
+            /* store into the red zone, through a scratch register from memory */
+            if (!(p = rebase_line(operands, sd.frame_base - 8))) {
+                ok = false;
+                break;
+            }
+            if (p[0] == '%')
+                snprintf(buffer, sizeof(buffer), "  mov %s, %ld(%%rsp)", p, -d - 8);
+            else
+                snprintf(buffer, sizeof(buffer), "  mov %s, %%r11\n  mov %%r11, %ld(%%rsp)", p, -d - 8);
+            free(p);
+            text[i] = strdup(buffer);
+        }
+        else if (red_zone && strcmp(mnemonic, "pop") == 0) {
+            snprintf(buffer, sizeof(buffer), "  mov %ld(%%rsp), %s", -d, operands);
+            text[i] = strdup(buffer);
+        }
+        else if (strstr(line, "%rbp") && !(text[i] = rebase_line(line, (red_zone ? 0 : d) - 8 + sd.frame_base)))
+            ok = false;
+    }
+
+    if (ok) {
+        for (i = 0; i < n; i++) {
+            if (sd.before[i] && !red_zone)
+                push_adjust(&lines, sd.before[i]);
+            if (!text[i])
+                list_push(&lines, strdup(fn->lines.data[i]));
+            for (p = text[i]; p && *p; p = next) {
+                /* a replacement can be several lines */
+                if ((next = strchr(p, '\n')))
+                    list_push(&lines, strndup(p, next++ - p));
+                else {
+                    list_push(&lines, strdup(p));
+                    next = p + strlen(p);
+                }
+            }
+            if (sd.after[i] && !red_zone)
+                push_adjust(&lines, sd.after[i]);
+        }
+        for (i = 0; i < n; i++)
+            free(fn->lines.data[i]);
+        list_free(&fn->lines);
+        fn->lines = lines;
+    }
+
+    for (i = 0; i < n; i++)
+        free(text[i]);
+    free(text);
+    free(sd.depth);
+    free(sd.before);
+    free(sd.after);
+    return ok;
+}
+
+//
+// Add a function to the callees of another, once.
+//
+static void add_callee(struct list *callees, const char *name)
+{
+    size_t i;
+
+    for (i = 0; i < callees->size; i++)
+        if (strcmp(callees->data[i], name) == 0)
+            return;
+    list_push(callees, strdup(name));
+}
+
+//
+// Stack usage of the final code of a function: the deepest point of
+// its frame, red zone included, plus the return address; and the
+// functions it calls. A call through %r10 is named by the label the
+// caller pushed for it, or "*" when the address is computed.
+// Return false when the depth cannot be tracked; the bytes are then
+// those of the paths followed.
+//
+bool function_stack_usage(struct function_code *fn, long *bytes, struct list *callees)
+{
+    size_t n = fn->lines.size, i, num_slots, k;
+    struct stack_depth sd;
+    char mnemonic[MAX_MNEMONIC], *rax = NULL, *r10 = NULL, **slots;
+    const char *operands, *end;
+    bool ok;
+    long d;
+
+    sd.depth = malloc((n + 1) * sizeof(long));
+    sd.before = malloc((n + 1) * sizeof(long));
+    sd.after = malloc((n + 1) * sizeof(long));
+    sd.final = true;
+    sd.max_depth = 0;
+    ok = n > 0 && stack_depths(fn, &sd);
+    *bytes = sd.max_depth + 8;
+
+    /* the labels pushed in every word of the frame */
+    num_slots = sd.max_depth / 8 + 1;
+    slots = calloc(num_slots, sizeof(char*));
+    for (i = 0; i < n; i++) {
+        if (sd.depth[i] < 0 || !instruction(fn->lines.data[i], mnemonic, &operands))
+            continue;
+        d = sd.depth[i];
+        if (strcmp(mnemonic, "lea") == 0 && (end = strstr(operands, "(%rip), %rax")) && !end[12]) {
+            free(rax);
+            rax = strndup(operands, end - operands);
+            continue;
+        }
+        if (strcmp(mnemonic, "push") == 0 && d >= 0 && (size_t) d / 8 < num_slots) {
+            free(slots[d / 8]);
+            slots[d / 8] = rax && strcmp(operands, "%rax") == 0 ? strdup(rax) : NULL;
+        }
+        else if (strcmp(mnemonic, "pop") == 0 && d >= 8 && (size_t) d / 8 <= num_slots) {
+            free(r10);
+            r10 = strcmp(operands, "%r10") == 0 ? slots[d / 8 - 1] : NULL;
+            if (!r10)
+                free(slots[d / 8 - 1]);
+            slots[d / 8 - 1] = NULL;
+        }
+        else if (strstr(operands, ", %rsp")) {
+            /* the words of an adjusted frame are unknown */
+            for (k = d > 0 ? d / 8 : 0; k < num_slots; k++) {
+                free(slots[k]);
+                slots[k] = NULL;
+            }
+        }
+        else if (strcmp(mnemonic, "call") == 0)
+            add_callee(callees, operands[0] != '*' ? operands : r10 ? r10 : "*");
+        else if ((end = strstr(operands, ", %r10")) && !end[6]) {
+            free(r10);
+            r10 = NULL;
+        }
+        free(rax);
+        rax = NULL;
+    }
+
+    for (k = 0; k < num_slots; k++)
+        free(slots[k]);
+    free(slots);
+    free(rax);
+    free(r10);
+    free(sd.depth);
+    free(sd.before);
+    free(sd.after);
+    return ok;
+}
+
+//
+// Optimization passes in the order they run. They are peepholes
+// over the assembly lines of a function, and the enabled ones are
+// repeated until none of them changes the code. Each pass is enabled
+// from the given -O level.
+//
+static const struct pass {
+    const char *name;
+    int level;
+    bool (*run)(struct function_code *fn);
+} passes[] = {
+    { "reduce-division", 1, reduce_division },
+    { "unreachable",   1, remove_unreachable },
+    { "thread-jumps",  1, thread_jumps },
+    { "invert-branches", 1, invert_branches },
+    { "jump-to-next",  1, remove_jumps_to_next },
+    { "unused-labels", 1, remove_unused_labels },
+    { "combine",       1, combine_loads },
+    { "local-value-numbering", 2, local_value_numbering },
+    { "select",        1, select_instructions },
+    { "dead-rax",      1, remove_dead_rax },
+    { "dead-stores",   1, remove_dead_stores },
+    { "merge-tails",   2, merge_tails },
+};
+
+#define NUM_PASSES (sizeof(passes) / sizeof(passes[0]))
+
+//
+// Check whether a pass with the given name exists.
+//
+bool optimize_pass_exists(const char *name)
+{
+    size_t i;
+
+    if (strcmp(name, "omit-frame-pointer") == 0)
+        return true;
+    for (i = 0; i < NUM_PASSES; i++)
+        if (strcmp(name, passes[i].name) == 0)
+            return true;
+    return false;
+}
+
+//
+// Dump the code after a pass when requested, labeled with the round
+// of the repeated passes, or 0 for a pass run once.
+//
+static void print_after(struct compiler_args *args, const char *name, unsigned round, struct function_code *fn)
+{
+    if (args->print_after && strcmp(args->print_after, name) == 0) {
+        if (round)
+            fprintf(stderr, "# after %s, round %u: %s\n", name, round, fn->name);
+        else
+            fprintf(stderr, "# after %s: %s\n", name, fn->name);
+        function_code_write(fn, stderr);
+    }
+}
+
+//
+// Align the heads of loops, the labels jumped to from below, to the
+// given number of bytes. The padding runs once on entry to a loop.
+//
+static void align_loops(struct function_code *fn, unsigned align)
+{
+    size_t i, cold = fn->lines.size;
+    long head;
+    bool is_conditional;
+    const char *target;
+    char text[32];
+    bool *heads = calloc(fn->lines.size + 1, sizeof(bool));
+
+    for (i = 0; i < fn->lines.size; i++) {
+        if (cold == fn->lines.size && is_label(fn->lines.data[i]) &&
+            strncmp(fn->lines.data[i], ".L.cold.", 8) == 0)
+            cold = i;
+        target = jump_target(fn->lines.data[i], &is_conditional);
+        /* cold code after the function jumps back without making a loop */
+        if (target && strncmp(target, ".L.", 3) == 0 &&
+            (head = find_label(fn, target)) >= 0 && (size_t) head < i &&
+            !((size_t) head < cold && i > cold)) {
+            /* the padding goes before all labels of the place */
+            while (head > 0 && is_label(fn->lines.data[head - 1]))
+                head--;
+            heads[head] = true;
+        }
+    }
+
+    snprintf(text, sizeof(text), ".align %u", align);
+    for (i = fn->lines.size; i-- > 0; )
+        if (heads[i])
+            insert_line(fn, i, text);
+    free(heads);
+}
+
+//
+// Optimize the code of one function. The enabled passes are
+// repeated until nothing changes; -O2 enables more of them.
+// The frame pointer is omitted last, as the passes expect locals
+// addressed from %rbp.
+//
+void optimize_function(struct compiler_args *args, struct function_code *fn)
+{
+    size_t i;
+    unsigned round = 0;
+    bool changed;
+
+    do {
+        changed = false;
+        round++;
+        for (i = 0; i < NUM_PASSES; i++) {
+            if (passes[i].level > args->opt_level)
+                continue;
+            changed |= passes[i].run(fn);
+            print_after(args, passes[i].name, round, fn);
+        }
+    } while (changed);
+
+    if (args->omit_frame_pointer) {
+        if (omit_frame_pointer(fn))
+            remark(args, fn->pos, REMARK_PASSED, "omit-frame-pointer", "Omitted",
+                "locals of '%s' addressed from %%rsp", fn->name);
+        else
+            remark(args, fn->pos, REMARK_MISSED, "omit-frame-pointer", "StackNotTracked",
+                "frame pointer of '%s' kept: the stack depth is not known at every instruction", fn->name);
+        print_after(args, "omit-frame-pointer", 0, fn);
+    }
+    if (args->align_loops > 1)
+        align_loops(fn, args->align_loops);
+}
+
+//
+// Functions of a file shared by the optimizer threads.
+//
+struct job_queue {
+    struct compiler_args *args;
+    struct list *jobs;
+    size_t next;            /* first job not taken yet */
+    pthread_mutex_t lock;
+};
+
+static void *optimize_worker(void *arg)
+{
+    struct job_queue *queue = arg;
+    struct optimize_job *job;
+    FILE *out;
+
+    for (;;) {
+        pthread_mutex_lock(&queue->lock);
+        job = queue->next < queue->jobs->size ? queue->jobs->data[queue->next++] : NULL;
+        pthread_mutex_unlock(&queue->lock);
+        if (!job)
+            return NULL;
+
+        optimize_function(queue->args, &job->fn);
+        out = open_memstream(&job->text, &job->text_len);
+        function_code_write(&job->fn, out);
+        fclose(out);
+        function_code_free(&job->fn);
+    }
+}
+
+//
+// Optimize the functions of a file on a pool of threads, the calling
+// one included. The passes only read the options, and every job gets
+// its own output buffer.
+//
+void optimize_jobs(struct compiler_args *args, struct list *jobs)
+{
+    pthread_t threads[MAX_THREADS];
+    struct job_queue queue = { args, jobs, 0, PTHREAD_MUTEX_INITIALIZER };
+    long num_threads = args->threads ? (long) args->threads : sysconf(_SC_NPROCESSORS_ONLN);
+    long i, started = 0;
+
+    if (num_threads > MAX_THREADS)
+        num_threads = MAX_THREADS;
+    if (num_threads > (long) jobs->size)
+        num_threads = jobs->size;
+
+    // When a thread cannot be created, the others do its share.
+    for (i = 1; i < num_threads; i++)
+        if (pthread_create(&threads[started], NULL, optimize_worker, &queue) == 0)
+            started++;
+    optimize_worker(&queue);
+    for (i = 0; i < started; i++)
+        pthread_join(threads[i], NULL);
+    pthread_mutex_destroy(&queue.lock);
+}
@@ -0,0 +1,40 @@
+#ifndef BCAUSE_OPTIMIZE_H
+#define BCAUSE_OPTIMIZE_H
+
+#include <stdio.h>
+#include <stdbool.h>
+#include "list.h"
+
+struct compiler_args;
+
+//
+// Generated assembly code of one function, one instruction,
+// label or directive per line.
+//
+struct function_code {
+    const char *name;       /* name of the function */
+    struct list lines;      /* lines without trailing newline */
+    bool address_taken;     /* can locals be accessed through pointers? */
+    long pos;               /* offset of the definition in the source file */
+    unsigned long next_label; /* number of the next label a pass adds */
+};
+
+//
+// A function waiting for the optimizer, and the code it gets.
+//
+struct optimize_job {
+    struct function_code fn;
+    char *text;             /* optimized code */
+    size_t text_len;
+};
+
+void function_code_parse(struct function_code *fn, const char *name, const char *text);
+void function_code_write(struct function_code *fn, FILE *out);
+void function_code_free(struct function_code *fn);
+
+bool optimize_pass_exists(const char *name);
+void optimize_function(struct compiler_args *args, struct function_code *fn);
+void optimize_jobs(struct compiler_args *args, struct list *jobs);
+bool function_stack_usage(struct function_code *fn, long *bytes, struct list *callees);
+
+#endif /* BCAUSE_OPTIMIZE_H */
@@ -0,0 +1,297 @@
+//
+// Stack usage of the functions of a program. With -fstack-usage the
+// final code of every function is measured and written to <output>.su,
+// a line per function in the format of GCC with the functions it calls
+// added. --stack-bound combines such reports along the call graph into
+// the most stack a call of each function can take.
+//
+#define _XOPEN_SOURCE 700
+#include <stdio.h>
+#undef _XOPEN_SOURCE
+
+#include "stack.h"
+#include "compiler.h"
+#include "optimize.h"
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+
+//
+// Find where a function is defined. Clones and internal entries
+// are named after the function of their source.
+//
+static const char *site_location(const struct compiler_args *args, const char *label)
+{
+    size_t len = strcspn(label, "."), i;
+    const struct stack_site *site;
+
+    for (i = 0; i < args->stack_sites.size; i++) {
+        site = (const struct stack_site*) args->stack_sites.data[i];
+        if (strlen(site->name) == len && strncmp(site->name, label, len) == 0)
+            return site->location;
+    }
+    return NULL;
+}
+
+//
+// Measure the code of one function and write its line of the report.
+//
+static void report_function(struct compiler_args *args, const char *label,
+                            const char *start, const char *end, FILE *out)
+{
+    struct function_code fn;
+    struct list callees = {0};
+    const char *location = site_location(args, label);
+    char *text = strndup(start, end - start);
+    long bytes;
+    bool ok;
+    size_t i;
+
+    function_code_parse(&fn, label, text);
+    ok = function_stack_usage(&fn, &bytes, &callees);
+    function_code_free(&fn);
+    free(text);
+
+    if (location)
+        fprintf(out, "%s:", location);
+    fprintf(out, "%s\t%ld\t%s", label, bytes, ok ? "static" : "dynamic");
+    for (i = 0; i < callees.size; i++) {
+        fprintf(out, "%c%s", i ? ',' : '\t', (char*) callees.data[i]);
+        free(callees.data[i]);
+    }
+    fputc('\n', out);
+    list_free(&callees);
+}
+
+//
+// Check whether a line of the program ends the code of a function.
+//
+static bool function_end(const char *line)
+{
+    static const char *const directives[] = { ".globl ", ".type ", ".section ", ".text", ".data", ".bss" };
+    size_t i;
+
+    for (i = 0; i < sizeof(directives) / sizeof(directives[0]); i++)
+        if (strncmp(line, directives[i], strlen(directives[i])) == 0)
+            return true;
+    return false;
+}
+
+//
+// Write the stack usage of every function in the code of a program:
+// file:line:column:name, the bytes, static or dynamic (when the depth
+// cannot be tracked), and the functions called, separated by tabs.
+//
+void stack_usage_report(struct compiler_args *args, const char *code, FILE *out)
+{
+    const char *line, *next, *start = NULL;
+    char label[BUFSIZ];
+    size_t len;
+
+    for (line = code; *line; line = next) {
+        if (!(next = strchr(line, '\n')))
+            next = line + strlen(line);
+        else
+            next++;
+        if (start && function_end(line)) {
+            report_function(args, label, start, line, out);
+            start = NULL;
+        }
+        if (strncmp(line, ".type ", 6) == 0 && (len = strcspn(line + 6, ",")) < sizeof(label) &&
+            strncmp(line + 6 + len, ", @function", 11) == 0) {
+            memcpy(label, line + 6, len);
+            label[len] = '\0';
+            start = line;
+        }
+    }
+    if (start)
+        report_function(args, label, start, line, out);
+}
+
+//
+// A function of the stack usage reports, and the bound of its calls.
+//
+struct stack_fn {
+    char *name;
+    long bytes;         /* stack of the function itself, return address included */
+    bool dynamic;       /* its depth could not be tracked */
+    struct list callees; /* names of the functions called, "*" for computed calls */
+    int state;          /* 0 not searched, 1 on the path searched, 2 done */
+    long bound;         /* most stack of a call, the callees included */
+    bool bound_dynamic; /* a dynamic function can be reached */
+    char *unbounded;    /* why the stack has no bound, or NULL */
+    size_t visit;       /* last function searched for callees without report */
+};
+
+static struct stack_fn *find_fn(struct list *fns, const char *name)
+{
+    size_t i;
+
+    for (i = 0; i < fns->size; i++)
+        if (strcmp(((struct stack_fn*) fns->data[i])->name, name) == 0)
+            return (struct stack_fn*) fns->data[i];
+    return NULL;
+}
+
+//
+// Read a stack usage report. A function reported twice keeps
+// its first line.
+//
+static int read_report(struct compiler_args *args, const char *path, struct list *fns)
+{
+    FILE *in = fopen(path, "r");
+    char *line = NULL, *field[4], *name, *p;
+    size_t size = 0, i;
+    unsigned num_fields;
+    struct stack_fn *fn;
+
+    if (!in) {
+        eprintf(args->arg0, "%s: %s\n", path, strerror(errno));
+        return 1;
+    }
+    while (getline(&line, &size, in) > 0) {
+        line[strcspn(line, "\n")] = '\0';
+        for (num_fields = 0, p = line; p && num_fields < 4; num_fields++) {
+            field[num_fields] = p;
+            if ((p = strchr(p, '\t')))
+                *p++ = '\0';
+        }
+        if (num_fields < 3) {
+            eprintf(args->arg0, "%s: malformed stack usage line " QUOTE_FMT("%s") "\n", path, line);
+            free(line);
+            fclose(in);
+            return 1;
+        }
+        name = (name = strrchr(field[0], ':')) ? name + 1 : field[0];
+        if (find_fn(fns, name))
+            continue;
+
+        fn = (struct stack_fn*) calloc(1, sizeof(struct stack_fn));
+        fn->name = strdup(name);
+        fn->bytes = strtol(field[1], NULL, 10);
+        fn->dynamic = strncmp(field[2], "dynamic", 7) == 0;
+        for (p = num_fields > 3 ? field[3] : ""; *p; p += i + (p[i] == ',')) {
+            i = strcspn(p, ",");
+            list_push(&fn->callees, strndup(p, i));
+        }
+        list_push(fns, fn);
+    }
+    free(line);
+    fclose(in);
+    return 0;
+}
+
+//
+// Find the most stack a call of a function can take: its own plus
+// that of its deepest callee. Recursion and computed calls leave it
+// without a bound; functions without report are not counted.
+//
+static void find_bound(struct list *fns, struct stack_fn *fn)
+{
+    struct stack_fn *callee;
+    char reason[BUFSIZ];
+    const char *name;
+    size_t i;
+
+    fn->state = 1;
+    fn->bound = fn->bytes;
+    fn->bound_dynamic = fn->dynamic;
+    for (i = 0; i < fn->callees.size; i++) {
+        name = (const char*) fn->callees.data[i];
+        callee = find_fn(fns, name);
+        reason[0] = '\0';
+        if (strcmp(name, "*") == 0)
+            snprintf(reason, sizeof(reason), "computed call in %s", fn->name);
+        else if (!callee)
+            continue;
+        else if (callee->state == 1)
+            snprintf(reason, sizeof(reason), "recursion through %s", callee->name);
+        else {
+            if (callee->state == 0)
+                find_bound(fns, callee);
+            if (fn->bytes + callee->bound > fn->bound)
+                fn->bound = fn->bytes + callee->bound;
+            fn->bound_dynamic |= callee->bound_dynamic;
+            if (callee->unbounded)
+                snprintf(reason, sizeof(reason), "%s", callee->unbounded);
+        }
+        if (reason[0] && !fn->unbounded)
+            fn->unbounded = strdup(reason);
+    }
+    fn->state = 2;
+}
+
+//
+// Collect the functions without report that a function can reach.
+//
+static void find_uncounted(struct list *fns, struct stack_fn *fn, size_t visit, struct list *names)
+{
+    struct stack_fn *callee;
+    const char *name;
+    size_t i, j;
+
+    fn->visit = visit;
+    for (i = 0; i < fn->callees.size; i++) {
+        name = (const char*) fn->callees.data[i];
+        if (strcmp(name, "*") == 0)
+            continue;
+        if ((callee = find_fn(fns, name))) {
+            if (callee->visit != visit)
+                find_uncounted(fns, callee, visit, names);
+            continue;
+        }
+        for (j = 0; j < names->size && strcmp(names->data[j], name) != 0; j++)
+            ;
+        if (j == names->size)
+            list_push(names, (void*) name);
+    }
+}
+
+//
+// Combine the stack usage reports given as input files, and print
+// the bound of every function as an entry point: its name, the bytes,
+// static, dynamic or unbounded, and the reason and the functions not
+// counted, if any.
+//
+int stack_bound(struct compiler_args *args)
+{
+    struct list fns = {0}, names = {0};
+    struct stack_fn *fn;
+    size_t i, j;
+    int exit_code = 0;
+
+    for (i = 0; i < (size_t) args->num_input_files && !exit_code; i++)
+        exit_code = read_report(args, args->input_files[i], &fns);
+
+    for (i = 0; i < fns.size && !exit_code; i++) {
+        fn = (struct stack_fn*) fns.data[i];
+        if (fn->state == 0)
+            find_bound(&fns, fn);
+        if (names.size)
+            list_clear(&names);
+        find_uncounted(&fns, fn, i + 1, &names);
+
+        printf("%s\t%ld\t%s", fn->name, fn->bound,
+            fn->unbounded ? "unbounded" : fn->bound_dynamic ? "dynamic" : "static");
+        if (fn->unbounded || names.size)
+            printf("\t%s%s", fn->unbounded ? fn->unbounded : "", fn->unbounded && names.size ? "; " : "");
+        for (j = 0; j < names.size; j++)
+            printf("%s%s", j ? ", " : "not counted: ", (char*) names.data[j]);
+        printf("\n");
+    }
+    list_free(&names);
+
+    for (i = 0; i < fns.size; i++) {
+        fn = (struct stack_fn*) fns.data[i];
+        for (j = 0; j < fn->callees.size; j++)
+            free(fn->callees.data[j]);
+        list_free(&fn->callees);
+        free(fn->unbounded);
+        free(fn->name);
+        free(fn);
+    }
+    list_free(&fns);
+    return exit_code;
+}
@@ -0,0 +1,20 @@
+#ifndef BCAUSE_STACK_H
+#define BCAUSE_STACK_H
+
+#include <stdio.h>
+#include "list.h"
+
+struct compiler_args;
+
+//
+// Where a function of the program is defined, for the stack usage report.
+//
+struct stack_site {
+    char *name;         /* name of the function */
+    char *location;     /* file:line:column of the definition */
+};
+
+void stack_usage_report(struct compiler_args *args, const char *code, FILE *out);
+int stack_bound(struct compiler_args *args);
+
+#endif /* BCAUSE_STACK_H */
@@ -0,0 +1,133 @@
+//
+// Vector kernels of libb over words, included by libb.c once for each
+// instruction set. KERNEL(name) names the functions, KERNEL_TARGET gives
+// their attributes and KERNEL_BYTES the size of a vector register.
+// Words left over after the last whole vector are done one at a time.
+//
+
+#define KERNEL_LANES ((long) (KERNEL_BYTES / sizeof(B_TYPE)))
+
+/* vectors of words as found in B vectors, aligned to a word only */
+typedef B_TYPE KERNEL(vec) __attribute__((vector_size(KERNEL_BYTES), aligned(sizeof(B_TYPE)), __may_alias__));
+typedef B_UTYPE KERNEL(uvec) __attribute__((vector_size(KERNEL_BYTES), aligned(sizeof(B_TYPE)), __may_alias__));
+
+/* sum of the words, wrapping around */
+KERNEL_TARGET static B_TYPE KERNEL(sum)(const B_TYPE *v, long n)
+{
+    KERNEL(uvec) acc = {0};
+    B_UTYPE sum = 0;
+    long i = 0, j;
+
+    for (; i + KERNEL_LANES <= n; i += KERNEL_LANES)
+        acc += *(const KERNEL(uvec)*) (v + i);
+    for (j = 0; j < KERNEL_LANES; j++)
+        sum += acc[j];
+    for (; i < n; i++)
+        sum += v[i];
+    return sum;
+}
+
+/* index of the first smallest word, or of the first largest one with
+   flip set to -1: complementing the words reverses their order */
+KERNEL_TARGET static long KERNEL(extreme)(const B_TYPE *v, long n, B_TYPE flip)
+{
+    KERNEL(vec) best, index, at, value, less;
+    B_TYPE min;
+    long i, j, found;
+
+    if (n <= 0)
+        return -1;
+    if (n < KERNEL_LANES) {
+        for (found = 0, i = 1; i < n; i++)
+            if ((v[i] ^ flip) < (v[found] ^ flip))
+                found = i;
+        return found;
+    }
+
+    best = *(const KERNEL(vec)*) v ^ flip;
+    for (j = 0; j < KERNEL_LANES; j++)
+        index[j] = at[j] = j;
+    for (i = KERNEL_LANES; i + KERNEL_LANES <= n; i += KERNEL_LANES) {
+        at += KERNEL_LANES;
+        value = *(const KERNEL(vec)*) (v + i) ^ flip;
+        less = value < best;
+        best = (value & less) | (best & ~less);
+        index = (at & less) | (index & ~less);
+    }
+
+    /* the lanes hold the first smallest word of their columns */
+    found = index[0];
+    min = best[0];
+    for (j = 1; j < KERNEL_LANES; j++) {
+        if (best[j] < min || (best[j] == min && index[j] < found)) {
+            found = index[j];
+            min = best[j];
+        }
+    }
+    for (; i < n; i++) {
+        if ((v[i] ^ flip) < min) {
+            found = i;
+            min = v[i] ^ flip;
+        }
+    }
+    return found;
+}
+
+/* sum of the products of the words, wrapping around */
+KERNEL_TARGET static B_TYPE KERNEL(dot)(const B_TYPE *x, const B_TYPE *y, long n)
+{
+    KERNEL(uvec) acc = {0};
+    B_UTYPE sum = 0;
+    long i = 0, j;
+
+    for (; i + KERNEL_LANES <= n; i += KERNEL_LANES)
+        acc += *(const KERNEL(uvec)*) (x + i) * *(const KERNEL(uvec)*) (y + i);
+    for (j = 0; j < KERNEL_LANES; j++)
+        sum += acc[j];
+    for (; i < n; i++)
+        sum += (B_UTYPE) x[i] * (B_UTYPE) y[i];
+    return sum;
+}
+
+/* y += a * x */
+KERNEL_TARGET static void KERNEL(axpy)(B_TYPE *y, B_TYPE a, const B_TYPE *x, long n)
+{
+    long i = 0;
+
+    for (; i + KERNEL_LANES <= n; i += KERNEL_LANES)
+        *(KERNEL(uvec)*) (y + i) += *(const KERNEL(uvec)*) (x + i) * (B_UTYPE) a;
+    for (; i < n; i++)
+        y[i] = (B_UTYPE) y[i] + (B_UTYPE) a * (B_UTYPE) x[i];
+}
+
+/* number of words equal to the value, or not above it with below set */
+KERNEL_TARGET static long KERNEL(count)(const B_TYPE *v, long n, B_TYPE value, int below)
+{
+    KERNEL(vec) acc = {0}, word;
+    long i = 0, j, count = 0;
+
+    /* a true comparison is -1 in every bit of its lane */
+    if (below) {
+        for (; i + KERNEL_LANES <= n; i += KERNEL_LANES) {
+            word = *(const KERNEL(vec)*) (v + i);
+            acc -= word <= value;
+        }
+    }
+    else {
+        for (; i + KERNEL_LANES <= n; i += KERNEL_LANES) {
+            word = *(const KERNEL(vec)*) (v + i);
+            acc -= word == value;
+        }
+    }
+    for (j = 0; j < KERNEL_LANES; j++)
+        count += acc[j];
+    for (; i < n; i++)
+        count += below ? v[i] <= value : v[i] == value;
+    return count;
+}
+
+static const struct vector_kernels KERNEL(kernels) = {
+    KERNEL(sum), KERNEL(extreme), KERNEL(dot), KERNEL(axpy), KERNEL(count),
+};
+
+#undef KERNEL_LANES
@@ -2,11 +2,21 @@
 // This is a minimal implementation of libb, the standard library for the B programming language (1969)
 //
 #include <stdarg.h>
+#include <stdint.h>
 #ifndef B_TYPE
-    /* type representing B's single data type (64-bit int on x86_64) */
-    #include <stdint.h>
-    #define B_TYPE intptr_t
+    #ifdef B_WORD32
+        /* type representing B's single data type in 32-bit word mode;
+           all addresses have to fit into the low 2 GB */
+        #define B_TYPE int32_t
+        #define B_UTYPE uint32_t
+    #else
+        /* type representing B's single data type (64-bit int on x86_64) */
+        #define B_TYPE intptr_t
+        #define B_UTYPE uintptr_t
+    #endif
 #endif
+/* converts a B word holding an address to a pointer */
+#define B_PTR(word) ((void*) (intptr_t) (word))
 #ifndef B_FN
     /* this macro allows to give each B std function a pre- or postfix
        to avoid issues with common names
@@ -19,6 +29,23 @@
     #define MAX_EXECL_ARGS 128
 #endif
 
+// defines the size of the stack B programs run on in 32-bit word mode
+#ifndef B_STACK_SIZE
+    #define B_STACK_SIZE (8L << 20)
+#endif
+
+// defines the number of segments collected by vwrite() and friends
+// before they are submitted with a single writev()
+#ifndef MAX_GATHER_SEGMENTS
+    #define MAX_GATHER_SEGMENTS 64
+#endif
+
+// defines the size of the buffer holding converted numbers and characters
+// of a gathered record
+#ifndef GATHER_SCRATCH_SIZE
+    #define GATHER_SCRATCH_SIZE 512
+#endif
+
 // standard unix IO files
 #define stdin  0
 #define stdout 1
@@ -61,6 +88,18 @@ static inline SYSCALL_TYPE __syscall3(SYSCALL_TYPE n, SYSCALL_TYPE a1, SYSCALL_T
 	return ret;
 }
 
+static inline SYSCALL_TYPE __syscall6(SYSCALL_TYPE n, SYSCALL_TYPE a1, SYSCALL_TYPE a2, SYSCALL_TYPE a3,
+                                      SYSCALL_TYPE a4, SYSCALL_TYPE a5, SYSCALL_TYPE a6)
+{
+	unsigned SYSCALL_TYPE ret;
+	register SYSCALL_TYPE r10 __asm__("r10") = a4;
+	register SYSCALL_TYPE r8 __asm__("r8") = a5;
+	register SYSCALL_TYPE r9 __asm__("r9") = a6;
+	__asm__ __volatile__ ("syscall" : "=a"(ret) : "a"(n), "D"(a1), "S"(a2),
+						  "d"(a3), "r"(r10), "r"(r8), "r"(r9) : "rcx", "r11", "memory");
+	return ret;
+}
+
 #define __scc(X) ((SYSCALL_TYPE) (X))
 
 #define __syscall1(n,a) __syscall1(n,__scc(a))
@@ -84,6 +123,12 @@ static inline SYSCALL_TYPE __syscall3(SYSCALL_TYPE n, SYSCALL_TYPE a1, SYSCALL_T
 #define SYS_stat 4
 #define SYS_fstat 5
 #define SYS_seek 8
+#define SYS_mmap 9
+#define SYS_mprotect 10
+#define SYS_munmap 11
+#define SYS_mremap 25
+#define SYS_madvise 28
+#define SYS_writev 20
 #define SYS_fork 57
 #define SYS_execve 59
 #define SYS_exit 60
@@ -133,6 +178,206 @@ static void __assert_fail(const char* condition, const char* file, const int lin
     syscall(SYS_exit, 127);
 }
 
+/*
+Gather output implementation
+*/
+
+/* one output segment, layout-compatible with the kernel's struct iovec */
+struct __iovec {
+    const void *base;
+    unsigned long len;
+};
+
+/* a record being gathered: segments point either into the caller's
+   memory or into the scratch buffer holding converted values */
+struct __gather_record {
+    B_TYPE file;
+    int count;
+    unsigned long scratch_used;
+    struct __iovec iov[MAX_GATHER_SEGMENTS];
+    char scratch[GATHER_SCRATCH_SIZE];
+};
+
+/* the record of vbegin() and friends */
+static struct __gather_record __gather;
+
+/* submit all gathered segments with writev(), retrying on partial writes */
+static B_TYPE __gather_flush(struct __gather_record *g)
+{
+    struct __iovec *iov = g->iov;
+    int count = g->count;
+    B_TYPE total = 0;
+    SYSCALL_TYPE written;
+
+    while(count > 0) {
+        written = syscall(SYS_writev, g->file, iov, count);
+        if(written < 0) {
+            total = written;
+            break;
+        }
+        total += written;
+        while(count > 0 && (unsigned long) written >= iov->len) {
+            written -= iov->len;
+            iov++;
+            count--;
+        }
+        if(count > 0) {
+            iov->base = (const char*) iov->base + written;
+            iov->len -= written;
+        }
+    }
+
+    g->count = 0;
+    g->scratch_used = 0;
+    return total;
+}
+
+/* start a record on the given file; a pending record on another file is
+   written out first so the output order matches the call order */
+static void __gather_begin(struct __gather_record *g, B_TYPE file)
+{
+    if(g->count && g->file != file)
+        __gather_flush(g);
+    g->file = file;
+}
+
+/* append a segment without copying it */
+static void __gather_segment(struct __gather_record *g, const char *base, unsigned long len)
+{
+    struct __iovec *last;
+
+    if(!len)
+        return;
+    if(g->count) {
+        last = &g->iov[g->count - 1];
+        if((const char*) last->base + last->len == base) {
+            last->len += len;
+            return;
+        }
+    }
+    if(g->count == MAX_GATHER_SEGMENTS)
+        __gather_flush(g);
+    g->iov[g->count].base = base;
+    g->iov[g->count].len = len;
+    g->count++;
+}
+
+/* reserve room for len bytes in the scratch buffer; the segment
+   referring to it is guaranteed to fit without another flush */
+static char *__gather_scratch(struct __gather_record *g, unsigned long len)
+{
+    if(g->scratch_used + len > GATHER_SCRATCH_SIZE || g->count == MAX_GATHER_SEGMENTS)
+        __gather_flush(g);
+    g->scratch_used += len;
+    return g->scratch + g->scratch_used - len;
+}
+
+/* append the characters of a word, like putchar() */
+static void __gather_char(struct __gather_record *g, B_TYPE chr)
+{
+    unsigned len = sizeof(B_TYPE);
+    char *p;
+
+    while(len > 1 && (char) (chr >> (len - 1) * 8) == 0)
+        len--;
+    p = __gather_scratch(g, len);
+    for(unsigned i = 0; i < len; i++)
+        p[i] = chr >> i * 8;
+    __gather_segment(g, p, len);
+}
+
+/* append a signed number converted to the base b */
+static void __gather_number(struct __gather_record *g, B_TYPE n, B_TYPE b)
+{
+    char digits[sizeof(B_TYPE) * 8 + 1];
+    unsigned long m = n < 0 ? -(unsigned long) n : (unsigned long) n;
+    unsigned len = 0;
+    char *p;
+
+    do {
+        digits[len++] = m % b + '0';
+        m /= b;
+    } while(m);
+    if(n < 0)
+        digits[len++] = '-';
+
+    p = __gather_scratch(g, len);
+    for(unsigned i = 0; i < len; i++)
+        p[i] = digits[len - 1 - i];
+    __gather_segment(g, p, len);
+}
+
+/*
+Vector kernels implementation
+*/
+
+/* kernels over n words of B vectors for one instruction set */
+struct vector_kernels {
+    B_TYPE (*sum)(const B_TYPE *v, long n);
+    long (*extreme)(const B_TYPE *v, long n, B_TYPE flip);
+    B_TYPE (*dot)(const B_TYPE *x, const B_TYPE *y, long n);
+    void (*axpy)(B_TYPE *y, B_TYPE a, const B_TYPE *x, long n);
+    long (*count)(const B_TYPE *v, long n, B_TYPE value, int below);
+};
+
+/* B code keeps the stack aligned to words only */
+#define KERNEL(name) __sse2_##name
+#define KERNEL_TARGET __attribute__((force_align_arg_pointer))
+#define KERNEL_BYTES 16
+#include "kernels.h"
+#undef KERNEL
+#undef KERNEL_TARGET
+#undef KERNEL_BYTES
+
+#define KERNEL(name) __avx2_##name
+#define KERNEL_TARGET __attribute__((force_align_arg_pointer, target("avx2")))
+#define KERNEL_BYTES 32
+#include "kernels.h"
+#undef KERNEL
+#undef KERNEL_TARGET
+#undef KERNEL_BYTES
+
+#define KERNEL(name) __avx512_##name
+#define KERNEL_TARGET __attribute__((force_align_arg_pointer, target("avx512f,avx512dq")))
+#define KERNEL_BYTES 64
+#include "kernels.h"
+#undef KERNEL
+#undef KERNEL_TARGET
+#undef KERNEL_BYTES
+
+static const struct vector_kernels *__kernels;
+
+static void __cpuid(unsigned leaf, unsigned *regs)
+{
+    __asm__ ("cpuid" : "=a"(regs[0]), "=b"(regs[1]), "=c"(regs[2]), "=d"(regs[3]) : "a"(leaf), "c"(0));
+}
+
+/* choose the kernels for the widest vectors the processor and the
+   kernel support: the registers have to be saved by the kernel, which
+   is told by the state components enabled in XCR0 */
+static const struct vector_kernels *__vector_kernels(void)
+{
+    unsigned regs[4], max_leaf, xcr0_low, xcr0_high;
+
+    if (__kernels)
+        return __kernels;
+    __kernels = &__sse2_kernels;
+
+    __cpuid(0, regs);
+    max_leaf = regs[0];
+    __cpuid(1, regs);
+    if (max_leaf < 7 || !(regs[2] & 1u << 27)) /* OSXSAVE */
+        return __kernels;
+    __asm__ ("xgetbv" : "=a"(xcr0_low), "=d"(xcr0_high) : "c"(0));
+    (void) xcr0_high;
+    __cpuid(7, regs);
+    if ((xcr0_low & 0x06) == 0x06 && (regs[1] & 1u << 5)) /* YMM state, AVX2 */
+        __kernels = &__avx2_kernels;
+    if ((xcr0_low & 0xe6) == 0xe6 && (regs[1] & 1u << 16) && (regs[1] & 1u << 17)) /* ZMM state, AVX-512F and DQ */
+        __kernels = &__avx512_kernels;
+    return __kernels;
+}
+
 /*
 B standard library implementation
 */
@@ -141,20 +386,117 @@ B standard library implementation
 extern B_TYPE B_FN(main)(void);
 void B_FN(exit)(void);
 
+#ifndef B_NO_START
 /* entry point of any B program */
 void _start(void) __asm__ ("_start"); /* assure, that _start is really named _start in asm */
+
+/* mmap() flags */
+#define PROT_READ 1
+#define PROT_WRITE 2
+#define PROT_EXEC 4
+#define MAP_PRIVATE 0x02
+#define MAP_ANONYMOUS 0x20
+#define MAP_32BIT 0x40
+
+/* huge pages of transparent huge page support */
+#define HUGE_PAGE_SIZE (2L << 20)
+#define MADV_HUGEPAGE 14
+#define MREMAP_MAYMOVE 1
+#define MREMAP_FIXED 2
+#define HUGE_ALIGN_DOWN(addr) ((char*) ((unsigned long) (addr) & -HUGE_PAGE_SIZE))
+#define HUGE_ALIGN_UP(addr) HUGE_ALIGN_DOWN((char*) (addr) + HUGE_PAGE_SIZE - 1)
+
+/* bounds of the program image, from the linker; the start of .data is
+   defined only when linking with -fhuge-pages, which aligns the text
+   and data segments to huge pages */
+extern char __executable_start[], etext[], end[];
+extern char __huge_pages_data[] __attribute__((weak));
+
+/* move a region of the image onto anonymous memory backed by huge pages:
+   copy its contents up to used to an aligned mapping advised for huge pages,
+   then put that mapping in its place. The text keeps running, as the bytes
+   are the same. */
+static void __huge_remap(char *start, char *used, char *stop, long prot)
+{
+    unsigned long size = stop - start, n = used - start;
+    char *area, *copy;
+    const char *from = start;
+
+    if (stop <= start)
+        return;
+    area = (char*) __syscall6(SYS_mmap, 0, size + HUGE_PAGE_SIZE, PROT_READ | PROT_WRITE,
+                              MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if ((unsigned long) area > -4096UL)
+        return;
+    copy = HUGE_ALIGN_UP(area);
+    if (copy > area)
+        syscall(SYS_munmap, area, copy - area);
+    syscall(SYS_munmap, copy + size, area + HUGE_PAGE_SIZE - copy);
+
+    syscall(SYS_madvise, copy, size, MADV_HUGEPAGE);
+    __asm__ __volatile__ ("rep movsb" : "+D"(copy), "+S"(from), "+c"(n) : : "memory");
+    copy -= used - start;
+    if (syscall(SYS_mprotect, copy, size, prot) != 0 ||
+        __syscall6(SYS_mremap, (long) copy, size, size, MREMAP_MAYMOVE | MREMAP_FIXED, (long) start, 0) != (long) start)
+        syscall(SYS_munmap, copy, size);
+}
+
+/* back the text and the big data of the program by huge pages */
+static void __huge_pages(void)
+{
+    if (!__huge_pages_data)
+        return;
+
+    /* the text segment starts on a huge page boundary, and the linker
+       keeps the rest of its last huge page free */
+    __huge_remap(HUGE_ALIGN_UP(__executable_start + 1), etext, HUGE_ALIGN_UP(etext), PROT_READ | PROT_EXEC);
+
+    /* so does the data segment start; only its whole huge pages are moved */
+    __huge_remap(HUGE_ALIGN_DOWN(__huge_pages_data), HUGE_ALIGN_DOWN(end), HUGE_ALIGN_DOWN(end),
+                 PROT_READ | PROT_WRITE);
+}
+
+#ifdef B_WORD32
+
+void _start(void) {
+    char *stack;
+
+    assert(sizeof(B_TYPE) == 4); /* assert that libb was built for 32-bit words. */
+    __huge_pages();
+    __vector_kernels();
+
+    /* B words hold addresses: the program image is linked below 2 GB,
+       so move the stack there too before entering main() */
+    stack = (char*) __syscall6(SYS_mmap, 0, B_STACK_SIZE, PROT_READ | PROT_WRITE,
+                               MAP_PRIVATE | MAP_ANONYMOUS | MAP_32BIT, -1, 0);
+    assert((unsigned long) stack < 0x80000000UL);
+
+    __asm__ __volatile__ (
+        "mov %0, %%rsp\n"
+        "call *%1\n"
+        "mov %%rax, %%rdi\n"
+        "mov %2, %%eax\n"
+        "syscall\n"
+        : : "r"(stack + B_STACK_SIZE), "r"(B_FN(main)), "i"(SYS_exit) : "memory");
+    __builtin_unreachable();
+}
+#else
 void _start(void) {
     assert(sizeof(B_TYPE) == sizeof(void*)); /* assert that the size of the B type is equal
                                                 to the word (address) size. This is crucial
                                                 for any B program to work correctly.*/
+    __huge_pages();
+    __vector_kernels();
     B_TYPE code = B_FN(main)();
     syscall(SYS_exit, code);
 }
+#endif
+#endif /* B_NO_START */
 
 /* The i-th character of the string is returned */
 B_TYPE B_FN(_char)(B_TYPE string, B_TYPE i) __asm__ ("char"); /* alias name */
 B_TYPE B_FN(_char)(B_TYPE string, B_TYPE i) {
-    return ((char*) string)[i];
+    return ((char*) B_PTR(string))[i];
 }
 
 /* The path name represented by the string becomes the current directory.
@@ -201,8 +543,8 @@ static char month_strs[12][3] = {
 void B_FN(ctime)(B_TYPE time_vec, B_TYPE date) {
     short hour, minute, second;
     long a, b, c, d, month, day;
-    B_TYPE time = *(B_TYPE*) time_vec;
-    char *date_vec = (void*) date;
+    B_TYPE time = *(B_TYPE*) B_PTR(time_vec);
+    char *date_vec = B_PTR(date);
 
     second = time % 60;
     time /= 60;
@@ -248,14 +590,16 @@ void B_FN(ctime)(B_TYPE time_vec, B_TYPE date) {
    file specified by string. The arg-i strings are passed as
    arguments. A return indicates an error. */
 void B_FN(execl)(B_TYPE string, ...) {
-    static B_TYPE args[MAX_EXECL_ARGS];
-    B_TYPE envp;
+    static void *args[MAX_EXECL_ARGS];
+    void *envp = 0;
     int i = 0;
 
     va_list ap;
     va_start(ap, string);
 
-    while((args[i] = va_arg(ap, B_TYPE)) && i <= MAX_EXECL_ARGS);
+    while(i < MAX_EXECL_ARGS - 1 && (args[i] = B_PTR(va_arg(ap, B_TYPE))))
+        i++;
+    args[i] = 0;
 
     syscall(SYS_execve, string, args, &envp);
     va_end(ap);
@@ -266,10 +610,10 @@ void B_FN(execl)(B_TYPE string, ...) {
    count are passed as arguments. A return indicates an er-
    ror. */
 void B_FN(execv)(B_TYPE string, B_TYPE argv, B_TYPE count) {
-    B_TYPE envp = 0;
-    B_TYPE args[count + 1];
+    void *envp = 0;
+    void *args[count + 1];
     for(B_TYPE i = 0; i < count; i++) {
-        args[i] = ((B_TYPE*)argv)[i];
+        args[i] = B_PTR(((B_TYPE*) B_PTR(argv))[i]);
     }
     args[count] = 0;
     syscall(SYS_execve, string, args, &envp);
@@ -321,7 +665,7 @@ B_TYPE B_FN(gtty)(B_TYPE file, B_TYPE ttystat) {
 
 /* The character char is stored in the i-th character of the string. */
 void B_FN(lchar)(B_TYPE string, B_TYPE i, B_TYPE chr) {
-    ((char*) string)[i] = chr;
+    ((char*) B_PTR(string))[i] = chr;
 }
 
 /* The pathname specified by string2 is created such that it
@@ -346,49 +690,54 @@ B_TYPE B_FN(open)(B_TYPE string, B_TYPE mode) {
    conversion subroutine. The first argument is a format string.
    Character sequences,of the form ‘%x’ are interpreted and cause
    conversion of type x’ of the next argument, other character
-   sequences are printed verbatim. */
+   sequences are printed verbatim.
+   The output is gathered into segments and written by a single
+   writev() call, so runs of verbatim text and ‘%s’ arguments are
+   never copied. A record started by vbegin() is left pending. */
 void B_FN(printf)(B_TYPE fmt, ...) {
-    B_TYPE x, c, i = 0, j;
+    const char *s = B_PTR(fmt);
+    B_TYPE x;
+    long i = 0, j;
+    char c;
+    struct __gather_record record;
 
     va_list ap;
     va_start(ap, fmt);
-loop:
-    while((c = B_FN(_char)(fmt, i++)) != '%') {
-        if(c == '\0')
-            goto end;
-        B_FN(putchar)(c);
-    }
-    switch(c = B_FN(_char)(fmt, i++)) {
-        case 'd': /* decimal */
-        case 'o': /* octal */
-            x = va_arg(ap, B_TYPE);
-            if(x < 0) {
-                x = -x;
-                B_FN(putchar)('-');
-            }
-            B_FN(printn)(x, c == 'o' ? 8 : 10);
-            goto loop;
-
-        case 'c':
-            x = va_arg(ap, B_TYPE);
-            B_FN(putchar)(x);
-            goto loop;
-
-        case 's':
-            x = va_arg(ap, B_TYPE);
-            j = 0;
-            while((c = B_FN(_char)(x, j++)) != '\0')
-                B_FN(putchar)(c);
-            goto loop;
-        case '%':
-            B_FN(putchar)('%');
-            goto loop;
+    record.file = stdout;
+    record.count = 0;
+    record.scratch_used = 0;
+    for(;;) {
+        for(j = i; s[j] != '%' && s[j] != '\0'; j++);
+        __gather_segment(&record, s + i, j - i);
+        if(s[j] == '\0')
+            break;
+
+        i = j + 2;
+        switch(c = s[j + 1]) {
+            case 'd': /* decimal */
+            case 'o': /* octal */
+                __gather_number(&record, va_arg(ap, B_TYPE), c == 'o' ? 8 : 10);
+                continue;
+
+            case 'c':
+                __gather_char(&record, va_arg(ap, B_TYPE));
+                continue;
+
+            case 's':
+                x = va_arg(ap, B_TYPE);
+                __gather_segment(&record, B_PTR(x), strlen(B_PTR(x)));
+                continue;
+
+            case '%':
+                __gather_segment(&record, s + j, 1);
+                continue;
+        }
+
+        /* unknown conversion: print the ‘%’ and rescan the rest verbatim */
+        __gather_segment(&record, s + j, 1);
+        i = j + 1;
     }
-    B_FN(putchar)(c);
-    i--;
-    goto loop;
-
-end:
+    __gather_flush(&record);
     va_end(ap);
 }
 
@@ -420,7 +769,7 @@ void B_FN(putchar)(B_TYPE chr) {
     u.word = chr;
     while (len > 1 && u.c[len-1] == 0)
         len--;
-    syscall(SYS_write, 1, (B_TYPE)&u, len);
+    syscall(SYS_write, 1, &u, len);
 }
 
 /* Count bytes are read into the vector buffer from the open
@@ -466,7 +815,7 @@ B_TYPE B_FN(stty)(B_TYPE file, B_TYPE ttystat) {
 
 /* The current system time is returned in the 1-word vector timev. */
 void B_FN(time)(B_TYPE timev) {
-    *((B_TYPE*) timev) = syscall(SYS_time, 0);
+    *((B_TYPE*) B_PTR(timev)) = syscall(SYS_time, 0);
 }
 
 /* The link specified by the string is removed. A negative
@@ -491,3 +840,84 @@ B_TYPE B_FN(wait)(void) {
 B_TYPE B_FN(nwrite)(B_TYPE file, B_TYPE buffer, B_TYPE count) {
     return (B_TYPE) syscall(SYS_write, file, buffer, count);
 }
+
+/* A record for the open file designated by file is started.
+   Segments appended by vwrite(), vputs(), vputchar() and
+   vprintn() are collected and written out together by vflush().
+   A pending record on another file is written out first. */
+void B_FN(vbegin)(B_TYPE file) {
+    __gather_begin(&__gather, file);
+}
+
+/* Count bytes of the vector buffer are appended to the current
+   record. The buffer is not copied and must not change until
+   the record is written out. */
+void B_FN(vwrite)(B_TYPE buffer, B_TYPE count) {
+    if(count > 0)
+        __gather_segment(&__gather, B_PTR(buffer), count);
+}
+
+/* The string is appended to the current record without being
+   copied. */
+void B_FN(vputs)(B_TYPE string) {
+    __gather_segment(&__gather, B_PTR(string), strlen(B_PTR(string)));
+}
+
+/* The character char is appended to the current record. */
+void B_FN(vputchar)(B_TYPE chr) {
+    __gather_char(&__gather, chr);
+}
+
+/* The number n converted to the base b is appended to the
+   current record. */
+void B_FN(vprintn)(B_TYPE n, B_TYPE b) {
+    __gather_number(&__gather, n, b);
+}
+
+/* The current record is written out with a single writev().
+   The number of bytes written is returned. A negative number
+   returned indicates an error. */
+B_TYPE B_FN(vflush)(void) {
+    return __gather_flush(&__gather);
+}
+
+/* The sum of the count words of the vector v is returned. */
+B_TYPE B_FN(vsum)(B_TYPE v, B_TYPE count) {
+    return __vector_kernels()->sum(B_PTR(v), count);
+}
+
+/* The index of the first smallest of the count words of the
+   vector v is returned, or -1 if count is not positive. */
+B_TYPE B_FN(vmin)(B_TYPE v, B_TYPE count) {
+    return __vector_kernels()->extreme(B_PTR(v), count, 0);
+}
+
+/* The index of the first largest of the count words of the
+   vector v is returned, or -1 if count is not positive. */
+B_TYPE B_FN(vmax)(B_TYPE v, B_TYPE count) {
+    return __vector_kernels()->extreme(B_PTR(v), count, -1);
+}
+
+/* The sum of the products of the first count words of the
+   vectors x and y is returned. */
+B_TYPE B_FN(vdot)(B_TYPE x, B_TYPE y, B_TYPE count) {
+    return __vector_kernels()->dot(B_PTR(x), B_PTR(y), count);
+}
+
+/* a times each of the first count words of the vector x is
+   added to the word of the vector y at the same index. */
+void B_FN(vaxpy)(B_TYPE y, B_TYPE a, B_TYPE x, B_TYPE count) {
+    __vector_kernels()->axpy(B_PTR(y), a, B_PTR(x), count);
+}
+
+/* The number of the count words of the vector v equal to
+   value is returned. */
+B_TYPE B_FN(vcount)(B_TYPE v, B_TYPE count, B_TYPE value) {
+    return __vector_kernels()->count(B_PTR(v), count, value, 0);
+}
+
+/* The number of the count words of the vector v less than
+   or equal to value is returned. */
+B_TYPE B_FN(vcountle)(B_TYPE v, B_TYPE count, B_TYPE value) {
+    return __vector_kernels()->count(B_PTR(v), count, value, 1);
+}
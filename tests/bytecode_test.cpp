@@ -0,0 +1,121 @@
+#include "fixture.h"
+
+static const std::string bytecode_source = R"(
+    v[5] 1, 2, 3;
+    greeting "hello";
+
+    sum(n) {
+        extrn v;
+        auto s;
+
+        s = 0;
+        while (n > 0)
+            s =+ v[--n];
+        return (s);
+    }
+
+    fact(n) {
+        return (n <= 1 ? 1 : n * fact(n - 1));
+    }
+
+    shout(c) {
+        switch (c) {
+        case 'l':
+            return ('L');
+        }
+        return (c);
+    }
+
+    main() {
+        extrn v, greeting;
+        auto i, c, b[2];
+
+        v[3] = 10;
+        v[4] = -20 / 3;
+        printf("%d %d %d*n", sum(5), fact(10), 100 % 7);
+        i = 0;
+        while ((c = char(greeting, i)) != 0) {
+            putchar(shout(c));
+            i++;
+        }
+        lchar(b, 0, 'j');
+        lchar(b, 1, 'o');
+        lchar(b, 2, 0);
+        printf(" %s %o*n", b, 8 << 3);
+    }
+)";
+
+TEST_F(bcause, interpreter)
+{
+    const std::string expect = "10 3628800 2\nheLLo jo 100\n";
+
+    EXPECT_EQ(interpret(bytecode_source, "-O0"), expect);
+    EXPECT_EQ(interpret(bytecode_source, "-O2"), expect);
+    EXPECT_EQ(compile_and_run(bytecode_source, "-O2"), expect);
+}
+
+TEST_F(bcause, emit_bytecode)
+{
+    create_file(test_name + ".b", bytecode_source);
+
+    // The bytecode file runs as well as the source.
+    std::string result = "../bcause --emit-bytecode " + test_name + ".b -o " + test_name + ".bcb";
+    EXPECT_EQ(system(result.c_str()), 0);
+    EXPECT_TRUE(starts_with(file_contents(test_name + ".bcb"), "BCB2"));
+
+    FILE *pipe = popen(("../bcause --interp " + test_name + ".bcb").c_str(), "r");
+    ASSERT_TRUE(pipe != nullptr);
+    result = stream_contents(pipe);
+    EXPECT_EQ(pclose(pipe), 0);
+    EXPECT_EQ(result, "10 3628800 2\nheLLo jo 100\n");
+}
+
+TEST_F(bcause, interpreter_exit_status)
+{
+    create_file(test_name + ".b", "main() { return (42); }\n");
+
+    std::string command = "../bcause --interp " + test_name + ".b";
+    int status = system(command.c_str());
+    EXPECT_EQ(WEXITSTATUS(status), 42);
+}
+
+TEST_F(bcause, tiered_execution)
+{
+    // Hot functions switch to native code while the program runs,
+    // and call back into the interpreter and the library.
+    const std::string source = R"(
+        fib(n) {
+            if (n < 2)
+                return (n);
+            return (fib(n - 1) + fib(n - 2));
+        }
+
+        cold(n) {
+            return (n * 3);
+        }
+
+        sum(n) {
+            auto s;
+
+            s = 0;
+            while (n > 0)
+                s =+ cold(n--);
+            return (s);
+        }
+
+        main() {
+            auto i;
+
+            i = 0;
+            while (i < 20)
+                printf("%d ", fib(i++));
+            printf("*n%d %d %d*n", fib(22), sum(100), sum(1000));
+        }
+    )";
+    const std::string expect = "0 1 1 2 3 5 8 13 21 34 55 89 144 233 377 610 987 1597 2584 4181 \n"
+                               "17711 15150 1501500\n";
+
+    EXPECT_EQ(interpret(source, "-O0 --jit --param jit-threshold=10"), expect);
+    EXPECT_EQ(interpret(source, "-O2 --jit --param jit-threshold=10"), expect);
+    EXPECT_EQ(compile_and_run(source, "-O2"), expect);
+}
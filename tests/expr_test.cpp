@@ -328,3 +328,162 @@ TEST_F(bcause, octal_literals)
 )";
     EXPECT_EQ(output, expect);
 }
+
+TEST_F(bcause, conditional_move)
+{
+    auto output = compile_and_run(R"(
+        abs(x) return (x < 0 ? -x : x);
+        max(a, b) return (a > b ? a : b);
+        deref(p) return (p ? *p : -1);
+
+        main() {
+            auto x;
+
+            x = 42;
+            printf("%d %d*n", abs(-5), abs(7));
+            printf("%d %d*n", max(3, 9), max(9, 3));
+            printf("%d %d*n", deref(&x), deref(0));
+        }
+    )");
+    const std::string expect = R"(5 7
+9 9
+42 -1
+)";
+    EXPECT_EQ(output, expect);
+
+    // Cheap branches use cmov, a guarded load keeps the jumps.
+    auto assembly = file_contents(test_name + ".s");
+    EXPECT_NE(assembly.find("cmovne"), std::string::npos);
+    EXPECT_NE(assembly.find(".L.cond.else"), std::string::npos);
+}
+
+TEST_F(bcause, builtins)
+{
+    const std::string source = R"(
+        clz(x) return (-1);
+
+        main() {
+            extrn clz;
+
+            printf("%d %d %d*n", popcnt(0), popcnt(255), popcnt(-1));
+            printf("%d %d %d*n", ctz(0), ctz(1), ctz(-8));
+            printf("%d %d %d*n", bswap(1) == 1 << 56, rotl(-2, 1), rotl(3, 63));
+            printf("%d %d %d*n", mulhi(-1, -1), mulhi(1 << 40, 1 << 40), mulhi(3, 5));
+            printf("%d*n", clz(1));
+        }
+    )";
+    const std::string expect = R"(0 8 64
+64 0 3
+1 -3 -9223372036854775807
+-2 65536 0
+-1
+)";
+
+    // Without the instructions, counts are done by arithmetic and bsf.
+    EXPECT_EQ(compile_and_run(source), expect);
+    auto assembly = file_contents(test_name + ".s");
+    EXPECT_NE(assembly.find("bsf %rax, %rax"), std::string::npos);
+    EXPECT_EQ(assembly.find("popcnt"), std::string::npos);
+    EXPECT_NE(assembly.find("mul %rdi"), std::string::npos);
+    EXPECT_NE(assembly.find("call clz"), std::string::npos);
+
+    EXPECT_EQ(compile_and_run(source, "-mpopcnt -mbmi"), expect);
+    assembly = file_contents(test_name + ".s");
+    EXPECT_NE(assembly.find("popcnt %rax, %rax"), std::string::npos);
+    EXPECT_NE(assembly.find("tzcnt %rax, %rax"), std::string::npos);
+
+    EXPECT_EQ(interpret(source), expect);
+}
+
+TEST_F(bcause, builtin_clz)
+{
+    const std::string source = R"(
+        main() printf("%d %d %d %d*n", clz(0), clz(1), clz(-1), clz(255));
+    )";
+    EXPECT_EQ(compile_and_run(source), "64 63 0 56\n");
+    EXPECT_NE(file_contents(test_name + ".s").find("bsr %rax, %rax"), std::string::npos);
+    EXPECT_EQ(compile_and_run(source, "-mword=32"), "32 31 0 24\n");
+    EXPECT_EQ(interpret(source), "64 63 0 56\n");
+}
+
+TEST_F(bcause, builtin_named_function)
+{
+    // The function of the program is called, though defined after the call.
+    const std::string source = R"(
+        main() printf("%d %d*n", bswap(1), popcnt(255));
+
+        bswap(x) return (x + 1);
+    )";
+    EXPECT_EQ(compile_and_run(source), "2 8\n");
+    EXPECT_NE(file_contents(test_name + ".s").find("call bswap"), std::string::npos);
+    EXPECT_EQ(compile_and_run(source, "-O2"), "2 8\n");
+    EXPECT_EQ(interpret(source), "2 8\n");
+}
+
+TEST_F(bcause, memory_builtins)
+{
+    const std::string source = R"(
+        v[16];
+
+        main() {
+            extrn v;
+            auto i, p, s;
+
+            i = 0;
+            while (i < 16) {
+                p = &v[i];
+                prefetch(p + 64, 0, 0);
+                prefetch(p + 64, 1, 3);
+                ntstore(p, i * 3);
+                i++;
+            }
+            sfence();
+            s = 0;
+            i = 0;
+            while (i < 16)
+                s =+ v[i++];
+            printf("%d*n", s);
+        }
+    )";
+    EXPECT_EQ(compile_and_run(source), "360\n");
+    auto assembly = file_contents(test_name + ".s");
+    EXPECT_NE(assembly.find("prefetchnta (%rax)"), std::string::npos);
+    EXPECT_NE(assembly.find("prefetchw (%rax)"), std::string::npos);
+    EXPECT_NE(assembly.find("movnti %rax, (%rdi)"), std::string::npos);
+    EXPECT_NE(assembly.find("sfence"), std::string::npos);
+
+    EXPECT_EQ(compile_and_run(source, "-mword=32"), "360\n");
+    EXPECT_EQ(interpret(source), "360\n");
+}
+
+TEST_F(bcause, memory_builtin_named_function)
+{
+    // Functions of the program take any arguments, and likely() gives no hint.
+    const std::string source = R"(
+        main() {
+            auto a, b, c;
+
+            a = 1;
+            b = 2;
+            c = 3;
+            if (likely(a))
+                printf("%d %d*n", prefetch(a, b, c), likely(5));
+            sfence();
+        }
+
+        prefetch(a, b, c) return (a + b * c);
+        likely(x) return (x * 2);
+        sfence() printf("sfence*n");
+    )";
+    const std::string expect = "7 10\nsfence\n";
+
+    EXPECT_EQ(compile_and_run(source), expect);
+    auto assembly = file_contents(test_name + ".s");
+    EXPECT_NE(assembly.find("call prefetch"), std::string::npos);
+    EXPECT_EQ(assembly.find("prefetcht0"), std::string::npos);
+    EXPECT_EQ(assembly.find("  sfence\n"), std::string::npos);
+    EXPECT_EQ(assembly.find(".L.cold."), std::string::npos);
+
+    EXPECT_EQ(compile_and_run(source, "-O2"), expect);
+    EXPECT_EQ(interpret(source), expect);
+}
@@ -24,9 +24,10 @@ static void run_command(std::string &result, const std::string &cmd)
 
 //
 // Compile and run B code.
+// Extra compiler options can be given.
 // Return captured output.
 //
-std::string bcause::compile_and_run(const std::string &source_code)
+std::string bcause::compile_and_run(const std::string &source_code, const std::string &options)
 {
     const auto b_filename   = test_name + ".b";
     const auto exe_filename = test_name;
@@ -36,7 +37,8 @@ std::string bcause::compile_and_run(const std::string &source_code)
 
     // Compile B source into executable binary.
     std::string result;
-    run_command(result, "../bcause -save-temps -L.. " + b_filename + " -o " + exe_filename);
+    run_command(result, "../bcause -save-temps -L.. " + options + (options.empty() ? "" : " ") +
+                        b_filename + " -o " + exe_filename);
 
     // Run the binary.
     run_command(result, "./" + exe_filename);
@@ -45,6 +47,22 @@ std::string bcause::compile_and_run(const std::string &source_code)
     return result;
 }
 
+//
+// Run B code with the bytecode interpreter.
+// Extra compiler options can be given.
+// Return captured output.
+//
+std::string bcause::interpret(const std::string &source_code, const std::string &options)
+{
+    const auto b_filename = test_name + ".b";
+
+    create_file(b_filename, source_code);
+
+    std::string result;
+    run_command(result, "../bcause --interp " + options + (options.empty() ? "" : " ") + b_filename);
+    return result;
+}
+
 //
 // Read file contents and return it as a string.
 //
@@ -22,8 +22,14 @@ protected:
     }
 
     // Compile and run B code.
+    // Extra compiler options can be given.
     // Return captured output.
-    std::string compile_and_run(const std::string &input);
+    std::string compile_and_run(const std::string &input, const std::string &options = "");
+
+    // Run B code with the bytecode interpreter.
+    // Extra compiler options can be given.
+    // Return captured output.
+    std::string interpret(const std::string &input, const std::string &options = "");
 };
 
 //
@@ -90,3 +90,36 @@ TEST_F(bcause, function_ternary_operator)
 )";
     EXPECT_EQ(output, expect);
 }
+
+TEST_F(bcause, function_dead_code)
+{
+    auto output = compile_and_run(R"(
+        unused() {
+            printf("never called*n");
+        }
+
+        pick(a, b) {
+            auto ignored;
+
+            ignored = a * b;
+            if (a)
+                return (a);
+            else
+                return (b);
+            printf("unreachable*n");
+        }
+
+        main() {
+            printf("%d %d*n", pick(0, 5), pick(7, 5));
+        }
+    )");
+    const std::string expect = R"(5 7
+)";
+    EXPECT_EQ(output, expect);
+
+    // Unreferenced functions, code after return and stores to unread locals are gone.
+    auto assembly = file_contents(test_name + ".s");
+    EXPECT_EQ(assembly.find("unused"), std::string::npos);
+    EXPECT_EQ(assembly.find("jmp .L.end"), std::string::npos);
+    EXPECT_EQ(assembly.find("mov %rax, -32(%rbp)"), std::string::npos);
+}
@@ -86,3 +86,46 @@ offset c = -1008
 )";
     EXPECT_EQ(output, expect);
 }
+
+TEST_F(bcause, global_vectors_direct)
+{
+    auto output = compile_and_run(R"(
+        main() {
+            extrn fixed, moved, other;
+            auto i;
+
+            i = 0;
+            while (i < 3) {
+                fixed[i] = i * 10;
+                moved[i] = i * 100;
+                i++;
+            }
+            moved = &other[1];
+            printf("%d %d %d*n", fixed[0], fixed[1], fixed[2]);
+            printf("%d %d*n", moved[0], moved[1]);
+            printf("%d*n", sum(fixed, 3));
+        }
+
+        sum(v, n) {
+            auto s;
+            s = 0;
+            while (n)
+                s =+ v[--n];
+            return(s);
+        }
+
+        fixed[3];
+        moved[3];
+        other[] 1, 2, 3;
+    )");
+    const std::string expect = R"(0 10 20
+2 3
+30
+)";
+    EXPECT_EQ(output, expect);
+
+    // Only the vector that is never reassigned gets addressed directly.
+    auto assembly = file_contents(test_name + ".s");
+    EXPECT_NE(assembly.find("lea fixed+8(%rip)"), std::string::npos);
+    EXPECT_EQ(assembly.find("lea moved+8(%rip)"), std::string::npos);
+}
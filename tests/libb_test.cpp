@@ -96,4 +96,110 @@ TEST_F(bcause, libb_nwrite)
     EXPECT_EQ(output, expect);
 }
 
+TEST_F(bcause, libb_gather)
+{
+    auto output = compile_and_run(R"(
+        main() {
+            extrn msg;
+            auto i;
+
+            vbegin(1);
+            vputs("record ");
+            vprintn(-42, 10);
+            vputchar(': ');
+            vwrite(msg, 5);
+            vputchar('*n');
+            printf("written %d*n", vflush());
+
+            i = 0;
+            vbegin(1);
+            while (i < 100)
+                vprintn(i++ % 10, 10);
+            vputchar('*n');
+            vflush();
+        }
+
+        msg "hello world";
+    )");
+    const std::string expect = R"(record -42: hello
+written 18
+0123456789012345678901234567890123456789012345678901234567890123456789012345678901234567890123456789
+)";
+    EXPECT_EQ(output, expect);
+}
+
+TEST_F(bcause, libb_gather_printf)
+{
+    // printf() writes at once, and leaves the record of another file pending.
+    auto output = compile_and_run(R"(
+        main() {
+            auto fd;
+
+            fd = creat("libb_gather_printf.out", 0644);
+            vbegin(fd);
+            vputs("a");
+            printf("x*n");
+            vputs("b");
+            vprintn(7, 10);
+            printf("y %d*n", 3);
+            vputchar('*n');
+            vflush();
+            close(fd);
+        }
+    )");
+    EXPECT_EQ(output, "x\ny 3\n");
+    EXPECT_EQ(file_contents(test_name + ".out"), "ab7\n");
+}
+
+TEST_F(bcause, libb_huge_pages)
+{
+    // The text and the vector are moved onto huge pages at startup,
+    // and keep their contents.
+    auto output = compile_and_run(R"(
+        table[300000] 7, 8, 9;
+
+        main() {
+            extrn table;
+            auto i;
+
+            i = 3;
+            while (i < 300000) {
+                table[i] = i;
+                i++;
+            }
+            printf("%d %d %d*n", table[0] + table[2], table[299999], &table[1] - &table[0]);
+        }
+    )", "-fhuge-pages");
+    EXPECT_EQ(output, "16 299999 8\n");
+}
+
+TEST_F(bcause, libb_vector_kernels)
+{
+    // The lengths are no multiple of any vector size; the smallest
+    // and largest words occur twice, the first index is returned.
+    const std::string source = R"(
+        v[37]; w[37];
+
+        main() {
+            extrn v, w;
+            auto i;
+
+            i = 0;
+            while (i < 37) {
+                v[i] = i * 7 % 23 - 11;
+                w[i] = i;
+                i++;
+            }
+            printf("%d %d %d %d*n", vsum(v, 37), vmin(v, 37), vmax(v, 37), vdot(v, w, 37));
+            printf("%d %d %d %d*n", vmin(&v[1], 36), vmin(v, 0), vcount(v, 37, 3), vcountle(v, 37, 0));
+            vaxpy(w, -2, v, 37);
+            printf("%d %d*n", vsum(w, 37), w[36]);
+        }
+    )";
+    const std::string expect = "0 0 13 224\n22 -1 2 19\n666 14\n";
+    EXPECT_EQ(compile_and_run(source), expect);
+    EXPECT_EQ(compile_and_run(source, "-mword=32"), expect);
+    EXPECT_EQ(interpret(source), expect);
+}
+
 //TODO: read nread
@@ -0,0 +1,622 @@
+#include "fixture.h"
+
+#include <filesystem>
+
+static const std::string levels_source = R"(
+    sign(x) {
+        if (x < 0)
+            return (-1);
+        else
+            return (x > 0 ? 1 : 0);
+    }
+
+    main() {
+        printf("%d %d %d*n", sign(-7), sign(0), sign(7));
+    }
+)";
+
+TEST_F(bcause, optimization_level_0)
+{
+    auto output = compile_and_run(levels_source, "-O0");
+    EXPECT_EQ(output, "-1 0 1\n");
+
+    // Code is kept as the parser emits it.
+    auto assembly = file_contents(test_name + ".s");
+    EXPECT_NE(assembly.find("jmp .L.end"), std::string::npos);
+    EXPECT_EQ(assembly.find("cmovne"), std::string::npos);
+}
+
+TEST_F(bcause, optimization_level_1)
+{
+    auto output = compile_and_run(levels_source, "-O1");
+    EXPECT_EQ(output, "-1 0 1\n");
+
+    auto assembly = file_contents(test_name + ".s");
+    EXPECT_EQ(assembly.find("jmp .L.end"), std::string::npos);
+    EXPECT_NE(assembly.find("cmovne"), std::string::npos);
+}
+
+TEST_F(bcause, optimization_level_2)
+{
+    auto output = compile_and_run(levels_source, "-O2");
+    EXPECT_EQ(output, "-1 0 1\n");
+
+    auto assembly = file_contents(test_name + ".s");
+    EXPECT_EQ(assembly.find("jmp .L.end"), std::string::npos);
+    EXPECT_NE(assembly.find("cmovne"), std::string::npos);
+}
+
+TEST_F(bcause, redundant_loads)
+{
+    auto output = compile_and_run(R"(
+        n 7;
+        v[3] 1, 2, 3;
+
+        main() {
+            extrn n, v;
+            auto i, s;
+
+            s = n * n + n;
+            i = 1;
+            v[i] = v[i] + s;
+            printf("%d %d*n", s, v[i]);
+        }
+    )", "-O2");
+    EXPECT_EQ(output, "56 58\n");
+
+    // The global is loaded once, later uses come from registers.
+    auto assembly = file_contents(test_name + ".s");
+    auto first = assembly.find("n(%rip)");
+    ASSERT_NE(first, std::string::npos);
+    EXPECT_EQ(assembly.find("n(%rip)", first + 1), std::string::npos);
+}
+
+TEST_F(bcause, omit_frame_pointer)
+{
+    auto output = compile_and_run(R"(
+        sum(n) {
+            auto i, s;
+
+            i = s = 0;
+            while (i < n) {
+                s =+ i;
+                i++;
+            }
+            return (s);
+        }
+
+        main() {
+            printf("%d %d*n", sum(10), sum(100));
+        }
+    )", "-O2");
+    EXPECT_EQ(output, "45 4950\n");
+
+    // The leaf function keeps its frame in the red zone.
+    auto assembly = file_contents(test_name + ".s");
+    auto leaf = assembly.substr(assembly.find("sum.internal:"), assembly.find("main:") - assembly.find("sum.internal:"));
+    EXPECT_EQ(leaf.find("%rbp"), std::string::npos);
+    EXPECT_EQ(leaf.find("%rsp\n"), std::string::npos);
+    EXPECT_EQ(assembly.find("push %rbp"), std::string::npos);
+}
+
+TEST_F(bcause, unroll_loops)
+{
+    auto output = compile_and_run(R"(
+        main() {
+            auto i, n, s, v[20];
+
+            i = s = 0;
+            n = 11;
+            while (i < n) {
+                v[i] = i * i;
+                s =+ v[i];
+                i++;
+            }
+            printf("%d %d*n", s, i);
+
+            i = 0;
+            while (i <= 010) {
+                s =- i;
+                i++;
+            }
+            printf("%d %d*n", s, i);
+        }
+    )", "-funroll-loops --param unroll=3");
+    const std::string expect = R"(385 11
+349 9
+)";
+    EXPECT_EQ(output, expect);
+
+    // Both loops get an unrolled part and a remainder loop.
+    auto assembly = file_contents(test_name + ".s");
+    auto first = assembly.find("jmp .L.unroll.");
+    ASSERT_NE(first, std::string::npos);
+    EXPECT_NE(assembly.find("jmp .L.unroll.", first + 1), std::string::npos);
+    EXPECT_NE(assembly.find("jmp .L.start."), std::string::npos);
+}
+
+TEST_F(bcause, unroll_inner_increment)
+{
+    // An increment ending the body inside an inner statement
+    // is not the step of the loop.
+    auto output = compile_and_run(R"(
+        main() {
+            auto i, n, s, t;
+
+            i = s = 0;
+            n = 8;
+            while (i < n) {
+                s =+ 1;
+                t = i;
+                while (i < t + 3) i++;
+            }
+            printf("%d %d*n", s, i);
+
+            i = s = 0;
+            while (i < n) {
+                s =+ i;
+                if (s > 100) s = 0; else i++;
+            }
+            printf("%d %d*n", s, i);
+        }
+    )", "-funroll-loops");
+    EXPECT_EQ(output, "3 9\n28 8\n");
+    EXPECT_EQ(file_contents(test_name + ".s").find(".L.unroll."), std::string::npos);
+}
+
+TEST_F(bcause, divide_by_constant)
+{
+    auto output = compile_and_run(R"(
+        main() {
+            auto x;
+
+            x = -12345;
+            printf("%d %d %d %d ", x / 10, x % 10, x / 8, x % 8);
+            printf("%d %d*n", x / 7, x % 7);
+            x = 98765;
+            printf("%d %d %d %d*n", x / 10, x % 10, x / 16, x % 16);
+        }
+    )");
+    EXPECT_EQ(output, "-1234 -5 -1543 -1 -1763 -4\n9876 5 6172 13\n");
+
+    // No division instructions are left.
+    auto assembly = file_contents(test_name + ".s");
+    EXPECT_EQ(assembly.find("idiv"), std::string::npos);
+}
+
+TEST_F(bcause, specialize)
+{
+    auto output = compile_and_run(R"(
+        printd(n, b) {
+            auto a;
+
+            if (n < 0) {
+                putchar('-');
+                n = -n;
+            }
+            if (a = n / b)
+                printd(a, b);
+            putchar(n % b + '0');
+        }
+
+        main() {
+            printd(1234, 10);
+            putchar(' ');
+            printd(-987, 10);
+            putchar(' ');
+            printd(255, 8);
+            putchar('*n');
+        }
+    )", "-O2");
+    EXPECT_EQ(output, "1234 -987 377\n");
+
+    // Calls with base 10 go to a clone, which divides without idiv.
+    auto assembly = file_contents(test_name + ".s");
+    auto clone = assembly.find("printd.spec.0:");
+    ASSERT_NE(clone, std::string::npos);
+    EXPECT_NE(assembly.find("call printd.spec.0"), std::string::npos);
+    EXPECT_EQ(assembly.find("idiv", clone), std::string::npos);
+}
+
+TEST_F(bcause, internal_calls)
+{
+    auto output = compile_and_run(R"(
+        fib(n) {
+            if (n < 2)
+                return (n);
+            return (fib(n - 1) + fib(n - 2));
+        }
+
+        digits(n, i) {
+            i = 1;
+            while (n =/ 10)
+                i++;
+            return (i);
+        }
+
+        main() {
+            printf("%d %d %d*n", fib(20), digits(12345), digits(7, 0));
+        }
+    )", "-O2");
+    EXPECT_EQ(output, "6765 5 1\n");
+
+    // Calls with all the arguments leave them on the stack, where the
+    // callee reads them. The one with a missing argument enters by the stub.
+    auto assembly = file_contents(test_name + ".s");
+    auto body = assembly.find("fib.internal:");
+    ASSERT_NE(body, std::string::npos);
+    EXPECT_NE(assembly.find("call fib.internal"), std::string::npos);
+    EXPECT_NE(assembly.find("call digits.internal"), std::string::npos);
+    EXPECT_NE(assembly.find("call digits\n"), std::string::npos);
+    EXPECT_EQ(assembly.find("mov %rdi, ", body), std::string::npos);
+}
+
+TEST_F(bcause, optimization_record)
+{
+    auto output = compile_and_run(R"(
+        main() {
+            auto i, s, p;
+
+            i = s = 0;
+            while (i < 10) {
+                s =+ i;
+                i++;
+            }
+            p = &s;
+            printf("%d*n", *p);
+        }
+    )", "-funroll-loops -fsave-optimization-record");
+    EXPECT_EQ(output, "45\n");
+
+    // Remarks name the pass, the outcome and the source location.
+    auto record = file_contents(test_name + ".opt.yaml");
+    EXPECT_NE(record.find("--- !Passed\nPass:            unroll\nName:            Unrolled\n"
+                          "DebugLoc:        { File: 'optimization_record.b', Line: 6, Column: 20 }\n"
+                          "Function:        main\n"), std::string::npos);
+    EXPECT_NE(record.find("--- !Missed\nPass:            local-value-numbering\nName:            AddressTaken\n"
+                          "DebugLoc:        { File: 'optimization_record.b', Line: 10, Column: 17 }\n"), std::string::npos);
+}
+
+TEST_F(bcause, bit_test)
+{
+    auto output = compile_and_run(R"(
+        kind(c) {
+            switch (c) {
+            case ' ':
+            case '*t':
+            case '*n':
+                return (1);
+            case 'a': case 'e': case 'i': case 'o': case 'u':
+                return (2);
+            case 'x': case 'y':
+                return (3);
+            }
+            return (0);
+        }
+
+        main() {
+            auto s, c, i;
+
+            s = "hex tau*n";
+            i = 0;
+            while ((c = char(s, i++)) != '*e') {
+                putchar('0' + kind(c));
+                if (c == 'h' | c == 't' | c == 'u' | c == 'x')
+                    putchar('!');
+            }
+            putchar('0' + kind(-1) + kind(0140 + 'a'));
+            putchar('*n');
+        }
+    )");
+    EXPECT_EQ(output, "0!23!10!22!10\n");
+
+    // Both case clusters of five and three values, and the chain of
+    // comparisons, become bit tests.
+    auto assembly = file_contents(test_name + ".s");
+    auto first = assembly.find("  bt ");
+    ASSERT_NE(first, std::string::npos);
+    first = assembly.find("  bt ", first + 1);
+    ASSERT_NE(first, std::string::npos);
+    EXPECT_NE(assembly.find("  bt ", first + 1), std::string::npos);
+    EXPECT_NE(assembly.find("cmp $120, %rax"), std::string::npos);
+}
+
+TEST_F(bcause, jump_threading)
+{
+    auto output = compile_and_run(R"(
+        main() {
+            auto i, n;
+
+            i = n = 0;
+            while (i < 10) {
+                if (i < 3) {
+                    if (i == 1)
+                        n =+ 1;
+                    else
+                        n =+ 2;
+                }
+                else {
+                    if (i > 7)
+                        n =+ 10;
+                }
+                if (i & 1) {
+                    putchar('o');
+                    putchar('*n');
+                }
+                else {
+                    putchar('e');
+                    putchar('*n');
+                }
+                i++;
+            }
+            printf("%d*n", n);
+        }
+    )", "-O2");
+    EXPECT_EQ(output, "e\no\ne\no\ne\no\ne\no\ne\no\n25\n");
+
+    // No jump lands on another jump, and both arms of the second if
+    // share the call of putchar.
+    auto assembly = file_contents(test_name + ".s");
+    EXPECT_EQ(assembly.find(":\n  jmp "), std::string::npos);
+    EXPECT_NE(assembly.find("jmp .L.tail."), std::string::npos);
+}
+
+TEST_F(bcause, instruction_selection)
+{
+    auto output = compile_and_run(R"(
+        main() {
+            auto a, b, x, i, v[4];
+
+            a = 100;
+            b = 3;
+            x = a + b * 4 + 8;
+            i = 0;
+            while (i < 4) {
+                v[i] = i * 10 + 5;
+                i++;
+            }
+            i = 2;
+            x =+ v[i];
+            if (x != 0)
+                printf("%d %d %d*n", x, a - b, x >> 2);
+        }
+    )");
+    EXPECT_EQ(output, "145 97 36\n");
+
+    // Scaled addressing, immediate and memory operands, and test.
+    auto assembly = file_contents(test_name + ".s");
+    EXPECT_NE(assembly.find("lea 8(%rdi,%rax,4), %rax"), std::string::npos);
+    EXPECT_NE(assembly.find("mov (%rdi,%rax,8), %rax"), std::string::npos);
+    EXPECT_NE(assembly.find("imul $10, %rax"), std::string::npos);
+    EXPECT_NE(assembly.find("add $5, %rax"), std::string::npos);
+    EXPECT_NE(assembly.find("add %rax, -32(%rbp)"), std::string::npos);
+    EXPECT_NE(assembly.find("sub -24(%rbp), %rax"), std::string::npos);
+    EXPECT_NE(assembly.find("test %rax, %rax"), std::string::npos);
+}
+
+static auto cache_entries(const std::string &dir)
+{
+    return std::distance(std::filesystem::directory_iterator(dir), std::filesystem::directory_iterator());
+}
+
+TEST_F(bcause, incremental_cache)
+{
+    const std::string source = R"(
+        printd(n, b) {
+            auto a;
+
+            if (a = n / b)
+                printd(a, b);
+            putchar(n % b + '0');
+        }
+
+        square(x) {
+            return (x * x);
+        }
+
+        main() {
+            printd(square(12), 10);
+            putchar(' ');
+            printd(square(5), 10);
+            printf(" %s*n", "done");
+        }
+    )";
+    const std::string cache_dir = test_name + ".cache";
+    std::filesystem::remove_all(cache_dir);
+
+    auto output = compile_and_run(source, "-O2");
+    EXPECT_EQ(output, "144 25 done\n");
+    auto assembly = file_contents(test_name + ".s");
+
+    // The second compile takes every function from the cache.
+    output = compile_and_run(source, "-O2 --cache-dir=" + cache_dir);
+    EXPECT_EQ(output, "144 25 done\n");
+    EXPECT_EQ(file_contents(test_name + ".s"), assembly);
+    auto entries = cache_entries(cache_dir);
+    output = compile_and_run(source, "-O2 --cache-dir=" + cache_dir);
+    EXPECT_EQ(file_contents(test_name + ".s"), assembly);
+    EXPECT_EQ(cache_entries(cache_dir), entries);
+
+    // Only the edited function is compiled again: its facts and its code.
+    auto edited = source;
+    edited.replace(edited.find("x * x"), 5, "x * x + 1");
+    output = compile_and_run(edited, "-O2");
+    EXPECT_EQ(output, "145 26 done\n");
+    assembly = file_contents(test_name + ".s");
+    output = compile_and_run(edited, "-O2 --cache-dir=" + cache_dir);
+    EXPECT_EQ(output, "145 26 done\n");
+    EXPECT_EQ(file_contents(test_name + ".s"), assembly);
+    EXPECT_EQ(cache_entries(cache_dir), entries + 2);
+}
+
+TEST_F(bcause, parallel_optimization)
+{
+    const std::string source = R"(
+        sum(n) {
+            auto s;
+
+            s = 0;
+            while (n > 0)
+                s =+ n--;
+            return (s);
+        }
+
+        mul(a, b) {
+            return (a * b);
+        }
+
+        clamp(x, lo, hi) {
+            return (x < lo ? lo : x > hi ? hi : x);
+        }
+
+        main() {
+            printf("%d %d %d*n", sum(100), mul(6, 7), clamp(15, 0, 10));
+        }
+    )";
+
+    // Functions optimized by several threads come out in source order,
+    // the same as from one thread.
+    auto output = compile_and_run(source, "-O2 --param threads=1");
+    EXPECT_EQ(output, "5050 42 10\n");
+    auto assembly = file_contents(test_name + ".s");
+    output = compile_and_run(source, "-O2 --param threads=4");
+    EXPECT_EQ(output, "5050 42 10\n");
+    EXPECT_EQ(file_contents(test_name + ".s"), assembly);
+    EXPECT_LT(assembly.find("sum:"), assembly.find("mul:"));
+    EXPECT_LT(assembly.find("mul:"), assembly.find("clamp:"));
+}
+
+TEST_F(bcause, function_layout)
+{
+    auto output = compile_and_run(R"(
+        n;
+
+        cold1() {
+            printf("start*n");
+        }
+
+        cold2() {
+            extrn n;
+            printf("%d*n", n);
+        }
+
+        hot() {
+            extrn n;
+            n =+ 3;
+        }
+
+        main() {
+            auto i;
+
+            cold1();
+            i = 0;
+            while (i < 100) {
+                hot();
+                i++;
+            }
+            cold2();
+        }
+    )", "-O2");
+    EXPECT_EQ(output, "start\n300\n");
+
+    // The function called in the loop comes first, next to its caller,
+    // and the others follow. Entries and loop heads are aligned.
+    auto assembly = file_contents(test_name + ".s");
+    EXPECT_NE(assembly.find(".section .text.sorted.00001,\"ax\",@progbits\n.align 16\n.type hot,"), std::string::npos);
+    EXPECT_NE(assembly.find(".section .text.sorted.00002,\"ax\",@progbits\n.align 16\n.type main,"), std::string::npos);
+    EXPECT_NE(assembly.find(".section .text.sorted.00003,\"ax\",@progbits\n.align 16\n.type cold1,"), std::string::npos);
+    EXPECT_NE(assembly.find(".section .text.sorted.00004,\"ax\",@progbits\n.align 16\n.type cold2,"), std::string::npos);
+    auto loop = assembly.find(".align 16\n.L.");
+    ASSERT_NE(loop, std::string::npos);
+    EXPECT_GT(loop, assembly.find("main:"));
+}
+
+TEST_F(bcause, branch_hints)
+{
+    const std::string source = R"(
+        check(x) {
+            if (unlikely(x < 0)) {
+                printf("negative*n");
+                return (0);
+            }
+            if (likely(x < 10))
+                return (x);
+            else
+                return (x * 2);
+        }
+
+        main() {
+            auto i, s;
+
+            i = s = 0;
+            while (i < 20) {
+                if (unlikely(i == 7)) s =+ 100;
+                s =+ check(i++);
+            }
+            printf("%d %d*n", s, check(-1));
+        }
+    )";
+    const std::string expect = "negative\n435 0\n";
+    EXPECT_EQ(compile_and_run(source, "-O0"), expect);
+    EXPECT_EQ(compile_and_run(source, "-O2 -funroll-loops"), expect);
+
+    // The arms not expected to run follow the return, out of the way.
+    auto assembly = file_contents(test_name + ".s");
+    auto ret = assembly.find("  ret\n.L.cold.");
+    ASSERT_NE(ret, std::string::npos);
+    EXPECT_LT(ret, assembly.find("shl $1, %rax"));
+    EXPECT_LT(ret, assembly.find("lea .string.0"));
+    EXPECT_EQ(interpret(source), expect);
+}
+
+TEST_F(bcause, stack_usage)
+{
+    const std::string source = R"(
+        depth(n) {
+            if (n == 0)
+                return (0);
+            return (1 + depth(n - 1));
+        }
+
+        sum(a, b, c) {
+            auto v 2;
+
+            v[0] = a;
+            v[1] = b;
+            v[2] = c;
+            return (v[0] + v[1] + v[2]);
+        }
+
+        twice(x) {
+            return (sum(x, x, 0));
+        }
+
+        main() {
+            printf("%d %d*n", twice(21), depth(5));
+        }
+    )";
+    EXPECT_EQ(compile_and_run(source, "-O0 -fstack-usage"), "42 5\n");
+
+    // The frame of sum is 7 words, with 2 words pushed at most,
+    // the saved %rbp and the return address.
+    auto report = file_contents(test_name + ".su");
+    EXPECT_NE(report.find(test_name + ".b:8:9:sum\t88\tstatic\n"), std::string::npos);
+    EXPECT_NE(report.find(":twice\t64\tstatic\tsum\n"), std::string::npos);
+    EXPECT_NE(report.find(":main\t64\tstatic\ttwice,depth,printf\n"), std::string::npos);
+
+    // The bound of a call adds the deepest callee.
+    FILE *pipe = popen(("../bcause --stack-bound " + test_name + ".su").c_str(), "r");
+    ASSERT_TRUE(pipe != nullptr);
+    auto bounds = stream_contents(pipe);
+    EXPECT_EQ(pclose(pipe), 0);
+    EXPECT_EQ(bounds, "depth\t56\tunbounded\trecursion through depth\n"
+                      "sum\t88\tstatic\n"
+                      "twice\t152\tstatic\n"
+                      "main\t216\tunbounded\trecursion through depth; not counted: printf\n");
+
+    // Internal entries, and leaf frames in the red zone, are reported too.
+    EXPECT_EQ(compile_and_run(source, "-O2 -fstack-usage"), "42 5\n");
+    report = file_contents(test_name + ".su");
+    EXPECT_NE(report.find(":twice.internal\t40\tstatic\tsum.internal\n"), std::string::npos);
+    EXPECT_EQ(report.find("dynamic"), std::string::npos);
+}
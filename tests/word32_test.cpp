@@ -0,0 +1,45 @@
+#include <fstream>
+
+#include "fixture.h"
+
+TEST_F(bcause, word32_vectors)
+{
+    auto output = compile_and_run(R"(
+        main() {
+            extrn v, g;
+            auto a[10], i, p, x;
+
+            i = 0;
+            while (i < 10) {
+                a[i] = i * i;
+                i++;
+            }
+            printf("%d %d %d*n", a[3], a[9], v[1]);
+            printf("word size %d*n", &v[1] - &v[0]);
+
+            p = &x;
+            *p = -7;
+            x =* 3;
+            printf("%d %d %s %c*n", x, g, "str", 'abcd');
+            ++x;
+            x--;
+            --x;
+            printf("%d*n", x);
+        }
+
+        v[3] 5, 6, 7;
+        g -12;
+    )", "-mword=32");
+    const std::string expect = R"(9 81 6
+word size 4
+-21 -12 str abcd
+-22
+)";
+    EXPECT_EQ(output, expect);
+}
+
+TEST_F(bcause, word32_example_fibonacci)
+{
+    auto output = compile_and_run(file_contents(TEST_DIR "/../examples/fibonacci.b"), "-mword=32");
+    EXPECT_EQ(output, "55\n");
+}